@@ -5,6 +5,9 @@
 #include <stdbool.h>
 #include <assert.h>
 #include <stdlib.h>
+#include <math.h>
+#include <sys/param.h>
+#include <unistd.h>
 
 #include "util.h"
 #include "dyna.h"
@@ -12,6 +15,11 @@
 #include "cuepos.h"
 #include "ass_ruby.h"
 #include "font.h"
+#include "thpool.h"
+#include "ass_spill.h"
+#include "ass_layout.h"
+#include "ass_cache.h"
+#include "strbuf.h"
 
 // for debug
 #include <signal.h>
@@ -78,36 +86,55 @@ static void ass_write_dialog_prop(FILE *f, const struct ass_node *an)
            );
 }
 
+static void ass_write_line(FILE *f, const struct ass_node *an)
+{
+    ass_write_dialog_prop(f, an);
+    fputs(an->text, f);
+    fputs("\n", f);
+}
+
 #if 1
-static int ass_draw_box(int n, char out_tags[n], const struct ass_cue_pos *an7pos, const struct cuepos_box *box, const char *color)
+static void ass_draw_box(struct strbuf *out, const struct ass_cue_pos *an7pos, const struct cuepos_box *box, const char *color)
 {
+    const int pts[] = {
+        box->left, box->top, box->left + box->width, box->top,
+        box->left + box->width, box->top + box->height, box->left, box->top + box->height,
+    };
     const char *col = color;
     if (col == NULL)
         col = "0000FF";
 
-    return snprintf(out_tags, n, "{\\alpha&HB0&\\c&H%s&\\an7\\pos(%d,%d)\\p1}m %d %d l %d %d %d %d %d %d", col,
-            an7pos->posx, an7pos->posy,
-            box->left, box->top, box->left + box->width, box->top,
-            box->left + box->width, box->top + box->height, box->left, box->top + box->height);
+    strbuf_append_lit(out, "{\\alpha&HB0&\\c&H");
+    strbuf_append_str(out, col);
+    strbuf_append_lit(out, "&\\an7\\pos(");
+    strbuf_append_int(out, an7pos->posx);
+    strbuf_append_char(out, ',');
+    strbuf_append_int(out, an7pos->posy);
+    strbuf_append_lit(out, ")\\p1}m");
+    for (int i = 0; i < ARRSIZE(pts); i++) {
+        /* The first point is the move, the rest are the lines */
+        strbuf_append_lit(out, " ");
+        if (i == 2)
+            strbuf_append_lit(out, "l ");
+        strbuf_append_int(out, pts[i]);
+    }
 }
 
 void ass_append_box(const struct cue *c, const struct ass_cue_pos *an7pos,
         const struct cuepos_box *box, const char *color, struct ass_params *ap)
 {
-    char text[1024];
-    int text_len;
+    struct strbuf text;
     struct ass_node anode = {
         .start_ms = c->time_start,
         .end_ms = c->time_end,
         .layer = 0,
-        .style = ass_styles_get(ap->styles, "Default"),
+        .style = ap->def_style,
     };
 
-    text_len = ass_draw_box(sizeof(text), text, an7pos, box, color);
-    assert(text_len < sizeof(text));
-
-    anode.text = strdup(text);
-    dyna_append(ap->ass_nodes, &anode);
+    strbuf_init(&text);
+    ass_draw_box(&text, an7pos, box, color);
+    anode.text = strbuf_steal(&text);
+    ass_node_vec_append(ap->ass_nodes, &anode);
 }
 #endif
 
@@ -133,10 +160,10 @@ static void ass_write_header(FILE *f)
 
 static void ass_write_styles(FILE *f, const struct ass_params *ap)
 {
-    for (int i = 0; i < ap->styles->e_idx; i++) {
+    for (int i = 0; i < ap->styles->list->e_idx; i++) {
         char bord_color_str[12];
         const char *fontname;
-        const struct ass_style *s = dyna_elem(ap->styles, i);
+        const struct ass_style *s = ass_styles_at(ap->styles, i);
 
         ass_style_rgb_to_str(s->bord_color, bord_color_str);
         fontname = font_get_name(font_get_face(s->fontpath));
@@ -176,57 +203,101 @@ void ass_push_style_stack(struct stack *style_stack, const struct ass_style *sty
     copyifset(bold);
     copyifset(underline);
     copyifset(ruby_under);
+    new_style.cache_id = -1;
 
     stack_push(style_stack, &new_style);
 
 #undef copyifset
 }
 
-int style_to_inline_tags(const struct ass_style *style, int out_len, char out[out_len])
+void style_to_inline_tags(const struct ass_style *style, struct strbuf *out)
 {
     printf("Applying styles\n");
 #define apply_bool(tag, ass_tag) \
     if (style->tag##_set) { \
-        w += snprintf(out + w, out_len - w, ass_tag "%d", style->tag); \
+        strbuf_append_lit(out, ass_tag); \
+        strbuf_append_int(out, style->tag); \
     }
 
-    int w = 0;
-
-    w += snprintf(out + w, out_len - w, "{");
+    strbuf_append_char(out, '{');
 
     apply_bool(italic, "\\i");
     apply_bool(bold, "\\b");
     apply_bool(underline, "\\u");
 
-    w += snprintf(out + w, out_len - w, "}");
-    return w;
+    strbuf_append_char(out, '}');
 #undef apply_bool
 }
 
-static void class_to_style(const char *class_name, const struct ass_params *ap, struct ass_style *out)
+/* Applies the STYLE rules that match the node */
+static void rules_to_style(const struct cue *c, const struct vtt_node *node, const struct ass_params *ap, struct ass_style *out)
 {
-    printf("Class to style\n");
-    // This will have to be changed in the future...
-    char cname_with_cue[128];
-
-    sprintf(cname_with_cue, "::cue(.%s)", class_name);
+    const struct cue_style *rules[CUESTYLE_MAX_MATCH];
+    int count = cuestyle_match(ap->cuestyles, c->ident, node, ARRSIZE(rules), rules);
 
-    const struct cue_style *cs = cuestyle_get_by_selector(ap->cuestyles, cname_with_cue);
-    if (cs == NULL) {
-        fprintf(stderr, "Cannot find style with full class name: '%s'\n", cname_with_cue);
+    if (count == 0 && node->type == VNODE_CLASS && node->classes.count > 0) {
+        fprintf(stderr, "Cannot find style for class: '%s'\n", atom_str(ctxt_classes(&node->classes)[0]));
         return;
     }
 
-    if (cs->italic) {
-        out->italic = out->italic_set = true;
+    for (int i = 0; i < count; i++) {
+        const struct cue_style *cs = rules[i];
+
+        if (cs->italic_set) {
+            out->italic = cs->italic;
+            out->italic_set = true;
+        }
+        if (cs->bold_set) {
+            out->bold = cs->bold;
+            out->bold_set = true;
+        }
+        if (cs->decoration_set) {
+            out->underline = cs->underline;
+            out->underline_set = true;
+        }
+        if (cs->ruby_position != RUBYPOS_UNSET) {
+            out->ruby_under = cs->ruby_position == RUBYPOS_UNDER;
+            out->ruby_under_set = true;
+        }
     }
-    if (cs->ruby_position != RUBYPOS_UNSET) {
-        out->ruby_under = cs->ruby_position == RUBYPOS_UNDER;
-        out->ruby_under_set = true;
+}
+
+void ass_push_node_style(struct stack *style_stack, const struct cue *c, const struct vtt_node *node, const struct ass_params *ap)
+{
+    const struct ass_style *top = stack_top(style_stack);
+    struct ass_cached_style *cs;
+    struct ass_style ns, *pushed;
+    char key[256];
+    struct strbuf tags;
+    int key_len = -1;
+
+    /* Only styles that are themselves known to the cache can be a parent in a key */
+    if (top->cache_id >= 0) {
+        memcpy(key, &top->cache_id, sizeof(int));
+        key_len = cuestyle_node_key(ap->cuestyles, c->ident, node, sizeof(key) - sizeof(int), key + sizeof(int));
+        if (key_len >= 0)
+            key_len += sizeof(int);
+    }
+
+    if (key_len >= 0 && (cs = ass_style_cache_get(ap->style_cache, key, key_len))) {
+        stack_push(style_stack, &cs->style);
+        return;
+    }
+
+    ass_node_to_style(c, node, ap, &ns);
+    ass_push_style_stack(style_stack, &ns);
+
+    if (key_len >= 0) {
+        pushed = stack_top(style_stack);
+        strbuf_init(&tags);
+        style_to_inline_tags(pushed, &tags);
+        cs = ass_style_cache_add(ap->style_cache, key, key_len, pushed, strbuf_data(&tags));
+        pushed->cache_id = cs->style.cache_id;
+        strbuf_free(&tags);
     }
 }
 
-void ass_node_to_style(const struct vtt_node *node, const struct ass_params *ap, struct ass_style *out)
+void ass_node_to_style(const struct cue *c, const struct vtt_node *node, const struct ass_params *ap, struct ass_style *out)
 {
     memset(out, 0, sizeof(*out));
     out->italic = node->type == VNODE_ITALIC;
@@ -236,87 +307,39 @@ void ass_node_to_style(const struct vtt_node *node, const struct ass_params *ap,
     out->underline = node->type == VNODE_UNDERLINE;
     out->underline_set = node->type == VNODE_UNDERLINE;
 
-    if (node->type == VNODE_CLASS) {
-        for (int i = 0; i < node->class_names->e_idx; i++) {
-            const char *class_name = *(char**)dyna_elem(node->class_names, i);
-            class_to_style(class_name, ap, out);
-        }
-    }
+    rules_to_style(c, node, ap, out);
 }
 
-static int ass_text_collect_tags_and_escape(const struct vtt_node *node, int n, char out[n], struct stack *style_stack, bool *have_ruby, const struct ass_params *ap)
+static void ass_text_collect_tags_and_escape(const struct cue *c, const struct vtt_node *node, struct strbuf *out, struct stack *style_stack, const struct ass_params *ap)
 {
-    int w = 0;
-
     if (node->type == VNODE_TIMESTAMP)
-        return 0;
+        return;
 
     if (node->type == VNODE_TEXT) {
 
-        w += style_to_inline_tags(stack_top(style_stack), n - w, out + w);
-
-        char *nn = node->text, *pn = nn;
-        while (*pn) {
-            nn = strchr(pn, '\n');
-            if (!nn) {
-                w += snprintf(out + w, n - w, "%s", pn);
-                if (w > n) return w;
-                break;
-            }
-            w += snprintf(out + w, n - w, "%.*s\\N", (int)(nn - pn), pn);
-            if (w > n) return w;
-            pn = nn + 1;
+        const struct ass_style *top = stack_top(style_stack);
+        if (top->cache_id > 0) {
+            strbuf_append_str(out, ass_style_cache_at(ap->style_cache, top->cache_id)->tags);
+        } else {
+            style_to_inline_tags(top, out);
         }
-        return w;
+
+        strbuf_append_escaped(out, node->text, strlen(node->text));
+        return;
     } else if (node->type == VNODE_RUBY_TEXT) {
-        if (have_ruby)
-            *have_ruby = true;
-        return 0;
-    } else if (node->type == VNODE_ITALIC) {
-        struct ass_style ns = {
-            .italic = true, .italic_set = true,
-        };
-        ass_push_style_stack(style_stack, &ns);
-    } else if (node->type == VNODE_BOLD) {
-        struct ass_style ns = {
-            .bold = true, .bold_set = true,
-        };
-        ass_push_style_stack(style_stack, &ns);
-    } else if (node->type == VNODE_UNDERLINE) {
-        struct ass_style ns = {
-            .underline = true, .underline_set = true,
-        };
-        ass_push_style_stack(style_stack, &ns);
-    } else if (node->type == VNODE_CLASS) {
-        struct ass_style ns = {0};
-        for (int i = 0; i < node->class_names->e_idx; i++) {
-            const char *class_name = *(char**)dyna_elem(node->class_names, i);
-            printf("name: %s\n", class_name);
-            class_to_style(class_name, ap, &ns);
-        }
-        ass_push_style_stack(style_stack, &ns);
+        return;
     }
 
+    /* The rest of the nodes can have styles */
+    ass_push_node_style(style_stack, c, node, ap);
+
     for (int i = 0; node->childs && i < node->childs->e_idx; i++) {
         struct vtt_node *cn = dyna_elem(node->childs, i);
 
-        w += ass_text_collect_tags_and_escape(cn, n - w, out + w, style_stack, have_ruby, ap);
-        if (w > n) return w;
-    }
-
-    switch (node->type) {
-    case VNODE_CLASS:
-    case VNODE_ITALIC:
-    case VNODE_BOLD:
-    case VNODE_UNDERLINE:
-        printf("Style Pop\n");
-        stack_pop(style_stack);
-        break;
-    default:
-        break;
+        ass_text_collect_tags_and_escape(c, cn, out, style_stack, ap);
     }
 
-    return w;
+    stack_pop(style_stack);
 }
 
 /* Convert align for horizontal text into
@@ -351,7 +374,7 @@ static void ass_pos_line_in_box(const struct cue *c, const struct cuepos_box *bo
     };
     //BP;
     int xal = 0, yal = 0;
-    int lc = util_count_node_lines(c->text_node);
+    int lc = c->text_info.lines;
     op->fs = 5 * (vinf->height / 100.0f);
     int text_height = lc * op->fs;
     bool is_wdh = c->writing_direction == WD_HORIZONTAL;
@@ -464,81 +487,102 @@ static void ass_pos_line_in_box(const struct cue *c, const struct cuepos_box *bo
     }
 }
 
-int ass_opt_tags_str(const struct cue *c, const struct ass_params *ap, int tags_size, char tags[tags_size])
+void ass_opt_tags_str(const struct cue *c, const struct ass_params *ap, struct strbuf *out)
 {
-    int r = 0;
-
     if (c->writing_direction != WD_HORIZONTAL) {
         /* Some kind of vertical */
         FT_Face font = font_get_face(ap->fontpath);
-        const char *fontname = font_get_name(font);
-        r += snprintf(tags + r, tags_size - r, "\\fn@%s\\frz270", fontname);
+        strbuf_append_lit(out, "\\fn@");
+        strbuf_append_str(out, font_get_name(font));
+        strbuf_append_lit(out, "\\frz270");
     }
+}
 
-    if (r < tags_size) {
-        tags[r] = '\0';
-    }
-    return r;
+/* Computes the box, position and tag prefix of the cue, or takes them from the cache */
+static const struct ass_layout *ass_cue_layout(const struct cue *c, const struct ass_params *ap)
+{
+    bool is_new;
+    struct ass_layout *lay = ass_layout_cache_get(ap->layout_cache, c, &is_new);
+    struct strbuf prefix;
+
+    if (!is_new)
+        return lay;
+
+    cuepos_apply_cue_settings(c, &lay->box);
+    ass_pos_line_in_box(c, &lay->box, &lay->pos);
+
+    strbuf_init(&prefix);
+    strbuf_append_lit(&prefix, "{\\an");
+    strbuf_append_int(&prefix, lay->pos.align);
+    strbuf_append_lit(&prefix, "\\fs");
+    strbuf_append_int(&prefix, lay->pos.fs);
+    strbuf_append_lit(&prefix, "\\pos(");
+    strbuf_append_int(&prefix, lay->pos.posx);
+    strbuf_append_char(&prefix, ',');
+    strbuf_append_int(&prefix, lay->pos.posy);
+    strbuf_append_char(&prefix, ')');
+    ass_opt_tags_str(c, ap, &prefix);
+    lay->prefix_len = prefix.len;
+    lay->prefix = strbuf_steal(&prefix);
+    return lay;
 }
 
 static void ass_cue2ass(struct cue *c, struct ass_params *ap)
 {
-    char escaped_text[1024];
-    char tag_text[1024];
-    char tag2_text[128];
-    bool have_ruby = false;
-    struct ass_cue_pos pi = {0};
-    struct cuepos_box boxp = {0};
-    struct ass_style *style = ass_styles_get(ap->styles, "Default");
+    /* The rest of the layout can use c->text_node after this */
+    struct vtt_node *root = prs_cue_text_node(c);
+    struct strbuf escaped_text, text;
+    const struct ass_layout *lay = ass_cue_layout(c, ap);
+    struct ass_cue_pos pi = lay->pos;
+    struct ass_style *style = ap->def_style;
     struct ass_node anode = {
         .start_ms = c->time_start,
         .end_ms = c->time_end,
         .layer = 9,
         .style = style,
     };
-    int escaped_text_len, tag_text_len, tag2_text_len;
-    stack_init(style_stack, sizeof(struct ass_style), 30);
+    /* The default style, the root, and one for each level of tags, the stack does not use its 1st slot */
+    stack_init(style_stack, sizeof(struct ass_style), c->text_info.max_depth + 3);
     stack_push(&style_stack, style);
 
-    cuepos_apply_cue_settings(c, &boxp);
 #if DEBUGBOX == 1
     if (opts_ass_debug_boxes) {
         struct ass_cue_pos boxpos = {0};
-        ass_append_box(c, &boxpos, &boxp, "00FF00", ap);
+        ass_append_box(c, &boxpos, &lay->box, "00FF00", ap);
     }
 #endif
-    ass_pos_line_in_box(c, &boxp, &pi);
 
-    /* TODO: cont. here, add inline tags for classes here */
-    escaped_text_len = ass_text_collect_tags_and_escape(c->text_node, sizeof(escaped_text), escaped_text, &style_stack, &have_ruby, ap);
-    assert(escaped_text_len < sizeof(escaped_text));
-    if (have_ruby) {
+    if (c->text_info.has_ruby) {
         /* If it has ruby, use ruby text rendering */
         ass_ruby_write(c, &pi, ap);
         return;
     }
     /* If no ruby, use the normal rendering */
 
-    tag2_text_len = ass_opt_tags_str(c, ap, sizeof(tag2_text), tag2_text);
-    assert(tag2_text_len < sizeof(tag2_text));
-    tag_text_len = snprintf(tag_text, sizeof(tag_text), "{\\an%d\\fs%d\\pos(%d,%d)%s}", pi.align, pi.fs, pi.posx, pi.posy, tag2_text);
-    assert(tag_text_len < sizeof(tag_text));
+    /* TODO: cont. here, add inline tags for classes here */
+    strbuf_init(&escaped_text);
+    ass_text_collect_tags_and_escape(c, root, &escaped_text, &style_stack, ap);
+
+    strbuf_init(&text);
+    strbuf_reserve(&text, lay->prefix_len + escaped_text.len + 2);
+    strbuf_append(&text, lay->prefix, lay->prefix_len);
+    strbuf_append_char(&text, '}');
+    strbuf_append(&text, strbuf_data(&escaped_text), escaped_text.len);
+    strbuf_free(&escaped_text);
 
-    anode.text = malloc(tag_text_len + escaped_text_len + 1);
-    sprintf(anode.text, "%s%s", tag_text, escaped_text);
+    anode.text = strbuf_steal(&text);
 
-    dyna_append(ap->ass_nodes, &anode);
+    ass_node_vec_append(ap->ass_nodes, &anode);
 
 #if DEBUGBOX == 1
     if (opts_ass_debug_boxes) {
-        char text[1024];
-        char line[1024];
+        const char *text = c->text_info.plain;
+        char line[c->text_info.plain_len + 1];
         struct ass_cue_pos an7pos;
-        struct text_extents line_exts[64];
+        struct text_extents line_exts[c->text_info.lines];
         int line_ext_count = 0;
         struct text_extents full_ext;
 
-        ctxt_text(c->text_node, sizeof(text), text);
         const char *start = text;
         const char *end = strchr(text, '\n');
         while (end) {
@@ -567,15 +611,19 @@ static void ass_cue2ass(struct cue *c, struct ass_params *ap)
 
 }
 
-static void ass_write_ass_nodes(FILE *f, const struct dyna *ass_nodes)
+/* Takes the events of the cue from the cache, or lays it out and adds them to it */
+static void ass_cue2ass_cached(struct cue *c, struct ass_params *ap)
 {
-    for (int i = 0; i < ass_nodes->e_idx; i++) {
-        const struct ass_node *an = dyna_elem(ass_nodes, i);
+    int64_t first = ap->ass_nodes->count;
 
-        ass_write_dialog_prop(f, an);
-        fputs(an->text, f);
-        fputs("\n", f);
+    if (ap->cache == NULL) {
+        ass_cue2ass(c, ap);
+        return;
     }
+    if (ass_cache_get(ap->cache, c, ap))
+        return;
+    ass_cue2ass(c, ap);
+    ass_cache_put(ap->cache, c, ap, &ap->ass_nodes->data[first], ap->ass_nodes->count - first);
 }
 
 static void text_shadow_to_bord(const struct cue_style *cs, struct ass_style *st, struct ass_params *ap)
@@ -589,8 +637,10 @@ static void text_shadow_to_bord(const struct cue_style *cs, struct ass_style *st
 
     /* A lot simpler implementation for now.
      * Only take the 1st entry into consideration */
-    st->bord = abs(cs->text_shadow[0].xpos) + abs(cs->text_shadow[0].ypos);
-    st->bord_color = util_colorname_to_rgb(cs->text_shadow[0].color);
+    st->bord = fabsf(cs->text_shadow[0].x.value) + fabsf(cs->text_shadow[0].y.value);
+    /* Without a color, keep the current one */
+    if (cs->text_shadow[0].color_set)
+        st->bord_color = ass_style_css_to_rgb(cs->text_shadow[0].color);
 
     /* will get ignored, but w/e */
     st->bord_color_set = st->bord_set = true;
@@ -599,6 +649,7 @@ static void text_shadow_to_bord(const struct cue_style *cs, struct ass_style *st
 static void create_default_style(struct ass_params *ap)
 {
     struct ass_style *s = ass_styles_add(ap->styles, "Default");
+    ap->def_style = s;
     s->fontpath = strdup(ap->fontpath);
     s->fsp = 0;
     /* Rest can be zero */
@@ -614,9 +665,15 @@ static void create_default_style(struct ass_params *ap)
     }
 
     /* Otherwise, try select it from the vtt styles */
-    const struct cue_style *cs = cuestyle_get_by_selector(ap->cuestyles, "::cue()");
-    if (cs) {
-        text_shadow_to_bord(cs, s, ap);
+    /* The rules for the whole cue, like ::cue() */
+    const struct vtt_node root = { .type = VNODE_ROOT };
+    const struct cue_style *rules[CUESTYLE_MAX_MATCH];
+    int count = cuestyle_match(ap->cuestyles, NULL, &root, ARRSIZE(rules), rules);
+    /* The last one with a shadow wins */
+    while (count > 0 && rules[count - 1]->text_shadow_count == 0)
+        count--;
+    if (count > 0) {
+        text_shadow_to_bord(rules[count - 1], s, ap);
     } else {
         /* Set a default border size */
         s->bord_color = 0; /* black */
@@ -625,42 +682,347 @@ static void create_default_style(struct ass_params *ap)
 
 }
 
-int ass_write(struct dyna *cues, struct dyna *cstyles, const struct video_info *video_info, const char *fontpath, const char *fname)
+/* The events generated by a single cue, in the buffer of the worker that did it */
+struct ass_cue_span {
+    int worker;
+    int64_t first, count;
+};
+
+struct ass_par_ctx {
+    struct cue_vec *cues;
+    int64_t base; /* Index of the first cue of the current block */
+    /* Copies of the main ass_params, with a private ass_nodes for each worker */
+    struct ass_params *wap;
+    struct ass_cue_span *spans;
+};
+
+/* How many cues to lay out before merging the events, this bounds the size of the worker buffers */
+#define ASS_PAR_BLOCK 4096
+
+static void ass_par_cue2ass(void *arg, int worker, int64_t idx)
+{
+    struct ass_par_ctx *pc = arg;
+    struct ass_params *wap = &pc->wap[worker];
+    struct ass_cue_span *span = &pc->spans[idx];
+
+    span->worker = worker;
+    span->first = wap->ass_nodes->count;
+    ass_layout_cue(wap, &pc->cues->data[pc->base + idx]);
+    if (opts_drop_text)
+        prs_cue_drop_text_node(&pc->cues->data[pc->base + idx]);
+    span->count = wap->ass_nodes->count - span->first;
+}
+
+static void ass_par_exit(void *arg, int worker)
+{
+    /* Faces are per thread */
+    te_thread_dinit();
+    font_thread_dinit();
+}
+
+/* Lays out the cues on multiple threads, then appends the events to ap->ass_nodes
+ * in cue order, so the result is the same as doing it one by one */
+static void ass_cues2ass_parallel(struct cue_vec *cues, int jobs, struct ass_params *ap)
+{
+    struct ass_params wap[jobs];
+    struct thp_pool *pool;
+    struct ass_par_ctx pc = {
+        .cues = cues,
+        .wap = wap,
+        .spans = calloc(ASS_PAR_BLOCK, sizeof(*pc.spans)),
+    };
+    assert(pc.spans);
+
+    /* A worker lays out about its share of a block, and most cues are a single event */
+    int64_t per_worker = MIN(cues->count, ASS_PAR_BLOCK) / jobs + 64;
+
+    for (int i = 0; i < jobs; i++) {
+        ass_layout_params_create(ap, &wap[i]);
+        /* The text is moved into ap->ass_nodes, so no free fn here */
+        wap[i].ass_nodes = ass_node_vec_create(per_worker);
+    }
+
+    /* The threads are started once, so their faces and caches are kept between the blocks */
+    pool = thp_create(MIN(jobs, MAX(cues->count, 1)), ass_par_exit, &pc);
+    for (pc.base = 0; pc.base < cues->count; pc.base += ASS_PAR_BLOCK) {
+        int64_t count = cues->count - pc.base;
+        if (count > ASS_PAR_BLOCK)
+            count = ASS_PAR_BLOCK;
+
+        thp_run(pool, count, ass_par_cue2ass, &pc);
+
+        for (int64_t i = 0; i < count; i++) {
+            const struct cue *c = &cues->data[pc.base + i];
+            const struct ass_cue_span *span = &pc.spans[i];
+            const struct ass_node *events = &wap[span->worker].ass_nodes->data[span->first];
+
+            ass_write_advance(ap, c->time_start);
+            ass_node_vec_reserve(ap->ass_nodes, ap->ass_nodes->count + span->count);
+            memcpy(&ap->ass_nodes->data[ap->ass_nodes->count], events, span->count * sizeof(*events));
+            ap->ass_nodes->count += span->count;
+        }
+
+        for (int i = 0; i < jobs; i++)
+            wap[i].ass_nodes->count = 0;
+    }
+    thp_destroy(pool);
+
+    for (int i = 0; i < jobs; i++) {
+        ass_node_vec_destroy(wap[i].ass_nodes);
+        ass_layout_params_destroy(&wap[i], ap);
+    }
+    free(pc.spans);
+}
+
+int ass_write_begin(struct ass_params *ap, const struct cue_styles *cstyles, const struct video_info *video_info, const char *fontpath, const char *fname)
 {
-    struct ass_params ap = {
+    *ap = (struct ass_params){
         .fontpath = fontpath,
         .cuestyles = cstyles,
+        .watermark_ms = INT64_MIN,
+        .mem_max = (size_t)opts_ass_max_mem << 20,
     };
-    FILE *f = fopen(fname, "w");
-    if (f == NULL)
+    /* Read back if the events written so far have to be sorted again */
+    ap->f = fopen(fname, "w+");
+    if (ap->f == NULL)
         return -1;
 
     cuepos_set_video_info(video_info);
 
-    ap.styles = ass_styles_create();
-    create_default_style(&ap);
+    ap->styles = ass_styles_create();
+    create_default_style(ap);
+    ap->style_cache = ass_style_cache_create();
+    ap->layout_cache = ass_layout_cache_create();
+    if (opts_ass_cache_file)
+        ap->cache = ass_cache_open(opts_ass_cache_file, cstyles, video_info, fontpath);
 
-    ap.ass_nodes = dyna_create_size(sizeof(struct ass_node), 256);
-    dyna_set_free_fn(ap.ass_nodes, ass_node_free);
+    ap->ass_nodes = ass_node_vec_create(256);
 
-    for (int i = 0; i < cues->e_idx; i++) {
-        struct cue *c = dyna_elem(cues, i);
-        struct ass_node anode = {0};
+    ass_write_header(ap->f);
+    ass_write_styles(ap->f, ap);
+    ass_write_events_header(ap->f);
+    ap->events_off = ftell(ap->f);
+    return 0;
+}
+
+/* Writes out the events that start before until_ms, and drops them from the buffer */
+static void ass_write_flush(struct ass_params *ap, int64_t until_ms)
+{
+    struct ass_node_vec *nodes = ap->ass_nodes;
+    int64_t n = 0;
+
+    /* Only holds the events of the last few cues, and those are almost sorted */
+    ass_node_vec_sort_scratch(nodes, ass_node_compar, &ap->sort_scratch);
+    while (n < nodes->count && nodes->data[n].start_ms < until_ms)
+        n++;
+    if (n == 0)
+        return;
 
-        ass_cue2ass(c, &ap);
+    for (int64_t i = 0; i < n; i++) {
+        ass_write_line(ap->f, &nodes->data[i]);
+        ass_node_free(&nodes->data[i]);
     }
 
-    printf("Sorting lines...\n");
-    /* Maybe we could do an array of pointers here, like a view */
-    qsort(ap.ass_nodes->data, ap.ass_nodes->e_idx, ap.ass_nodes->e_size, ass_node_compar);
+    nodes->count -= n;
+    if (nodes->count > 0)
+        memmove(nodes->data, nodes->data + n, nodes->count * sizeof(*nodes->data));
+}
 
-    ass_write_header(f);
-    ass_write_styles(f, &ap);
-    ass_write_events_header(f);
-    ass_write_ass_nodes(f, ap.ass_nodes);
+/* Sorts the buffered events and moves them into a temporary file */
+static void ass_write_spill(struct ass_params *ap)
+{
+    if (ap->spill.runs == NULL)
+        ass_spill_init(&ap->spill);
+
+    ass_node_vec_sort_scratch(ap->ass_nodes, ass_node_compar, &ap->sort_scratch);
+    if (ass_spill_run(&ap->spill, ap->ass_nodes, ass_write_line) != 0) {
+        /* They are still sorted in memory, and merged with the runs at the end */
+        fprintf(stderr, "[Warning] Keeping the ass events in memory from now on\n");
+        ap->mem_max = 0;
+        return;
+    }
 
-    fclose(f);
-    dyna_destroy(ap.ass_nodes);
-    ass_styles_destroy(ap.styles);
-    return 0;
+    for (int64_t i = 0; i < ap->ass_nodes->count; i++)
+        ass_node_free(&ap->ass_nodes->data[i]);
+    ap->ass_nodes->count = 0;
+    ap->mem_idx = 0;
+    ap->mem_used = 0;
+}
+
+/* Counts the memory used by the newly added events, and spills if it goes over the limit */
+static void ass_write_check_mem(struct ass_params *ap)
+{
+    for (; ap->mem_idx < ap->ass_nodes->count; ap->mem_idx++) {
+        const struct ass_node *an = &ap->ass_nodes->data[ap->mem_idx];
+        ap->mem_used += sizeof(*an) + strlen(an->text) + 1;
+    }
+
+    if (ap->mem_max > 0 && ap->mem_used > ap->mem_max)
+        ass_write_spill(ap);
+}
+
+static bool ass_line_key(const char *line, int64_t *out_start_ms, int32_t *out_layer)
+{
+    int layer, h, m, s, cs;
+
+    if (sscanf(line, "Dialogue: %d,%d:%d:%d.%d,", &layer, &h, &m, &s, &cs) != 5)
+        return false;
+    *out_start_ms = (int64_t)h * H_IN_MS + m * M_IN_MS + s * S_IN_MS + cs * 10;
+    *out_layer = layer;
+    return true;
+}
+
+/* On the first cue that starts before the watermark. The events written so far are
+ * read back into the first sorted run, and every following event is kept until the end */
+static void ass_write_resort(struct ass_params *ap)
+{
+    long end = ftell(ap->f);
+
+    fprintf(stderr, "[Warning] Cues are not in time order, keeping every ass event until the end to sort them\n");
+    if (end > ap->events_off) {
+        ass_spill_init(&ap->spill);
+        if (fflush(ap->f) != 0 || fseek(ap->f, ap->events_off, SEEK_SET) != 0 ||
+                ass_spill_run_lines(&ap->spill, ap->f, end - ap->events_off, ass_line_key) != 0) {
+            /* Keep what is written, the rest is only sorted among itself */
+            fprintf(stderr, "[Warning] Some ass events will be out of order\n");
+            dyna_destroy(ap->spill.runs);
+            ap->spill.runs = NULL;
+            fseek(ap->f, end, SEEK_SET);
+            ap->out_of_order = true;
+            return;
+        }
+        if (fseek(ap->f, ap->events_off, SEEK_SET) != 0 || ftruncate(fileno(ap->f), ap->events_off) != 0) {
+            perror("Failed to truncate the ass output");
+            ap->failed = true;
+        }
+    }
+    ap->sort_all = true;
+}
+
+void ass_write_advance(struct ass_params *ap, int64_t start_ms)
+{
+    if (ap->sort_all) {
+        ass_write_check_mem(ap);
+        return;
+    }
+
+    if (start_ms < ap->watermark_ms) {
+        if (!ap->out_of_order)
+            ass_write_resort(ap);
+        if (ap->sort_all)
+            ass_write_check_mem(ap);
+        return;
+    }
+    if (start_ms == ap->watermark_ms)
+        return;
+
+    /* Every following cue starts at or after start_ms, so nothing can go before these anymore */
+    ass_write_flush(ap, start_ms);
+    ap->watermark_ms = start_ms;
+}
+
+void ass_write_cue(struct ass_params *ap, struct cue *c)
+{
+    ass_write_advance(ap, c->time_start);
+    ass_cue2ass_cached(c, ap);
+}
+
+void ass_layout_params_create(const struct ass_params *ap, struct ass_params *out)
+{
+    *out = (struct ass_params){
+        .fontpath = ap->fontpath,
+        .styles = ap->styles,
+        .def_style = ap->def_style,
+        .cuestyles = ap->cuestyles,
+        .cache = ap->cache,
+        .style_cache = ass_style_cache_create(),
+        .layout_cache = ass_layout_cache_create(),
+    };
+}
+
+void ass_layout_params_destroy(struct ass_params *lp, const struct ass_params *ap)
+{
+    ass_style_cache_destroy(lp->style_cache);
+    ass_layout_cache_add_stats(ap->layout_cache, lp->layout_cache);
+    ass_layout_cache_destroy(lp->layout_cache);
+}
+
+void ass_layout_cue(struct ass_params *lp, struct cue *c)
+{
+    ass_cue2ass_cached(c, lp);
+}
+
+int ass_write_end(struct ass_params *ap)
+{
+    if (ap->spill.runs) {
+        /* The rest is the last run, merged from memory */
+        ass_node_vec_sort_scratch(ap->ass_nodes, ass_node_compar, &ap->sort_scratch);
+        printf("Merging %ld sorted runs...\n", ap->spill.runs->e_idx + 1);
+        if (ass_spill_merge(&ap->spill, ap->ass_nodes, ass_write_line, ap->f) != 0)
+            ap->failed = true;
+        for (int64_t i = 0; i < ap->ass_nodes->count; i++)
+            ass_node_free(&ap->ass_nodes->data[i]);
+        ap->ass_nodes->count = 0;
+    } else {
+        ass_write_flush(ap, INT64_MAX);
+    }
+
+    struct ass_layout_cache *lc = ap->layout_cache;
+    if (lc->hits + lc->misses > 0) {
+        printf("Layout cache: %ld hits, %ld misses (%.1f%% hit rate)\n",
+                lc->hits, lc->misses, 100.0 * lc->hits / (lc->hits + lc->misses));
+    }
+
+    if (ap->cache && ass_cache_close(ap->cache) != 0)
+        fprintf(stderr, "[Warning] The cue cache could not be saved\n");
+
+    /* A full disk can show up only when the rest is flushed by fclose() */
+    bool write_err = ferror(ap->f);
+    if (fclose(ap->f) != 0 || write_err) {
+        perror("Failed to write the ass file");
+        ap->failed = true;
+    }
+    /* Everything was written and freed above */
+    ass_node_vec_destroy(ap->ass_nodes);
+    vec_scratch_free(&ap->sort_scratch);
+    ass_style_cache_destroy(ap->style_cache);
+    ass_layout_cache_destroy(ap->layout_cache);
+    ass_styles_destroy(ap->styles);
+    return ap->failed ? -1 : 0;
+}
+
+int ass_write(struct cue_vec *cues, const struct cue_styles *cstyles, const struct video_info *video_info, const char *fontpath, const char *fname)
+{
+    int jobs = opts_ass_jobs;
+    struct ass_params ap;
+
+    if (ass_write_begin(&ap, cstyles, video_info, fontpath, fname) != 0)
+        return -1;
+
+    /* All of the cues are here, so unordered input can still be fully sorted */
+    for (int64_t i = 1; i < cues->count; i++) {
+        if (cues->data[i].time_start < cues->data[i - 1].time_start) {
+            ap.sort_all = true;
+            break;
+        }
+    }
+
+    /* Every event is kept until the end, and there is at least one for each cue */
+    if (ap.sort_all && ap.mem_max == 0)
+        ass_node_vec_reserve(ap.ass_nodes, cues->count);
+
+    if (jobs == 0)
+        jobs = thp_cpu_count();
+
+    if (jobs > 1 && cues->count > 1) {
+        ass_cues2ass_parallel(cues, jobs, &ap);
+    } else {
+        for (int64_t i = 0; i < cues->count; i++) {
+            ass_write_cue(&ap, &cues->data[i]);
+            if (opts_drop_text)
+                prs_cue_drop_text_node(&cues->data[i]);
+        }
+    }
+
+    return ass_write_end(&ap);
 }
@@ -3,9 +3,14 @@
 #include "parser.h"
 #include "cuepos.h"
 #include "dyna.h"
+#include "vec.h"
 #include "ass_style.h"
 #include "cuestyle.h"
 #include "stack.h"
+#include "strbuf.h"
+
+#include <stdio.h>
+#include <stdbool.h>
 
 #define IS_ASS_ALIGN_LEFT(al) (al == 1 || al == 4 || al == 7)
 #define IS_ASS_ALIGN_RIGHT(al) (al == 3 || al == 6 || al == 9)
@@ -16,10 +21,12 @@ struct ass_node {
     char *text; /* Free */
     int layer;
     int64_t start_ms, end_ms;
-    struct ass_style *style; /* Can be NULL, pointer into the styles dyna */
+    struct ass_style *style; /* Can be NULL, pointer into the styles table */
     //const char *style; /* Can be NULL */
 };
 
+VEC_DEFINE(ass_node_vec, struct ass_node)
+
 struct ass_cue_pos {
     int align; /* numpad style ass align */
     int logical_align; /* The align for internal calculations (only for vertical text) */
@@ -30,20 +37,71 @@ struct ass_cue_pos {
     //int width, height;
 };
 
+/* Sorted runs of events, stored in temporary files */
+struct ass_spill {
+    struct dyna *runs; /* Of the runs, NULL if nothing was spilled */
+    bool failed; /* Merging some runs failed, their events are lost */
+};
+
+struct ass_layout_cache;
+struct ass_cache;
+
 struct ass_params {
+    FILE *f;
     const char *fontpath;
-    struct dyna *ass_nodes, *styles;
-    struct dyna *cuestyles;
+    struct ass_node_vec *ass_nodes; /* Only holds the events not written yet */
+    struct ass_styles *styles;
+    struct ass_style *def_style; /* The "Default" style, so it is not looked up for every cue */
+    struct ass_style_cache *style_cache; /* Each layout thread has its own */
+    struct ass_layout_cache *layout_cache; /* Same */
+    const struct cue_styles *cuestyles;
+    struct ass_cache *cache; /* The events of the cues from earlier runs, NULL if not used */
+    int64_t watermark_ms; /* Start time of the latest cue, every earlier event is written already */
+    bool out_of_order; /* Warned about a cue that started before the watermark */
+    long events_off; /* Where the events start in f */
+
+    /* The cues are not in time order, so every event is kept until the end.
+     * If they need more than mem_max bytes, they are spilled to disk as sorted runs.
+     * Set from the start by ass_write(), or on the first cue before the watermark */
+    bool sort_all;
+    size_t mem_used, mem_max; /* mem_max is 0 for no limit */
+    int64_t mem_idx; /* ass_nodes before this are counted in mem_used */
+    struct ass_spill spill;
+    struct vec_scratch sort_scratch; /* For sorting ass_nodes, that is done for every cue */
+    bool failed;
 };
 
-int ass_write(struct dyna *cues, struct dyna *cstyles, const struct video_info *video_info, const char *fontpath, const char *fname);
+int ass_write(struct cue_vec *cues, const struct cue_styles *cstyles, const struct video_info *video_info, const char *fontpath, const char *fname);
+
+/* Writing one cue at a time, this is what ass_write() does */
+/* Opens the file, creates the styles and writes everything before the events */
+int ass_write_begin(struct ass_params *ap, const struct cue_styles *cstyles, const struct video_info *video_info, const char *fontpath, const char *fname);
+/* Lays out the cue, and appends the generated events to ap->ass_nodes */
+void ass_write_cue(struct ass_params *ap, struct cue *c);
+/* Call before appending the events of a cue that starts at start_ms to ap->ass_nodes.
+ * Writes out the buffered events that start before it, ass_write_cue() does this itself */
+void ass_write_advance(struct ass_params *ap, int64_t start_ms);
+/* Writes the remaining events, then frees everything in ap */
+int ass_write_end(struct ass_params *ap);
+
+/* Fills out with what another thread needs to lay out cues for ap: the font and the
+ * styles, with its own caches. Nothing of the output is in it, ass_nodes is left for
+ * the caller to set */
+void ass_layout_params_create(const struct ass_params *ap, struct ass_params *out);
+/* Frees the caches of lp, and adds its stats to the ones of ap */
+void ass_layout_params_destroy(struct ass_params *lp, const struct ass_params *ap);
+/* Lays out the cue, and appends the generated events to lp->ass_nodes, without writing anything */
+void ass_layout_cue(struct ass_params *lp, struct cue *c);
 
 void ass_append_box(const struct cue *c, const struct ass_cue_pos *an7pos,
         const struct cuepos_box *box, const char *color, struct ass_params *ap);
 
-int style_to_inline_tags(const struct ass_style *style, int out_len, char out[out_len]);
+/* Appends the {} block of the ass override tags of style to out */
+void style_to_inline_tags(const struct ass_style *style, struct strbuf *out);
 
-void ass_node_to_style(const struct vtt_node *node, const struct ass_params *ap, struct ass_style *out);
+/* Pushes the style of node, computed from the style on the top of the stack */
+void ass_push_node_style(struct stack *style_stack, const struct cue *c, const struct vtt_node *node, const struct ass_params *ap);
+void ass_node_to_style(const struct cue *c, const struct vtt_node *node, const struct ass_params *ap, struct ass_style *out);
 void ass_push_style_stack(struct stack *style_stack, const struct ass_style *style);
 
 #endif /* _VTT2ASS_ASS_H */
@@ -0,0 +1,548 @@
+#include "ass_cache.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <assert.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "font.h"
+#include "opts.h"
+#include "ass_style.h"
+#include "util.h"
+#include "vec.h"
+
+/* Changes when the layout of the file or the hash changes */
+#define ACACHE_FORMAT 2
+#define ACACHE_MAGIC "V2ACACHE"
+
+struct acache_header {
+    char magic[8];
+    uint32_t format;
+    uint32_t nslots; /* A power of 2 */
+    uint64_t count; /* Number of records */
+    uint64_t size; /* Of the whole file */
+};
+
+/* The index, right after the header. Linear probing by hash */
+struct acache_slot {
+    uint64_t hash; /* Of the record key */
+    uint64_t off; /* Of the record from the start of the file, 0 for an empty slot */
+};
+
+/* The records are in the order they were last used in, the oldest first */
+
+/* A record is this, then the key, then nevents of struct acache_event each followed by its text.
+ * Nothing is aligned, so everything is read with memcpy() */
+struct acache_rec {
+    uint32_t size; /* The whole record, with this */
+    uint32_t key_len;
+    uint32_t nevents;
+};
+
+struct acache_event {
+    int64_t start_delta, end_delta; /* From the start and end of the cue */
+    int32_t layer;
+    int32_t style_id; /* -1 for no style */
+    uint32_t text_len;
+    uint32_t pad; /* So there are no uninitialized bytes written */
+};
+
+#define ACACHE_APPEND(sb, v) strbuf_append(sb, (const char*)&(v), sizeof(v))
+
+/* Every property of the rules, the selectors are hashed as they were written */
+static void acache_append_rules(struct strbuf *sb, const struct cue_styles *cstyles)
+{
+    for (int64_t i = 0; i < cstyles->rules->e_idx; i++) {
+        const struct cue_style *cs = dyna_elem(cstyles->rules, i);
+        int32_t vals[] = {
+            cs->ruby_position, cs->text_shadow_count,
+            cs->italic, cs->bold, cs->underline, cs->line_through,
+            cs->color_set, cs->background_color_set, cs->opacity_set,
+            cs->italic_set, cs->bold_set, cs->decoration_set,
+        };
+
+        strbuf_append(sb, cs->selector, strlen(cs->selector) + 1);
+        ACACHE_APPEND(sb, vals);
+        ACACHE_APPEND(sb, cs->color);
+        ACACHE_APPEND(sb, cs->background_color);
+        ACACHE_APPEND(sb, cs->opacity);
+        for (int j = 0; j < cs->text_shadow_count; j++) {
+            const struct css_shadow *sh = &cs->text_shadow[j];
+            const struct css_length *lens[] = { &sh->x, &sh->y, &sh->blur };
+            for (int k = 0; k < ARRSIZE(lens); k++) {
+                int32_t unit = lens[k]->unit;
+                ACACHE_APPEND(sb, lens[k]->value);
+                ACACHE_APPEND(sb, unit);
+            }
+            uint32_t color = sh->color_set ? sh->color : 0;
+            ACACHE_APPEND(sb, color);
+        }
+    }
+}
+
+static uint64_t acache_conv_hash(const struct cue_styles *cstyles, const struct video_info *vi, const char *fontpath)
+{
+    struct strbuf sb;
+    uint64_t font_hash = font_get_file_hash(fontpath);
+    int32_t vals[] = {
+        ASS_CACHE_TOOL_VERSION, vi->width, vi->height,
+        opts_ass_border_size, opts_ass_debug_boxes,
+    };
+    uint64_t h;
+
+    strbuf_init(&sb);
+    ACACHE_APPEND(&sb, vals);
+    ACACHE_APPEND(&sb, font_hash);
+    if (cstyles)
+        acache_append_rules(&sb, cstyles);
+    h = hmap_hash(strbuf_data(&sb), sb.len);
+    strbuf_free(&sb);
+    return h;
+}
+
+/* The key of the cue is everything in it that the events depend on, other than the times */
+static void acache_make_key(const struct ass_cache *ac, const struct cue *c, struct strbuf *key)
+{
+    uint8_t enums[] = {
+        c->snap_to_lines, c->line_align, c->pos_align, c->text_align,
+        c->writing_direction, c->base_direction,
+    };
+    const char *ident = (ac->key_ident && c->ident) ? c->ident : "";
+    const char *text = c->text ? c->text : "";
+
+    ACACHE_APPEND(key, ac->conv_hash);
+    ACACHE_APPEND(key, c->line);
+    ACACHE_APPEND(key, c->position);
+    ACACHE_APPEND(key, c->size);
+    ACACHE_APPEND(key, enums);
+    strbuf_append(key, ident, strlen(ident) + 1);
+    strbuf_append_str(key, text);
+}
+
+/* Returns the header of the record at off, or false if it does not fit in size bytes */
+static bool acache_rec_at(const uint8_t *base, size_t size, uint64_t off, struct acache_rec *out)
+{
+    if (off > size || size - off < sizeof(*out))
+        return false;
+    memcpy(out, base + off, sizeof(*out));
+    return out->size <= size - off && out->size >= sizeof(*out) && out->key_len <= out->size - sizeof(*out);
+}
+
+/* Appends the events of the record to ap->ass_nodes.
+ * Returns false, without appending anything, if the record is not valid */
+static bool acache_decode(const uint8_t *rec, const struct acache_rec *rh, const struct cue *c, const struct ass_params *ap)
+{
+    struct ass_node_vec *nodes = ap->ass_nodes;
+    int64_t first = nodes->count;
+    int64_t nstyles = ap->styles->list->e_idx;
+    size_t p = sizeof(*rh) + rh->key_len;
+
+    for (uint32_t i = 0; i < rh->nevents; i++) {
+        struct acache_event ev;
+        if (rh->size - p < sizeof(ev))
+            goto err;
+        memcpy(&ev, rec + p, sizeof(ev));
+        p += sizeof(ev);
+        if (rh->size - p < ev.text_len || ev.style_id < -1 || ev.style_id >= nstyles)
+            goto err;
+
+        struct ass_node an = {
+            .text = malloc(ev.text_len + 1),
+            .layer = ev.layer,
+            .start_ms = c->time_start + ev.start_delta,
+            .end_ms = c->time_end + ev.end_delta,
+            .style = ev.style_id == -1 ? NULL : ass_styles_at(ap->styles, ev.style_id),
+        };
+        assert(an.text);
+        memcpy(an.text, rec + p, ev.text_len);
+        an.text[ev.text_len] = '\0';
+        p += ev.text_len;
+        ass_node_vec_append(nodes, &an);
+    }
+    return true;
+
+err:
+    for (int64_t i = first; i < nodes->count; i++)
+        free(nodes->data[i].text);
+    nodes->count = first;
+    return false;
+}
+
+/* Returns the offset of the record with this key in the mapped file, or 0 if there is none.
+ * The slot of it is stored in out_slot */
+static uint64_t acache_map_find(const struct ass_cache *ac, const char *key, size_t key_len, uint64_t hash, uint32_t *out_slot)
+{
+    const uint8_t *slots;
+    uint32_t mask = ac->nslots - 1;
+
+    if (ac->map == NULL)
+        return 0;
+    slots = ac->map + sizeof(struct acache_header);
+
+    for (uint32_t n = 0, i = hash & mask; n < ac->nslots; n++, i = (i + 1) & mask) {
+        struct acache_slot s;
+        struct acache_rec rh;
+
+        memcpy(&s, slots + i * sizeof(s), sizeof(s));
+        if (s.off == 0)
+            return 0;
+        if (s.hash != hash || !acache_rec_at(ac->map, ac->map_size, s.off, &rh))
+            continue;
+        if (rh.key_len == key_len && memcmp(ac->map + s.off + sizeof(rh), key, key_len) == 0) {
+            *out_slot = i;
+            return s.off;
+        }
+    }
+    return 0;
+}
+
+bool ass_cache_get(struct ass_cache *ac, const struct cue *c, const struct ass_params *ap)
+{
+    struct strbuf key;
+    struct acache_rec rh;
+    uint32_t slot;
+    bool found = false;
+
+    strbuf_init(&key);
+    acache_make_key(ac, c, &key);
+
+    /* The file is never changed, only the records of this run need the lock */
+    uint64_t off = acache_map_find(ac, strbuf_data(&key), key.len, hmap_hash(strbuf_data(&key), key.len), &slot);
+    if (off && acache_rec_at(ac->map, ac->map_size, off, &rh))
+        found = acache_decode(ac->map + off, &rh, c, ap);
+    if (found)
+        atomic_store_explicit(&ac->used[slot], 1, memory_order_relaxed);
+
+    if (!found) {
+        pthread_mutex_lock(&ac->lock);
+        void **val = hmap_get(ac->pending_keys, strbuf_data(&key), key.len);
+        if (val) {
+            const uint8_t *rec = (const uint8_t*)strbuf_data(&ac->pending) + (intptr_t)*val - 1;
+            memcpy(&rh, rec, sizeof(rh));
+            found = acache_decode(rec, &rh, c, ap);
+        }
+        pthread_mutex_unlock(&ac->lock);
+    }
+
+    strbuf_free(&key);
+    atomic_fetch_add(found ? &ac->hits : &ac->misses, 1);
+    return found;
+}
+
+void ass_cache_put(struct ass_cache *ac, const struct cue *c, const struct ass_params *ap,
+        const struct ass_node *events, int64_t count)
+{
+    struct strbuf key, rec;
+    struct acache_rec rh = { .nevents = count };
+
+    strbuf_init(&key);
+    acache_make_key(ac, c, &key);
+    rh.key_len = key.len;
+
+    strbuf_init(&rec);
+    ACACHE_APPEND(&rec, rh);
+    strbuf_append(&rec, strbuf_data(&key), key.len);
+    for (int64_t i = 0; i < count; i++) {
+        const struct ass_node *an = &events[i];
+        struct acache_event ev = {
+            .start_delta = an->start_ms - c->time_start,
+            .end_delta = an->end_ms - c->time_end,
+            .layer = an->layer,
+            .style_id = an->style ? ass_styles_id(ap->styles, an->style->name) : -1,
+            .text_len = strlen(an->text),
+        };
+        ACACHE_APPEND(&rec, ev);
+        strbuf_append(&rec, an->text, ev.text_len);
+    }
+    rh.size = rec.len;
+    memcpy(strbuf_data(&rec), &rh, sizeof(rh));
+
+    pthread_mutex_lock(&ac->lock);
+    void **val = hmap_put(ac->pending_keys, strbuf_data(&key), key.len);
+    if (*val == NULL) {
+        /* Another thread could have added the same cue since our lookup */
+        *val = (void*)(intptr_t)(ac->pending.len + 1);
+        strbuf_append(&ac->pending, strbuf_data(&rec), rec.len);
+        ac->pending_count++;
+    }
+    pthread_mutex_unlock(&ac->lock);
+
+    strbuf_free(&key);
+    strbuf_free(&rec);
+}
+
+static struct ass_cache *acache_create(const char *path)
+{
+    struct ass_cache *ac = calloc(1, sizeof(*ac));
+
+    assert(ac);
+    ac->path = strdup(path);
+    pthread_mutex_init(&ac->lock, NULL);
+    strbuf_init(&ac->pending);
+    ac->pending_keys = hmap_create(256, HMAPFLAG_COPYKEY);
+    assert(ac->path && ac->pending_keys);
+    atomic_init(&ac->hits, 0);
+    atomic_init(&ac->misses, 0);
+    return ac;
+}
+
+/* Maps the file at ac->path. ac->map is left NULL if it is missing or not valid */
+static void acache_load(struct ass_cache *ac)
+{
+    struct acache_header hdr;
+    struct stat fs;
+    void *mm;
+    int fd;
+
+    fd = open(ac->path, O_RDONLY, 0);
+    if (fd == -1) {
+        if (errno != ENOENT)
+            perror("open() on cache file");
+        return;
+    }
+    if (fstat(fd, &fs) != 0 || fs.st_size < sizeof(hdr)) {
+        fprintf(stderr, "[Warning] Cache file '%s' is not valid, it will be replaced\n", ac->path);
+        close(fd);
+        return;
+    }
+    mm = mmap(NULL, fs.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mm == MAP_FAILED) {
+        perror("mmap() on cache file");
+        return;
+    }
+
+    memcpy(&hdr, mm, sizeof(hdr));
+    if (memcmp(hdr.magic, ACACHE_MAGIC, sizeof(hdr.magic)) != 0 || hdr.format != ACACHE_FORMAT ||
+            hdr.size != fs.st_size || hdr.nslots == 0 || (hdr.nslots & (hdr.nslots - 1)) != 0 ||
+            (fs.st_size - sizeof(hdr)) / sizeof(struct acache_slot) < hdr.nslots) {
+        fprintf(stderr, "[Warning] Cache file '%s' is not valid, it will be replaced\n", ac->path);
+        munmap(mm, fs.st_size);
+        return;
+    }
+
+    ac->map = mm;
+    ac->map_size = fs.st_size;
+    ac->nslots = hdr.nslots;
+    ac->count = hdr.count;
+    ac->used = calloc(hdr.nslots, sizeof(*ac->used));
+    assert(ac->used);
+}
+
+static void acache_free(struct ass_cache *ac)
+{
+    if (ac->map)
+        munmap((void*)ac->map, ac->map_size);
+    free(ac->used);
+    hmap_destroy(ac->pending_keys);
+    strbuf_free(&ac->pending);
+    pthread_mutex_destroy(&ac->lock);
+    free(ac->path);
+    free(ac);
+}
+
+struct ass_cache *ass_cache_open(const char *path, const struct cue_styles *cstyles,
+        const struct video_info *vi, const char *fontpath)
+{
+    struct ass_cache *ac = acache_create(path);
+
+    ac->conv_hash = acache_conv_hash(cstyles, vi, fontpath);
+    ac->key_ident = cstyles && cstyles->by_id->count > 0;
+    acache_load(ac);
+    return ac;
+}
+
+/* Returns the record in the i-th slot of the mapped file, or NULL if the slot is empty */
+static const uint8_t *acache_map_slot(const struct ass_cache *ac, uint32_t i, uint64_t *out_hash, uint32_t *out_size)
+{
+    struct acache_slot s;
+    struct acache_rec rh;
+
+    memcpy(&s, ac->map + sizeof(struct acache_header) + i * sizeof(s), sizeof(s));
+    if (s.off == 0 || !acache_rec_at(ac->map, ac->map_size, s.off, &rh))
+        return NULL;
+    *out_hash = s.hash;
+    *out_size = rh.size;
+    return ac->map + s.off;
+}
+
+static void acache_slot_insert(struct acache_slot *slots, uint32_t nslots, uint64_t hash, uint64_t off)
+{
+    uint32_t mask = nslots - 1;
+    uint32_t i = hash & mask;
+
+    while (slots[i].off != 0)
+        i = (i + 1) & mask;
+    slots[i] = (struct acache_slot){ .hash = hash, .off = off };
+}
+
+/* A record of the mapped file */
+struct acache_ref {
+    uint64_t off, hash;
+    uint32_t size;
+    bool used;
+};
+VEC_DEFINE(acache_ref_vec, struct acache_ref)
+
+static int acache_ref_compar(const void *a, const void *b)
+{
+    const struct acache_ref *ra = a, *rb = b;
+
+    /* The records used in this run become the newest ones */
+    if (ra->used != rb->used)
+        return ra->used - rb->used;
+    return (ra->off > rb->off) - (ra->off < rb->off);
+}
+
+/* The index is kept at most half full */
+static uint32_t acache_nslots(uint64_t count)
+{
+    uint32_t nslots = 16;
+
+    while (nslots < count * 2)
+        nslots *= 2;
+    return nslots;
+}
+
+/* Writes the records of the old file and the new ones to a temporary file,
+ * then moves it over the old one. If max_size is not 0, the oldest records
+ * of the old file are left out until it fits in max_size bytes.
+ * The header of the new file is stored in out_hdr, if it is not NULL */
+static int acache_write(struct ass_cache *ac, uint64_t max_size, struct acache_header *out_hdr)
+{
+    struct acache_header hdr = {
+        .magic = ACACHE_MAGIC,
+        .format = ACACHE_FORMAT,
+    };
+    const uint8_t *pending = (const uint8_t*)strbuf_data(&ac->pending);
+    struct acache_ref_vec refs;
+    const uint8_t *rec;
+    uint64_t recs_size = ac->pending.len, off;
+    uint32_t size;
+    int64_t first = 0;
+    char tmppath[strlen(ac->path) + 8];
+    FILE *f;
+    int fd;
+
+    acache_ref_vec_init(&refs);
+    for (uint32_t i = 0; ac->map && i < ac->nslots; i++) {
+        struct acache_ref ref;
+        if ((rec = acache_map_slot(ac, i, &ref.hash, &ref.size))) {
+            ref.off = rec - ac->map;
+            ref.used = atomic_load_explicit(&ac->used[i], memory_order_relaxed);
+            acache_ref_vec_append(&refs, &ref);
+            recs_size += ref.size;
+        }
+    }
+    acache_ref_vec_sort(&refs, acache_ref_compar);
+
+    hdr.count = refs.count + ac->pending_count;
+    hdr.nslots = acache_nslots(hdr.count);
+    while (max_size && first < refs.count && sizeof(hdr) + hdr.nslots * sizeof(struct acache_slot) + recs_size > max_size) {
+        recs_size -= refs.data[first++].size;
+        hdr.count--;
+        hdr.nslots = acache_nslots(hdr.count);
+    }
+
+    struct acache_slot *slots = calloc(hdr.nslots, sizeof(*slots));
+    assert(slots);
+
+    off = sizeof(hdr) + hdr.nslots * sizeof(*slots);
+    for (int64_t i = first; i < refs.count; i++) {
+        acache_slot_insert(slots, hdr.nslots, refs.data[i].hash, off);
+        off += refs.data[i].size;
+    }
+    for (size_t p = 0; p < ac->pending.len; p += size) {
+        struct acache_rec rh;
+        memcpy(&rh, pending + p, sizeof(rh));
+        size = rh.size;
+        acache_slot_insert(slots, hdr.nslots, hmap_hash(pending + p + sizeof(rh), rh.key_len), off);
+        off += size;
+    }
+    hdr.size = off;
+
+    snprintf(tmppath, sizeof(tmppath), "%s.XXXXXX", ac->path);
+    fd = mkstemp(tmppath);
+    if (fd == -1 || (f = fdopen(fd, "wb")) == NULL) {
+        perror("Failed to create the new cache file");
+        if (fd != -1) {
+            close(fd);
+            unlink(tmppath);
+        }
+        free(slots);
+        acache_ref_vec_release(&refs);
+        return -1;
+    }
+    fchmod(fd, 0644);
+
+    fwrite(&hdr, sizeof(hdr), 1, f);
+    fwrite(slots, sizeof(*slots), hdr.nslots, f);
+    /* Same order as above */
+    for (int64_t i = first; i < refs.count; i++)
+        fwrite(ac->map + refs.data[i].off, refs.data[i].size, 1, f);
+    fwrite(pending, ac->pending.len, 1, f);
+    free(slots);
+    acache_ref_vec_release(&refs);
+
+    if (fflush(f) != 0 || ferror(f) || fsync(fileno(f)) != 0) {
+        perror("Failed to write the cache file");
+        fclose(f);
+        unlink(tmppath);
+        return -1;
+    }
+    fclose(f);
+
+    /* Readers that have the old file open keep using it */
+    if (rename(tmppath, ac->path) != 0) {
+        perror("rename() on cache file");
+        unlink(tmppath);
+        return -1;
+    }
+    if (out_hdr)
+        *out_hdr = hdr;
+    return 0;
+}
+
+int ass_cache_close(struct ass_cache *ac)
+{
+    int r = 0;
+
+    printf("Cue cache: %ld hits, %ld misses\n", (long)atomic_load(&ac->hits), (long)atomic_load(&ac->misses));
+    if (ac->pending_count > 0)
+        r = acache_write(ac, 0, NULL);
+
+    acache_free(ac);
+    return r;
+}
+
+int ass_cache_tool(const char *path, int prune_mib)
+{
+    struct ass_cache *ac = acache_create(path);
+    struct acache_header hdr;
+    int r = 0;
+
+    acache_load(ac);
+    if (ac->map == NULL) {
+        printf("Cannot read cue cache file '%s'\n", path);
+        acache_free(ac);
+        return -1;
+    }
+
+    printf("Size: %zu bytes\n", ac->map_size);
+    printf("Records: %" PRIu64 "\n", ac->count);
+
+    if (prune_mib > 0) {
+        r = acache_write(ac, (uint64_t)prune_mib << 20, &hdr);
+        if (r == 0)
+            printf("Pruned to %" PRIu64 " bytes, %" PRIu64 " records\n", hdr.size, hdr.count);
+    }
+
+    acache_free(ac);
+    return r;
+}
@@ -0,0 +1,66 @@
+#ifndef _VTT2ASS_ASS_CACHE_H
+#define _VTT2ASS_ASS_CACHE_H
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "ass.h"
+#include "hmap.h"
+#include "strbuf.h"
+#include "cuestyle.h"
+#include "cuepos.h"
+
+/* Bump this when a change makes the generated events different, so older caches are not used */
+#define ASS_CACHE_TOOL_VERSION 1
+
+/* The events generated for cues, kept in a file between runs, and keyed by everything
+ * that they depend on, so a rerun on a slightly changed file only lays out the changed cues.
+ *
+ * The file is a header, a hash index, and the records. It is mapped read only, and it is
+ * only ever replaced as a whole with rename(), so readers never see a half written file.
+ * Only one writer should run at a time, of two concurrent writers the last one wins.
+ * When it is replaced, the records used in the run are moved after the others, so the
+ * oldest ones are at the start, and ass_cache_tool() drops those first */
+struct ass_cache {
+    char *path; /* free */
+    uint64_t conv_hash; /* Hash of everything that is the same for every cue of the conversion */
+    bool key_ident; /* The cue identifier is only in the key if there are rules for ids */
+
+    /* The mapped file, NULL if there was none, or it was not valid */
+    const uint8_t *map;
+    size_t map_size;
+    uint32_t nslots;
+    uint64_t count;
+    atomic_uchar *used; /* For each slot of the file, set when its record was used in this run */
+
+    /* The records added in this run, in the same format as in the file.
+     * The layout threads add to it, so these are only used with lock held */
+    pthread_mutex_t lock;
+    struct strbuf pending;
+    struct hmap *pending_keys; /* record key -> offset in pending + 1 */
+    uint64_t pending_count;
+
+    atomic_int_least64_t hits, misses;
+};
+
+/* A missing or invalid cache file is an empty cache, it is replaced on close.
+ * The records made with other styles, video size or font are not used */
+struct ass_cache *ass_cache_open(const char *path, const struct cue_styles *cstyles,
+        const struct video_info *vi, const char *fontpath);
+/* Writes the file with the new records, if there are any, then frees the cache.
+ * Returns -1 if the file could not be written */
+int ass_cache_close(struct ass_cache *ac);
+
+/* Appends the cached events of c to ap->ass_nodes. Returns false if it is not cached */
+bool ass_cache_get(struct ass_cache *ac, const struct cue *c, const struct ass_params *ap);
+/* Stores the count events that were generated for c */
+void ass_cache_put(struct ass_cache *ac, const struct cue *c, const struct ass_params *ap,
+        const struct ass_node *events, int64_t count);
+
+/* Prints what is in a cache file. If prune_mib is not 0, rewrites it without the oldest
+ * records that do not fit in prune_mib MiB. Returns -1 on error */
+int ass_cache_tool(const char *path, int prune_mib);
+
+#endif /* _VTT2ASS_ASS_CACHE_H */
@@ -0,0 +1,82 @@
+#include "ass_layout.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+
+#include "util.h"
+
+/* Every cue field that the layout is computed from. Zeroed before filling, so the padding
+ * bytes are the same, and the key can be hashed as bytes */
+struct ass_layout_key {
+    float line, position, size;
+    int lines;
+    uint8_t snap_to_lines;
+    uint8_t line_align, pos_align, text_align;
+    uint8_t writing_direction, base_direction;
+};
+
+static void ass_layout_key_init(struct ass_layout_key *key, const struct cue *c)
+{
+    memset(key, 0, sizeof(*key));
+    key->line = c->line;
+    key->position = c->position;
+    key->size = c->size;
+    key->lines = c->text_info.lines;
+    key->snap_to_lines = c->snap_to_lines;
+    key->line_align = c->line_align;
+    key->pos_align = c->pos_align;
+    key->text_align = c->text_align;
+    key->writing_direction = c->writing_direction;
+    key->base_direction = c->base_direction;
+}
+
+static void ass_layout_free(void *ptr)
+{
+    struct ass_layout *lay = ptr;
+    SAFE_FREE(lay->prefix);
+    free(lay);
+}
+
+struct ass_layout_cache *ass_layout_cache_create()
+{
+    struct ass_layout_cache *cache = calloc(1, sizeof(*cache));
+    assert(cache);
+
+    cache->map = hmap_create(16, HMAPFLAG_COPYKEY);
+    assert(cache->map);
+    hmap_set_free_fn(cache->map, ass_layout_free);
+    return cache;
+}
+
+void ass_layout_cache_destroy(struct ass_layout_cache *cache)
+{
+    hmap_destroy(cache->map);
+    free(cache);
+}
+
+struct ass_layout *ass_layout_cache_get(struct ass_layout_cache *cache, const struct cue *c, bool *out_new)
+{
+    struct ass_layout_key key;
+    ass_layout_key_init(&key, c);
+
+    void **val = hmap_put(cache->map, &key, sizeof(key));
+    if (*val) {
+        cache->hits++;
+        *out_new = false;
+        return *val;
+    }
+
+    cache->misses++;
+    *val = calloc(1, sizeof(struct ass_layout));
+    assert(*val);
+    *out_new = true;
+    return *val;
+}
+
+void ass_layout_cache_add_stats(struct ass_layout_cache *to, const struct ass_layout_cache *from)
+{
+    to->hits += from->hits;
+    to->misses += from->misses;
+}
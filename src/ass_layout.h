@@ -0,0 +1,35 @@
+#ifndef _VTT2ASS_ASS_LAYOUT_H
+#define _VTT2ASS_ASS_LAYOUT_H
+#include "hmap.h"
+#include "ass.h"
+#include "cuepos.h"
+
+#include <stdint.h>
+
+/* The placement of a cue, it only depends on the cue settings and the line count,
+ * the video size and the font are the same for the whole conversion */
+struct ass_layout {
+    struct cuepos_box box;
+    struct ass_cue_pos pos;
+    /* "{\anN\fsN\pos(x,y)" and the optional tags, without the closing '}'. free */
+    char *prefix;
+    size_t prefix_len;
+};
+
+/* Computed layouts by cue settings, most cues of a file share a few of them.
+ * Not thread safe, every layout thread needs its own */
+struct ass_layout_cache {
+    struct hmap *map; /* struct ass_layout_key -> struct ass_layout */
+    int64_t hits, misses;
+};
+
+struct ass_layout_cache *ass_layout_cache_create();
+void ass_layout_cache_destroy(struct ass_layout_cache *cache);
+
+/* Returns the layout of the settings of c. If it is not cached yet, sets *out_new
+ * to true, and the returned layout is zeroed and has to be filled by the caller */
+struct ass_layout *ass_layout_cache_get(struct ass_layout_cache *cache, const struct cue *c, bool *out_new);
+/* Adds the hit counts of from to to, for the stats */
+void ass_layout_cache_add_stats(struct ass_layout_cache *to, const struct ass_layout_cache *from);
+
+#endif /* _VTT2ASS_ASS_LAYOUT_H */
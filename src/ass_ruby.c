@@ -12,6 +12,7 @@
 #include "textextents.h"
 #include "ass.h"
 #include "opts.h"
+#include "strbuf.h"
 
 #define MAX_RUBY_IN_LINE 128
 
@@ -51,23 +52,20 @@ struct ass_parts {
 struct ass_ruby_params {
     /* The raw text of the current node
      * Ruby text not included */
-    char text[1024];
-    int text_len;
-    /* Text with inline tags */
-    char tags_text[4096];
-    int tags_text_len;
+    struct strbuf text;
 
     /* Each part contains a text part with, or without ruby. 
      * Newlines are always cause a part split */
-    struct ass_parts parts[MAX_RUBY_IN_LINE];
-    int parts_count;
+    struct ass_parts *parts;
+    int parts_count, parts_cap;
 
     /* Text extents of each individual line after justify resize */
-    struct text_extents line_ext[MAX_RUBY_IN_LINE];
-    int line_ext_count;
+    struct text_extents *line_ext;
+    int line_ext_count, line_ext_cap;
 
     int base_fs, ruby_fs;
     const struct ass_params *ap;
+    const struct cue *cue;
     const struct ass_cue_pos *olpos;
     struct te_obj base_te_obj;
 
@@ -77,6 +75,18 @@ struct ass_ruby_params {
     int current_line_off;
 };
 
+/* Grows the array at *arr to hold at least count elements */
+static void ass_ruby_grow(void **arr, int *cap, int count, size_t e_size)
+{
+    if (count <= *cap)
+        return;
+    *cap = *cap ? *cap * 2 : 16;
+    if (*cap < count)
+        *cap = count;
+    *arr = realloc(*arr, *cap * e_size);
+    assert(*arr);
+}
+
 static void ass_ruby_text_and_parts(const struct vtt_node *node, struct ass_ruby_params *arp)
 {
     if (node->type == VNODE_TIMESTAMP)
@@ -99,8 +109,7 @@ static void ass_ruby_text_and_parts(const struct vtt_node *node, struct ass_ruby
         for (;;) {
             /* Split lines into different parts */
             int line_len;
-            assert(arp->parts_count < ARRSIZE(arp->parts));
-            struct ass_parts *part = &arp->parts[arp->parts_count];
+            struct ass_parts *part;
 
             end = strchr(start, '\n');
             if (end)
@@ -111,18 +120,17 @@ static void ass_ruby_text_and_parts(const struct vtt_node *node, struct ass_ruby
             if (line_len == 0)
                 goto next; /* skip empty text */
 
-            arp->parts_count++;
+            ass_ruby_grow((void**)&arp->parts, &arp->parts_cap, arp->parts_count + 1, sizeof(*arp->parts));
+            part = &arp->parts[arp->parts_count++];
             memset(part, 0, sizeof(*part));
-            part->start_off = arp->text_len;
+            part->start_off = arp->text.len;
             part->len = line_len;
             part->is_ruby = node->parent && node->parent->type == VNODE_RUBY;
             part->line = arp->current_line_off;
             part->inline_tags = *(struct ass_style*)stack_top(arp->style_stack);
             //printf("Copied under: %d\n", part->inline_tags.ruby_under);
 
-            arp->text_len += snprintf(arp->text + arp->text_len,
-                    sizeof(arp->text) - arp->text_len, "%.*s", line_len, start);
-            assert(arp->text_len < sizeof(arp->text));
+            strbuf_append(&arp->text, start, line_len);
 
 next:
             if (end == NULL)
@@ -136,9 +144,7 @@ next:
     }
 
     /* These nodes (not timestamp and text) could signify styles */
-    struct ass_style nodestyle;
-    ass_node_to_style(node, arp->ap, &nodestyle);
-    ass_push_style_stack(arp->style_stack, &nodestyle);
+    ass_push_node_style(arp->style_stack, arp->cue, node, arp->ap);
     //printf("nodestyle ruby under: %d\n", nodestyle.ruby_under);
     //struct ass_style *tmps = (struct ass_style*)stack_top(arp->style_stack);
     //printf("stacktop ruby under: %d\n", tmps->ruby_under);
@@ -216,7 +222,7 @@ static void ass_ruby_calc_box(const struct cue *c, const struct ass_cue_pos *olp
 
 static void ass_ruby_calc_parts_extents(struct ass_ruby_params *arp)
 {
-    const struct ass_style *style = ass_styles_get(arp->ap->styles, "Default");
+    const struct ass_style *style = arp->ap->def_style;
     for (int i = 0; i < arp->parts_count; i++) {
         te_get_at(&arp->base_te_obj, arp->parts[i].start_off, arp->parts[i].len, style->fsp, &arp->parts[i].extents);
 
@@ -246,9 +252,9 @@ static void ass_ruby_mark_resize(struct ass_ruby_params *arp)
 static void ass_ruby_calc_line_exts(struct ass_ruby_params *arp)
 {
     int sum_w = 0, sum_h = 0, idx = 0;
+    /* There cannot be more lines than parts */
+    ass_ruby_grow((void**)&arp->line_ext, &arp->line_ext_cap, arp->parts_count, sizeof(*arp->line_ext));
     for (int i = 0; i < arp->parts_count; i++) {
-        assert(idx < ARRSIZE(arp->line_ext));
-
         const struct text_extents *calc_ext = &arp->parts[i].extents;
         if (arp->parts[i].resize) {
             /* Use the size of the ruby text, because this will be resized */
@@ -271,7 +277,6 @@ static void ass_ruby_calc_line_exts(struct ass_ruby_params *arp)
     }
 
     assert(sum_w && sum_h);
-    assert(idx < ARRSIZE(arp->line_ext));
     memset(&arp->line_ext[idx], 0, sizeof(arp->line_ext[idx]));
 
     arp->line_ext[idx].width = sum_w;
@@ -323,9 +328,8 @@ static void render_rubytext(const struct cue *c, struct ass_ruby_params *arp,
         int cursor_x, int cursor_y, struct ass_parts *part,
         const struct ass_cue_pos *an7pos, const struct text_extents *full_ext)
 {
-    char text[1024];
-    int text_len = 0;
-    struct ass_style *style = ass_styles_get(arp->ap->styles, "Default");
+    struct strbuf text;
+    struct ass_style *style = arp->ap->def_style;
     struct ass_node anode = {
         .layer = 4,
         .start_ms = c->time_start,
@@ -343,24 +347,26 @@ static void render_rubytext(const struct cue *c, struct ass_ruby_params *arp,
         y_off += part->extents.height;
     }
 
-    text_len += snprintf(text, sizeof(text),
-            "{\\an%d\\pos(%d,%d)\\fs%d",
-            align, an7pos->posx + cursor_x + x_off, an7pos->posy + cursor_y + y_off,
-            arp->ruby_fs);
-    assert(text_len < sizeof(text));
+    strbuf_init(&text);
+    strbuf_append_lit(&text, "{\\an");
+    strbuf_append_int(&text, align);
+    strbuf_append_lit(&text, "\\pos(");
+    strbuf_append_int(&text, an7pos->posx + cursor_x + x_off);
+    strbuf_append_char(&text, ',');
+    strbuf_append_int(&text, an7pos->posy + cursor_y + y_off);
+    strbuf_append_lit(&text, ")\\fs");
+    strbuf_append_int(&text, arp->ruby_fs);
 
     if (part->ruby.resize) {
-        text_len += snprintf(text + text_len, sizeof(text) - text_len,
-                "\\fsp%g", part->ruby.fsp + 0);
-        assert(text_len < sizeof(text));
+        strbuf_append_lit(&text, "\\fsp");
+        strbuf_append_float(&text, part->ruby.fsp + 0);
     }
 
-    text_len += snprintf(text + text_len, sizeof(text) - text_len,
-            "}%s", part->ruby.rubytext);
-    assert(text_len < sizeof(text));
+    strbuf_append_char(&text, '}');
+    strbuf_append_str(&text, part->ruby.rubytext);
 
-    anode.text = strdup(text);
-    dyna_append(arp->ap->ass_nodes, &anode);
+    anode.text = strbuf_steal(&text);
+    ass_node_vec_append(arp->ap->ass_nodes, &anode);
 
 #if DEBUG_RUBYBOX == 1
     if (opts_ass_debug_boxes) {
@@ -399,7 +405,7 @@ static void set_part_inline_tags(const struct cue *c, int cursor_x, int cursor_y
     mbstate_t mbstate = {0};
     float space;
     int space_cursor = 0;
-    struct ass_style *style = ass_styles_get(arp->ap->styles, "Default");
+    struct ass_style *style = arp->ap->def_style;
     struct ass_node anode = {
         .layer = 4,
         .start_ms = c->time_start,
@@ -452,7 +458,7 @@ static void set_part_inline_tags(const struct cue *c, int cursor_x, int cursor_y
 
 static void ass_ruby_render_parts(const struct cue *c, struct ass_ruby_params *arp)
 {
-    struct ass_style *style = ass_styles_get(arp->ap->styles, "Default");
+    struct ass_style *style = arp->ap->def_style;
     struct ass_node anode = {
         .layer = 4,
         .start_ms = c->time_start,
@@ -462,8 +468,7 @@ static void ass_ruby_render_parts(const struct cue *c, struct ass_ruby_params *a
     struct text_extents full_ext = {0};
     struct ass_cue_pos an7pos = {0};
     bool space_1st = false;
-    char text[1024 * 4];
-    int text_len = 0;
+    struct strbuf text;
     int line_height = arp->olpos->fs;
 
     /* Calculate the larger bounding box from the bounding box of each line */
@@ -484,8 +489,16 @@ static void ass_ruby_render_parts(const struct cue *c, struct ass_ruby_params *a
 #endif
 
     /* Set tags for the rest of the base line*/
-    text_len += sprintf(text, "{\\an%d\\pos(%d,%d)\\fs%d}",
-            arp->olpos->align, arp->olpos->posx, arp->olpos->posy, arp->olpos->fs);
+    strbuf_init(&text);
+    strbuf_append_lit(&text, "{\\an");
+    strbuf_append_int(&text, arp->olpos->align);
+    strbuf_append_lit(&text, "\\pos(");
+    strbuf_append_int(&text, arp->olpos->posx);
+    strbuf_append_char(&text, ',');
+    strbuf_append_int(&text, arp->olpos->posy);
+    strbuf_append_lit(&text, ")\\fs");
+    strbuf_append_int(&text, arp->olpos->fs);
+    strbuf_append_char(&text, '}');
 
     float x_offset_fact = 0.5f;
     if (IS_ASS_ALIGN_RIGHT(arp->olpos->align))
@@ -500,16 +513,14 @@ static void ass_ruby_render_parts(const struct cue *c, struct ass_ruby_params *a
 
         if (i > 0 && arp->parts[i - 1].line != part->line) {
             /* Line switch, append a \N */
-            text_len += snprintf(text + text_len, sizeof(text) - text_len,
-                    "%s", "\\N");
-            assert(text_len < sizeof(text));
+            strbuf_append_lit(&text, "\\N");
             cursor_x = 0;
             cursor_y += arp->line_ext[arp->parts[i - 1].line].height;
         }
 
         int last_char_off = part->len;
         if (part->has_last_char_fsp) {
-            const char *str = arp->text + part->start_off;
+            const char *str = strbuf_data(&arp->text) + part->start_off;
             for (int i = part->len - 1; i >= 0; i--) {
                 if (util_is_utf8_start(str[i])) {
                     last_char_off = i;
@@ -524,19 +535,20 @@ static void ass_ruby_render_parts(const struct cue *c, struct ass_ruby_params *a
         }
 
         /* Write inline tags for this part */
-        text_len += style_to_inline_tags(&part->inline_tags, sizeof(text) - text_len, text + text_len);
-        assert(text_len < sizeof(text));
+        style_to_inline_tags(&part->inline_tags, &text);
 
         /* Render fsp align + actual text */
-        const char *ps_start = arp->text + part->start_off;
-        text_len += snprintf(text + text_len, sizeof(text) - text_len,
-                "{\\fsp%g}%.*s", fsp, last_char_off, arp->text + part->start_off);
-        assert(text_len < sizeof(text));
+        const char *ps_start = strbuf_data(&arp->text) + part->start_off;
+        strbuf_append_lit(&text, "{\\fsp");
+        strbuf_append_float(&text, fsp);
+        strbuf_append_char(&text, '}');
+        strbuf_append(&text, ps_start, last_char_off);
 
         if (part->has_last_char_fsp) {
-            text_len += snprintf(text + text_len, sizeof(text) - text_len,
-                    "{\\fsp%g}%.*s", part->last_char_fsp, (int)(part->len - last_char_off), arp->text + part->start_off + last_char_off);
-            assert(text_len < sizeof(text));
+            strbuf_append_lit(&text, "{\\fsp");
+            strbuf_append_float(&text, part->last_char_fsp);
+            strbuf_append_char(&text, '}');
+            strbuf_append(&text, ps_start + last_char_off, part->len - last_char_off);
         }
 
         if (part->is_ruby) {
@@ -553,8 +565,8 @@ static void ass_ruby_render_parts(const struct cue *c, struct ass_ruby_params *a
         else
             cursor_x += part->extents.width;
     }
-    anode.text = strdup(text);
-    dyna_append(arp->ap->ass_nodes, &anode);
+    anode.text = strbuf_steal(&text);
+    ass_node_vec_append(arp->ap->ass_nodes, &anode);
 
 }
 
@@ -591,14 +603,14 @@ static void split_part_on_last_char(struct ass_ruby_params *arp, int part_idx)
 
 static void ass_ruby_align_resized(struct ass_ruby_params *arp)
 {
-    struct ass_style *style = ass_styles_get(arp->ap->styles, "Default");
+    struct ass_style *style = arp->ap->def_style;
     for (int i = 0; i < arp->parts_count; i++) {
         struct ass_parts *part = &arp->parts[i];
 
         if (part->resize) {
             /* Only do this if this is not the 1st part */
             bool outer_fsp = i > 0;
-            float fsp = calc_fsp_amount(arp->text + part->start_off, part->len, outer_fsp,
+            float fsp = calc_fsp_amount(strbuf_data(&arp->text) + part->start_off, part->len, outer_fsp,
                     style->fsp, &part->extents, &part->ruby.extents);
             part->fsp = fsp;
             if (outer_fsp) {
@@ -621,7 +633,7 @@ static void ass_ruby_align_resized(struct ass_ruby_params *arp)
 // TODO: this is wrong, should apply each inline tag separatly in redner_parts 
 static void fill_tags_text(const struct cue *c, struct ass_ruby_params *arp)
 {
-    struct ass_style *style = ass_styles_get(arp->ap->styles, "Default");
+    struct ass_style *style = arp->ap->def_style;
 
     stack_init(style_stack, sizeof(struct ass_style), 30);
     stack_push(&style_stack, style);
@@ -633,9 +645,10 @@ static void fill_tags_text(const struct cue *c, struct ass_ruby_params *arp)
 
 void ass_ruby_write(const struct cue *c, const struct ass_cue_pos *olpos, const struct ass_params *ap)
 {
-    struct ass_style *style = ass_styles_get(ap->styles, "Default");
+    struct ass_style *style = ap->def_style;
 
-    stack_init(style_stack, sizeof(struct ass_style), 30);
+    /* Same as in ass_cue2ass() */
+    stack_init(style_stack, sizeof(struct ass_style), c->text_info.max_depth + 3);
     stack_push(&style_stack, style);
     /* Struct to hold all info about the ruby rendering process,
      * because otherwise there are too many arguments to functions lol */
@@ -644,15 +657,17 @@ void ass_ruby_write(const struct cue *c, const struct ass_cue_pos *olpos, const
         .ruby_fs = (int)(olpos->fs * 0.55f),
         .olpos = olpos,
         .ap = ap,
+        .cue = c,
         .style_stack = &style_stack,
     };
+    strbuf_init(&arp.text);
 
     /* Copy the full raw text, and split the text into parts based on ruby and newlines
      * Fills: arp.text, arp.parts */
     ass_ruby_text_and_parts(c->text_node, &arp);
 
     /* Setup object for calculating text extents later */
-    te_create_obj(ap->fontpath, arp.text, arp.text_len, arp.base_fs, false, &arp.base_te_obj);
+    te_create_obj(ap->fontpath, strbuf_data(&arp.text), arp.text.len, arp.base_fs, false, &arp.base_te_obj);
 
     /* Calculate text extents for each part, as they are, without any resizing
      * Fills: arp.parts and .ruby .extents */
@@ -660,7 +675,7 @@ void ass_ruby_write(const struct cue *c, const struct ass_cue_pos *olpos, const
 
 #if 1
     for (int i = 0; i < arp.parts_count; i++) {
-        printf("Part: [%d%s] '%.*s'\n", arp.parts[i].line, (char*[]){"       ", " - RUBY"}[arp.parts[i].is_ruby], (int)arp.parts[i].len, arp.text + arp.parts[i].start_off);
+        printf("Part: [%d%s] '%.*s'\n", arp.parts[i].line, (char*[]){"       ", " - RUBY"}[arp.parts[i].is_ruby], (int)arp.parts[i].len, strbuf_data(&arp.text) + arp.parts[i].start_off);
         if (arp.parts[i].is_ruby) {
             printf("  ^\\- Ruby text: %s\n", arp.parts[i].ruby.rubytext);
         }
@@ -702,5 +717,8 @@ void ass_ruby_write(const struct cue *c, const struct ass_cue_pos *olpos, const
 #endif
     
     te_destroy_obj(&arp.base_te_obj);
+    strbuf_free(&arp.text);
+    free(arp.parts);
+    free(arp.line_ext);
 }
 
@@ -0,0 +1,275 @@
+#include "ass_spill.h"
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <assert.h>
+
+/* A record in a run file is the sort key, followed by the line terminated with a newline */
+struct spill_key {
+    int64_t start_ms;
+    int32_t layer;
+};
+
+/* How many runs are merged at once. When there are this many runs of the same level,
+ * they are merged into one of the next level, so only a few files are open at a time */
+#define SPILL_FAN_IN 32
+
+struct spill_run {
+    FILE *f;
+    int level;
+};
+
+/* The current head of a run while merging. Either a run file, or the
+ * events in memory, which are the latest run */
+struct spill_head {
+    FILE *f;
+    const struct ass_node *nodes;
+    int64_t node_idx, node_count;
+    int run;
+    struct spill_key key;
+    char *line;
+    size_t line_size;
+};
+
+static int spill_merge(struct spill_run *runs, int run_count, const struct ass_node_vec *nodes,
+        ass_spill_write_fn write_fn, FILE *f, bool keys);
+
+void ass_spill_init(struct ass_spill *sp)
+{
+    sp->runs = dyna_create(sizeof(struct spill_run));
+    assert(sp->runs);
+}
+
+/* Merges the last SPILL_FAN_IN runs while they are of the same level */
+static void spill_cascade(struct ass_spill *sp)
+{
+    for (;;) {
+        int64_t count = sp->runs->e_idx, first = count - SPILL_FAN_IN;
+        struct spill_run *runs = sp->runs->data;
+        struct spill_run merged = {0};
+
+        if (first < 0 || runs[first].level != runs[count - 1].level)
+            return;
+
+        merged.f = tmpfile();
+        merged.level = runs[first].level + 1;
+        if (merged.f == NULL || spill_merge(&runs[first], SPILL_FAN_IN, NULL, NULL, merged.f, true) != 0 ||
+                fflush(merged.f) != 0 || ferror(merged.f)) {
+            /* The runs are closed by now, if any of them could not be read, that is lost */
+            perror("Failed to merge ass event runs");
+            if (merged.f)
+                fclose(merged.f);
+            sp->runs->e_idx = first;
+            sp->failed = true;
+            return;
+        }
+        rewind(merged.f);
+        sp->runs->e_idx = first;
+        dyna_append(sp->runs, &merged);
+    }
+}
+
+int ass_spill_run(struct ass_spill *sp, const struct ass_node_vec *nodes, ass_spill_write_fn write_fn)
+{
+    struct spill_run run = {0};
+    FILE *f = tmpfile();
+    if (f == NULL) {
+        perror("Failed to create temporary file for ass events");
+        return -1;
+    }
+
+    for (int64_t i = 0; i < nodes->count; i++) {
+        const struct ass_node *an = &nodes->data[i];
+        struct spill_key key = {
+            .start_ms = an->start_ms,
+            .layer = an->layer,
+        };
+
+        fwrite(&key, sizeof(key), 1, f);
+        write_fn(f, an);
+    }
+
+    if (fflush(f) != 0 || ferror(f)) {
+        perror("Failed to write ass events to temporary file");
+        fclose(f);
+        return -1;
+    }
+    rewind(f);
+    run.f = f;
+    dyna_append(sp->runs, &run);
+    spill_cascade(sp);
+    return 0;
+}
+
+int ass_spill_run_lines(struct ass_spill *sp, FILE *in, int64_t size, ass_spill_key_fn key_fn)
+{
+    char *line = NULL;
+    size_t line_size = 0;
+    ssize_t len;
+    int r = 0;
+    FILE *f = tmpfile();
+    if (f == NULL) {
+        perror("Failed to create temporary file for ass events");
+        return -1;
+    }
+
+    while (size > 0 && (len = getline(&line, &line_size, in)) > 0) {
+        struct spill_key key = {0};
+
+        if (!key_fn(line, &key.start_ms, &key.layer)) {
+            fprintf(stderr, "Not a dialogue line in the written ass events: '%s'\n", line);
+            r = -1;
+            break;
+        }
+        fwrite(&key, sizeof(key), 1, f);
+        fwrite(line, 1, len, f);
+        size -= len;
+    }
+    free(line);
+
+    if (r == 0 && (size > 0 || ferror(in))) {
+        fprintf(stderr, "Failed to read back the written ass events\n");
+        r = -1;
+    }
+    if (r == 0 && (fflush(f) != 0 || ferror(f))) {
+        perror("Failed to write ass events to temporary file");
+        r = -1;
+    }
+    if (r != 0) {
+        fclose(f);
+        return -1;
+    }
+    rewind(f);
+    struct spill_run run = { .f = f };
+    dyna_append(sp->runs, &run);
+    return 0;
+}
+
+/* Reads the next record of the run, returns false at the end */
+static bool spill_head_next(struct spill_head *h)
+{
+    if (h->nodes) {
+        if (++h->node_idx >= h->node_count)
+            return false;
+        h->key = (struct spill_key){
+            .start_ms = h->nodes[h->node_idx].start_ms,
+            .layer = h->nodes[h->node_idx].layer,
+        };
+        return true;
+    }
+    if (fread(&h->key, sizeof(h->key), 1, h->f) != 1)
+        return false;
+    return getline(&h->line, &h->line_size, h->f) > 0;
+}
+
+/* Same order as the in memory sort, an earlier run has the earlier events on equal keys */
+static bool spill_head_less(const struct spill_head *a, const struct spill_head *b)
+{
+    if (a->key.start_ms != b->key.start_ms)
+        return a->key.start_ms < b->key.start_ms;
+    if (a->key.layer != b->key.layer)
+        return a->key.layer < b->key.layer;
+    return a->run < b->run;
+}
+
+static void spill_heap_down(struct spill_head *heap, int count, int i)
+{
+    for (;;) {
+        int min = i, l = 2 * i + 1, r = 2 * i + 2;
+
+        if (l < count && spill_head_less(&heap[l], &heap[min]))
+            min = l;
+        if (r < count && spill_head_less(&heap[r], &heap[min]))
+            min = r;
+        if (min == i)
+            return;
+
+        struct spill_head t = heap[i];
+        heap[i] = heap[min];
+        heap[min] = t;
+        i = min;
+    }
+}
+
+/* Called at the end of a run, returns -1 if the run could not be read fully */
+static int spill_head_close(struct spill_head *h)
+{
+    if (h->nodes)
+        return 0;
+
+    int r = ferror(h->f) ? -1 : 0;
+
+    if (r != 0)
+        fprintf(stderr, "Failed to read ass events from temporary file\n");
+    free(h->line);
+    fclose(h->f);
+    return r;
+}
+
+/* Merges the runs, then the nodes if not NULL, into f, then closes the runs.
+ * With keys, f is written as a run file */
+static int spill_merge(struct spill_run *runs, int run_count, const struct ass_node_vec *nodes,
+        ass_spill_write_fn write_fn, FILE *f, bool keys)
+{
+    int head_count = run_count + (nodes != NULL), count = 0, r = 0;
+    struct spill_head *heap = calloc(head_count, sizeof(*heap));
+    assert(heap);
+
+    for (int i = 0; i < head_count; i++) {
+        struct spill_head *h = &heap[count];
+        bool have;
+
+        h->run = i;
+        if (i < run_count) {
+            h->f = runs[i].f;
+            have = spill_head_next(h);
+        } else {
+            h->nodes = nodes->data;
+            h->node_count = nodes->count;
+            h->node_idx = -1;
+            have = spill_head_next(h);
+        }
+        if (have) {
+            count++;
+        } else {
+            if (spill_head_close(h) != 0)
+                r = -1;
+            *h = (struct spill_head){0};
+        }
+    }
+    for (int i = count / 2 - 1; i >= 0; i--)
+        spill_heap_down(heap, count, i);
+
+    while (count > 0) {
+        struct spill_head *h = &heap[0];
+
+        if (keys)
+            fwrite(&h->key, sizeof(h->key), 1, f);
+        if (h->nodes)
+            write_fn(f, &h->nodes[h->node_idx]);
+        else
+            fputs(h->line, f);
+
+        if (!spill_head_next(h)) {
+            if (spill_head_close(h) != 0)
+                r = -1;
+            heap[0] = heap[--count];
+        }
+        spill_heap_down(heap, count, 0);
+    }
+
+    free(heap);
+    return r;
+}
+
+int ass_spill_merge(struct ass_spill *sp, const struct ass_node_vec *nodes, ass_spill_write_fn write_fn, FILE *f)
+{
+    int r = spill_merge(sp->runs->data, sp->runs->e_idx, nodes, write_fn, f, false);
+
+    if (sp->failed)
+        r = -1;
+    dyna_destroy(sp->runs);
+    sp->runs = NULL;
+    return r;
+}
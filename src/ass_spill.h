@@ -0,0 +1,23 @@
+#ifndef _VTT2ASS_ASS_SPILL_H
+#define _VTT2ASS_ASS_SPILL_H
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "dyna.h"
+#include "ass.h"
+
+/* Writes the whole dialogue line of an event, with the newline */
+typedef void(*ass_spill_write_fn)(FILE *f, const struct ass_node *an);
+/* Reads the sort key of a dialogue line. Returns false if it is not one */
+typedef bool(*ass_spill_key_fn)(const char *line, int64_t *out_start_ms, int32_t *out_layer);
+
+void ass_spill_init(struct ass_spill *sp);
+/* Writes the already sorted nodes as a new run. Returns -1 on error */
+int ass_spill_run(struct ass_spill *sp, const struct ass_node_vec *nodes, ass_spill_write_fn write_fn);
+/* Reads size bytes of already sorted dialogue lines from in, as a new run. Returns -1 on error */
+int ass_spill_run_lines(struct ass_spill *sp, FILE *in, int64_t size, ass_spill_key_fn key_fn);
+/* Merges every run, then the sorted nodes as the last run, into f, in (start, layer, run)
+ * order, then closes the runs. Returns -1 on error */
+int ass_spill_merge(struct ass_spill *sp, const struct ass_node_vec *nodes, ass_spill_write_fn write_fn, FILE *f);
+
+#endif /* _VTT2ASS_ASS_SPILL_H */
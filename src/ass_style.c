@@ -4,6 +4,8 @@
 #include <stdlib.h>
 #include <byteswap.h>
 #include <stdio.h>
+#include <stdint.h>
+#include <assert.h>
 
 #include "util.h"
 
@@ -14,38 +16,119 @@ void ass_style_free(struct ass_style *s)
     //memset(style, 0, sizeof(*style));
 }
 
-struct dyna *ass_styles_create()
+struct ass_styles *ass_styles_create()
 {
-    struct dyna *styles = dyna_create_size_flags(sizeof(struct ass_style), 4, DYNAFLAG_HEAPCOPY);
-    dyna_set_free_fn(styles, (dyna_free_fn)ass_style_free);
+    struct ass_styles *styles = calloc(1, sizeof(*styles));
+    assert(styles);
+
+    styles->list = dyna_create_size_flags(sizeof(struct ass_style), 4, DYNAFLAG_HEAPCOPY);
+    dyna_set_free_fn(styles->list, (dyna_free_fn)ass_style_free);
+    /* The keys are the names in the styles */
+    styles->by_name = hmap_create(4, HMAPFLAG_NONE);
+    assert(styles->list && styles->by_name);
     return styles;
 }
 
-void ass_styles_destroy(struct dyna *ds)
+void ass_styles_destroy(struct ass_styles *styles)
+{
+    hmap_destroy(styles->by_name);
+    dyna_destroy(styles->list);
+    free(styles);
+}
+
+int ass_styles_id(const struct ass_styles *styles, const char *name)
 {
-    dyna_destroy(ds);
+    void **id = hmap_get_str(styles->by_name, name);
+    if (id == NULL)
+        return -1;
+    return (intptr_t)*id;
 }
 
-struct ass_style *ass_styles_get(const struct dyna *styles, const char *name)
+struct ass_style *ass_styles_at(const struct ass_styles *styles, int id)
 {
-    for (int i = 0; i < styles->e_idx; i++) {
-        struct ass_style *s = dyna_elem(styles, i);
-        if (strcmp(s->name, name) == 0)
-            return s;
-    }
-    return NULL;
+    return dyna_elem(styles->list, id);
 }
 
-struct ass_style *ass_styles_add(struct dyna *styles, const char *name)
+struct ass_style *ass_styles_get(const struct ass_styles *styles, const char *name)
 {
-    struct ass_style *s = dyna_emplace(styles);
+    int id = ass_styles_id(styles, name);
+    if (id == -1)
+        return NULL;
+    return ass_styles_at(styles, id);
+}
+
+struct ass_style *ass_styles_add(struct ass_styles *styles, const char *name)
+{
+    int id = styles->list->e_idx;
+    struct ass_style *s = dyna_emplace(styles->list);
+    void **val;
+
     memset(s, 0, sizeof(*s));
     s->name = strdup(name);
+
+    val = hmap_put_str(styles->by_name, s->name);
+    assert(*val == NULL && "Style is already in the table");
+    *val = (void*)(intptr_t)id;
     return s;
 }
 
+static void ass_cached_style_free(void *ptr)
+{
+    struct ass_cached_style *cs = ptr;
+    SAFE_FREE(cs->tags);
+}
+
+struct ass_style_cache *ass_style_cache_create()
+{
+    struct ass_style_cache *cache = calloc(1, sizeof(*cache));
+    assert(cache);
+
+    cache->map = hmap_create(64, HMAPFLAG_COPYKEY);
+    cache->entries = dyna_create_size_flags(sizeof(struct ass_cached_style), 64, DYNAFLAG_HEAPCOPY);
+    assert(cache->map && cache->entries);
+    dyna_set_free_fn(cache->entries, ass_cached_style_free);
+    return cache;
+}
+
+void ass_style_cache_destroy(struct ass_style_cache *cache)
+{
+    hmap_destroy(cache->map);
+    dyna_destroy(cache->entries);
+    free(cache);
+}
+
+struct ass_cached_style *ass_style_cache_get(const struct ass_style_cache *cache, const void *key, size_t key_len)
+{
+    void **val = hmap_get(cache->map, key, key_len);
+    if (val == NULL)
+        return NULL;
+    return *val;
+}
+
+const struct ass_cached_style *ass_style_cache_at(const struct ass_style_cache *cache, int cache_id)
+{
+    return dyna_elem(cache->entries, cache_id - 1);
+}
+
+struct ass_cached_style *ass_style_cache_add(struct ass_style_cache *cache, const void *key, size_t key_len,
+        const struct ass_style *style, const char *tags)
+{
+    struct ass_cached_style *cs = dyna_emplace(cache->entries);
+
+    cs->style = *style;
+    cs->style.cache_id = cache->entries->e_idx;
+    cs->tags = strdup(tags);
+    *hmap_put(cache->map, key, key_len) = cs;
+    return cs;
+}
+
 int ass_style_rgb_to_str(uint32_t rgb, char out[12])
 {
     uint32_t bgr = bswap_32(rgb);
     return snprintf(out, 12, "&H%08X", bgr);
 }
+
+uint32_t ass_style_css_to_rgb(uint32_t rgba)
+{
+    return (rgba & 0xFFFFFF00) | (0xFF - (rgba & 0xFF));
+}
@@ -1,6 +1,7 @@
 #ifndef _VTT2ASS_ASS_STYLE_H
 #define _VTT2ASS_ASS_STYLE_H
 #include "dyna.h"
+#include "hmap.h"
 
 #include <stdbool.h>
 #include <stdint.h>
@@ -32,15 +33,51 @@ struct ass_style {
 
     /* set fields for extra elements */
     bool ruby_under_set : 1;
+
+    /* Id in the computed style cache, 0 for a style from the styles table, -1 if not cached */
+    int cache_id;
+};
+
+/* A style computed for a node, from the style of its parent and the rules matching the node */
+struct ass_cached_style {
+    struct ass_style style; /* style.cache_id is the id of this */
+    char *tags; /* The inline tags of style. free */
+};
+
+/* Computed styles by (parent cache_id, node key), so repeated spans are resolved once.
+ * Not thread safe, every layout thread needs its own */
+struct ass_style_cache {
+    struct hmap *map; /* key -> struct ass_cached_style */
+    struct dyna *entries; /* struct ass_cached_style, heap copied, cache_id - 1 is the index */
+};
+
+/* The styles of a conversion, the id of a style is its index in list */
+struct ass_styles {
+    struct dyna *list; /* struct ass_style, heap copied, so the pointers stay valid */
+    struct hmap *by_name; /* name -> id */
 };
 
-struct dyna *ass_styles_create();
-void ass_styles_destroy(struct dyna *ds);
+struct ass_styles *ass_styles_create();
+void ass_styles_destroy(struct ass_styles *styles);
 void ass_style_free(struct ass_style *style);
 
-struct ass_style *ass_styles_get(const struct dyna *styles, const char *name);
-struct ass_style *ass_styles_add(struct dyna *styles, const char *name);
+/* Returns -1 if there is no style with this name */
+int ass_styles_id(const struct ass_styles *styles, const char *name);
+struct ass_style *ass_styles_at(const struct ass_styles *styles, int id);
+struct ass_style *ass_styles_get(const struct ass_styles *styles, const char *name);
+/* The name must not be in the table yet */
+struct ass_style *ass_styles_add(struct ass_styles *styles, const char *name);
+
+struct ass_style_cache *ass_style_cache_create();
+void ass_style_cache_destroy(struct ass_style_cache *cache);
+struct ass_cached_style *ass_style_cache_get(const struct ass_style_cache *cache, const void *key, size_t key_len);
+const struct ass_cached_style *ass_style_cache_at(const struct ass_style_cache *cache, int cache_id);
+/* Copies style and tags into a new entry, and sets its cache_id */
+struct ass_cached_style *ass_style_cache_add(struct ass_style_cache *cache, const void *key, size_t key_len,
+        const struct ass_style *style, const char *tags);
 
 int ass_style_rgb_to_str(uint32_t rgb, char out[12]);
+/* Converts a css 0xRRGGBBAA color, where an alpha of 0xFF is opaque, to rgb with ass transparency */
+uint32_t ass_style_css_to_rgb(uint32_t rgba);
 
 #endif /* _VTT2ASS_ASS_STYLE_H */
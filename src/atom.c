@@ -0,0 +1,89 @@
+#include "atom.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "hmap.h"
+
+/* The strings are in chunks that are never moved, each twice the size of the previous,
+ * so they can be read without the lock while others are added */
+#define ATOM_CHUNK0 64
+#define ATOM_MAX_CHUNKS 26
+
+static struct {
+    char **chunks[ATOM_MAX_CHUNKS]; /* The string of atom a is at index a - 1 */
+    uint32_t count;
+    struct hmap *by_str; /* string -> atom, the keys are owned by chunks */
+    pthread_mutex_t lock; /* Only for adding */
+} atoms;
+
+/* Returns where the string of index i is */
+static char **atom_slot(uint32_t i, bool alloc)
+{
+    int k = 31 - __builtin_clz(i / ATOM_CHUNK0 + 1);
+    uint32_t off = i - ATOM_CHUNK0 * ((1u << k) - 1);
+    char **chunk = __atomic_load_n(&atoms.chunks[k], __ATOMIC_ACQUIRE);
+
+    if (chunk == NULL) {
+        assert(alloc);
+        chunk = calloc((size_t)ATOM_CHUNK0 << k, sizeof(*chunk));
+        assert(chunk);
+        __atomic_store_n(&atoms.chunks[k], chunk, __ATOMIC_RELEASE);
+    }
+    return &chunk[off];
+}
+
+void atom_init(void)
+{
+    memset(atoms.chunks, 0, sizeof(atoms.chunks));
+    atoms.count = 0;
+    atoms.by_str = hmap_create(64, HMAPFLAG_NONE);
+    pthread_mutex_init(&atoms.lock, NULL);
+}
+
+void atom_dinit(void)
+{
+    hmap_destroy(atoms.by_str);
+    for (uint32_t i = 0; i < atoms.count; i++)
+        free(*atom_slot(i, false));
+    for (int k = 0; k < ATOM_MAX_CHUNKS; k++)
+        free(atoms.chunks[k]);
+    pthread_mutex_destroy(&atoms.lock);
+}
+
+atom_t atom_intern(const char *s, size_t len)
+{
+    void **val;
+    atom_t a;
+
+    pthread_mutex_lock(&atoms.lock);
+    val = hmap_get(atoms.by_str, s, len);
+    if (val) {
+        a = (intptr_t)*val;
+    } else {
+        char *str = strndup(s, len);
+        assert(str);
+        assert(atoms.count < ((1u << ATOM_MAX_CHUNKS) - 1) * ATOM_CHUNK0);
+        /* Published before the atom can be returned to anyone */
+        __atomic_store_n(atom_slot(atoms.count, true), str, __ATOMIC_RELEASE);
+        a = ++atoms.count;
+        *hmap_put(atoms.by_str, str, len) = (void*)(intptr_t)a;
+    }
+    pthread_mutex_unlock(&atoms.lock);
+    return a;
+}
+
+const char *atom_str(atom_t a)
+{
+    const char *str;
+
+    if (a == ATOM_NONE)
+        return "";
+    /* No lock, the slot of an atom is written once, before the atom exists */
+    str = __atomic_load_n(atom_slot(a - 1, false), __ATOMIC_ACQUIRE);
+    assert(str);
+    return str;
+}
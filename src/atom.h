@@ -0,0 +1,22 @@
+#ifndef _VTT2ASS_ATOM_H
+#define _VTT2ASS_ATOM_H
+#include <stddef.h>
+#include <stdint.h>
+
+/* An interned string, two atoms are equal if and only if their strings are.
+ * Class names and annotations come from a small vocabulary, so they
+ * are stored and compared as atoms instead of strings */
+typedef uint32_t atom_t;
+#define ATOM_NONE 0
+
+/* The table lives for the whole conversion */
+void atom_init(void);
+void atom_dinit(void);
+
+/* Thread safe. Returns the atom of the len bytes at s */
+atom_t atom_intern(const char *s, size_t len);
+#define atom_intern_str(s) atom_intern(s, strlen(s))
+/* Thread safe. The string stays valid until atom_dinit(), "" for ATOM_NONE */
+const char *atom_str(atom_t a);
+
+#endif /* _VTT2ASS_ATOM_H */
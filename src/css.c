@@ -0,0 +1,300 @@
+#include "css.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <math.h>
+
+#include "keywords.h"
+#include "css_color_table.h"
+
+void css_scan_init(struct css_scan *s, const char *value)
+{
+    s->p = value;
+    s->end = value + strlen(value);
+}
+
+void css_skip_ws(struct css_scan *s)
+{
+    while (s->p < s->end && isspace((unsigned char)*s->p))
+        s->p++;
+}
+
+bool css_at_end(struct css_scan *s)
+{
+    css_skip_ws(s);
+    if (s->end - s->p >= 10 && strncasecmp(s->p, "!important", 10) == 0) {
+        s->p += 10;
+        css_skip_ws(s);
+    }
+    return s->p == s->end;
+}
+
+static bool css_is_ident_char(char c)
+{
+    return isalnum((unsigned char)c) || c == '-' || c == '_' || (unsigned char)c >= 0x80;
+}
+
+bool css_parse_ident(struct css_scan *s, const char **out, int *out_len)
+{
+    const char *start;
+
+    css_skip_ws(s);
+    start = s->p;
+    if (s->p >= s->end || isdigit((unsigned char)*s->p) || !css_is_ident_char(*s->p))
+        return false;
+    while (s->p < s->end && css_is_ident_char(*s->p))
+        s->p++;
+
+    *out = start;
+    *out_len = s->p - start;
+    return true;
+}
+
+enum css_keyword css_parse_keyword(struct css_scan *s)
+{
+    const char *start = s->p, *ident;
+    int len;
+    enum css_keyword kw;
+
+    if (css_parse_ident(s, &ident, &len) && (kw = kw_css_lookup(ident, len)) != CKW_UNKNOWN)
+        return kw;
+    s->p = start;
+    return CKW_UNKNOWN;
+}
+
+bool css_parse_number(struct css_scan *s, float *out)
+{
+    char buff[32];
+    const char *start;
+    char *endp;
+    int len = 0;
+
+    css_skip_ws(s);
+    start = s->p;
+    /* Copy it out, because strtof needs a terminated string */
+    while (start + len < s->end && len < sizeof(buff) - 1 &&
+            (isdigit((unsigned char)start[len]) || strchr("+-.eE", start[len])))
+        len++;
+    memcpy(buff, start, len);
+    buff[len] = '\0';
+
+    *out = strtof(buff, &endp);
+    if (endp == buff)
+        return false;
+    s->p = start + (endp - buff);
+    return true;
+}
+
+bool css_parse_length(struct css_scan *s, struct css_length *out)
+{
+    const char *start = s->p;
+    float v;
+
+    if (!css_parse_number(s, &v))
+        return false;
+    out->value = v;
+
+    if (s->p < s->end && *s->p == '%') {
+        s->p++;
+        out->unit = CSS_UNIT_PERCENT;
+        return true;
+    }
+    /* The unit has to be right after the number */
+    if (s->p < s->end && !isspace((unsigned char)*s->p)) {
+        switch (css_parse_keyword(s)) {
+        case CKW_PX: out->unit = CSS_UNIT_PX; return true;
+        case CKW_EM: out->unit = CSS_UNIT_EM; return true;
+        case CKW_VW: out->unit = CSS_UNIT_VW; return true;
+        case CKW_VH: out->unit = CSS_UNIT_VH; return true;
+        default: break;
+        }
+    }
+
+    if (v == 0 && (s->p == s->end || !css_is_ident_char(*s->p))) {
+        out->unit = CSS_UNIT_NONE;
+        return true;
+    }
+    s->p = start;
+    return false;
+}
+
+static int css_hex(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    c |= 0x20;
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    return -1;
+}
+
+static bool css_parse_hex_color(struct css_scan *s, uint32_t *out)
+{
+    int digits[8], n = 0;
+    const char *p = s->p + 1;
+    uint32_t c = 0;
+
+    while (p < s->end && n < 8 && css_hex(*p) != -1)
+        digits[n++] = css_hex(*p++);
+    if (p < s->end && css_is_ident_char(*p))
+        return false;
+
+    if (n == 3 || n == 4) {
+        /* #rgb(a), each digit is doubled */
+        for (int i = 0; i < n; i++)
+            c = (c << 8) | (digits[i] * 0x11);
+    } else if (n == 6 || n == 8) {
+        for (int i = 0; i < n; i++)
+            c = (c << 4) | digits[i];
+    } else {
+        return false;
+    }
+    if (n == 3 || n == 6)
+        c = (c << 8) | 0xFF;
+
+    *out = c;
+    s->p = p;
+    return true;
+}
+
+/* A 0-255 channel as a number or percentage, or a 0-1 alpha as a number or percentage */
+static bool css_parse_channel(struct css_scan *s, bool alpha, int *out)
+{
+    float v;
+
+    if (!css_parse_number(s, &v))
+        return false;
+    if (s->p < s->end && *s->p == '%') {
+        s->p++;
+        v = v / 100.0f * 255.0f;
+    } else if (alpha) {
+        v *= 255.0f;
+    }
+
+    *out = (int)lroundf(fminf(fmaxf(v, 0.0f), 255.0f));
+    return true;
+}
+
+static bool css_parse_rgb_func(struct css_scan *s, uint32_t *out)
+{
+    int ch[4] = { 0, 0, 0, 255 };
+
+    for (int i = 0; i < 4; i++) {
+        if (i > 0) {
+            /* The arguments are separated by commas, or by spaces and a '/' before the alpha */
+            const char *prev = s->p;
+            css_skip_ws(s);
+            if (i == 3 && s->p < s->end && *s->p == ')')
+                break;
+            if (s->p < s->end && (*s->p == ',' || (i == 3 && *s->p == '/')))
+                s->p++;
+            else if (s->p == prev)
+                return false;
+        }
+        if (!css_parse_channel(s, i == 3, &ch[i]))
+            return false;
+    }
+
+    css_skip_ws(s);
+    if (s->p >= s->end || *s->p != ')')
+        return false;
+    s->p++;
+
+    *out = ((uint32_t)ch[0] << 24) | (ch[1] << 16) | (ch[2] << 8) | ch[3];
+    return true;
+}
+
+bool css_parse_color(struct css_scan *s, uint32_t *out)
+{
+    const char *start, *ident;
+    int len;
+    enum css_keyword kw;
+
+    css_skip_ws(s);
+    start = s->p;
+    if (s->p < s->end && *s->p == '#') {
+        if (css_parse_hex_color(s, out))
+            return true;
+        goto fail;
+    }
+
+    if (!css_parse_ident(s, &ident, &len))
+        goto fail;
+
+    if (s->p < s->end && *s->p == '(') {
+        s->p++;
+        kw = kw_css_lookup(ident, len);
+        if ((kw == CKW_RGB || kw == CKW_RGBA) && css_parse_rgb_func(s, out))
+            return true;
+        goto fail;
+    }
+
+    const struct css_color_entry *e = css_color_lookup(ident, len);
+    if (e) {
+        *out = e->val;
+        return true;
+    }
+
+fail:
+    s->p = start;
+    return false;
+}
+
+static bool css_parse_shadow(struct css_scan *s, struct css_shadow *out)
+{
+    struct css_length lens[3];
+    int len_count = 0;
+
+    memset(out, 0, sizeof(*out));
+
+    /* The color can be before or after the lengths */
+    for (;;) {
+        css_skip_ws(s);
+        if (s->p >= s->end || *s->p == ',' || *s->p == '!')
+            break;
+
+        if (len_count < 3 && css_parse_length(s, &lens[len_count])) {
+            len_count++;
+        } else if (!out->color_set && css_parse_color(s, &out->color)) {
+            out->color_set = true;
+        } else {
+            return false;
+        }
+    }
+
+    if (len_count < 2)
+        return false;
+    out->x = lens[0];
+    out->y = lens[1];
+    if (len_count == 3)
+        out->blur = lens[2];
+    return true;
+}
+
+int css_parse_shadows(struct css_scan *s, int max, struct css_shadow out[max])
+{
+    int count = 0;
+
+    if (css_parse_keyword(s) == CKW_NONE)
+        return css_at_end(s) ? 0 : -1;
+
+    for (;;) {
+        struct css_shadow shadow;
+
+        if (!css_parse_shadow(s, &shadow))
+            return -1;
+        /* Extra shadows are parsed, but not stored */
+        if (count < max)
+            out[count] = shadow;
+        count++;
+
+        if (css_at_end(s))
+            break;
+        if (*s->p != ',')
+            return -1;
+        s->p++;
+    }
+    return count < max ? count : max;
+}
@@ -0,0 +1,54 @@
+#ifndef _VTT2ASS_CSS_H
+#define _VTT2ASS_CSS_H
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "keywords.h"
+
+/* Colors are 0xRRGGBBAA, an alpha of 0xFF is opaque */
+
+enum css_unit {
+    CSS_UNIT_NONE = 0,
+    CSS_UNIT_PX,
+    CSS_UNIT_EM,
+    CSS_UNIT_PERCENT,
+    CSS_UNIT_VW,
+    CSS_UNIT_VH,
+};
+
+struct css_length {
+    float value;
+    enum css_unit unit;
+};
+
+struct css_shadow {
+    struct css_length x, y, blur;
+    uint32_t color;
+    bool color_set; /* If false, the text color is used */
+};
+
+/* A cursor over a declaration value, the value does not have to be NUL terminated */
+struct css_scan {
+    const char *p, *end;
+};
+
+void css_scan_init(struct css_scan *s, const char *value);
+void css_skip_ws(struct css_scan *s);
+/* True if only whitespace and an optional !important is left */
+bool css_at_end(struct css_scan *s);
+/* Reads an identifier, true if there was one */
+bool css_parse_ident(struct css_scan *s, const char **out, int *out_len);
+/* Reads an identifier that is a keyword, CKW_UNKNOWN if there is none */
+enum css_keyword css_parse_keyword(struct css_scan *s);
+
+/* On failure, these leave the cursor where it was */
+bool css_parse_number(struct css_scan *s, float *out);
+/* A number with a unit, a unitless 0 is also accepted */
+bool css_parse_length(struct css_scan *s, struct css_length *out);
+/* Named colors, #rgb, #rgba, #rrggbb, #rrggbbaa, rgb() and rgba() */
+bool css_parse_color(struct css_scan *s, uint32_t *out);
+/* A comma separated text-shadow list, or none.
+ * Returns the number of shadows, or -1 on error */
+int css_parse_shadows(struct css_scan *s, int max, struct css_shadow out[max]);
+
+#endif /* _VTT2ASS_CSS_H */
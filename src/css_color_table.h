@@ -0,0 +1,303 @@
+/* Generated by tools/gen_phash.py from tools/css_colors.txt, do not edit */
+#ifndef _VTT2ASS_CSS_COLOR_TABLE_H
+#define _VTT2ASS_CSS_COLOR_TABLE_H
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+
+struct css_color_entry {
+    const char *key; /* NULL for an empty slot */
+    uint8_t key_len;
+    uint32_t val;
+};
+
+static const uint32_t css_color_seeds[38] = {
+    11, 12, 1, 1, 2, 3, 1, 1,
+    6, 6, 2, 5, 7, 1, 7, 5,
+    1, 1, 2, 18, 3, 5, 5, 14,
+    10, 5, 1, 4, 9, 5, 1, 3,
+    1, 4, 5, 5, 3, 6,
+};
+
+static const struct css_color_entry css_color_table[256] = {
+    { "ivory", 5, 0xFFFFF0FF },
+    { NULL },
+    { "lightgrey", 9, 0xD3D3D3FF },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "magenta", 7, 0xFF00FFFF },
+    { "olivedrab", 9, 0x6B8E23FF },
+    { NULL },
+    { "oldlace", 7, 0xFDF5E6FF },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "white", 5, 0xFFFFFFFF },
+    { "aqua", 4, 0x00FFFFFF },
+    { NULL },
+    { "wheat", 5, 0xF5DEB3FF },
+    { NULL },
+    { NULL },
+    { "blue", 4, 0x0000FFFF },
+    { "lavenderblush", 13, 0xFFF0F5FF },
+    { "cornflowerblue", 14, 0x6495EDFF },
+    { "palegoldenrod", 13, 0xEEE8AAFF },
+    { "mediumblue", 10, 0x0000CDFF },
+    { "lightsteelblue", 14, 0xB0C4DEFF },
+    { NULL },
+    { NULL },
+    { "deepskyblue", 11, 0x00BFFFFF },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "aquamarine", 10, 0x7FFFD4FF },
+    { "lavender", 8, 0xE6E6FAFF },
+    { NULL },
+    { "bisque", 6, 0xFFE4C4FF },
+    { "palegreen", 9, 0x98FB98FF },
+    { NULL },
+    { "mediumorchid", 12, 0xBA55D3FF },
+    { NULL },
+    { "darkgrey", 8, 0xA9A9A9FF },
+    { NULL },
+    { "dodgerblue", 10, 0x1E90FFFF },
+    { "orchid", 6, 0xDA70D6FF },
+    { "green", 5, 0x008000FF },
+    { NULL },
+    { "black", 5, 0x000000FF },
+    { "goldenrod", 9, 0xDAA520FF },
+    { NULL },
+    { "sandybrown", 10, 0xF4A460FF },
+    { "olive", 5, 0x808000FF },
+    { NULL },
+    { "darkcyan", 8, 0x008B8BFF },
+    { "steelblue", 9, 0x4682B4FF },
+    { "mistyrose", 9, 0xFFE4E1FF },
+    { "lightslategrey", 14, 0x778899FF },
+    { "violet", 6, 0xEE82EEFF },
+    { "cadetblue", 9, 0x5F9EA0FF },
+    { NULL },
+    { "mediumturquoise", 15, 0x48D1CCFF },
+    { "coral", 5, 0xFF7F50FF },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "darksalmon", 10, 0xE9967AFF },
+    { NULL },
+    { "tan", 3, 0xD2B48CFF },
+    { "seashell", 8, 0xFFF5EEFF },
+    { "lightslategray", 14, 0x778899FF },
+    { "seagreen", 8, 0x2E8B57FF },
+    { "darkolivegreen", 14, 0x556B2FFF },
+    { NULL },
+    { "gainsboro", 9, 0xDCDCDCFF },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "tomato", 6, 0xFF6347FF },
+    { "salmon", 6, 0xFA8072FF },
+    { NULL },
+    { "brown", 5, 0xA52A2AFF },
+    { "blanchedalmond", 14, 0xFFEBCDFF },
+    { NULL },
+    { "ghostwhite", 10, 0xF8F8FFFF },
+    { "palevioletred", 13, 0xDB7093FF },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "mediumaquamarine", 16, 0x66CDAAFF },
+    { "yellow", 6, 0xFFFF00FF },
+    { NULL },
+    { "powderblue", 10, 0xB0E0E6FF },
+    { NULL },
+    { "darkorchid", 10, 0x9932CCFF },
+    { "darkviolet", 10, 0x9400D3FF },
+    { "mediumvioletred", 15, 0xC71585FF },
+    { "sienna", 6, 0xA0522DFF },
+    { "indianred", 9, 0xCD5C5CFF },
+    { "dimgrey", 7, 0x696969FF },
+    { NULL },
+    { "dimgray", 7, 0x696969FF },
+    { NULL },
+    { "royalblue", 9, 0x4169E1FF },
+    { NULL },
+    { "greenyellow", 11, 0xADFF2FFF },
+    { "lightcoral", 10, 0xF08080FF },
+    { "darkgoldenrod", 13, 0xB8860BFF },
+    { NULL },
+    { "darkseagreen", 12, 0x8FBC8FFF },
+    { "teal", 4, 0x008080FF },
+    { "orange", 6, 0xFFA500FF },
+    { "linen", 5, 0xFAF0E6FF },
+    { "aliceblue", 9, 0xF0F8FFFF },
+    { NULL },
+    { "thistle", 7, 0xD8BFD8FF },
+    { "darkslategray", 13, 0x2F4F4FFF },
+    { NULL },
+    { "firebrick", 9, 0xB22222FF },
+    { "darkturquoise", 13, 0x00CED1FF },
+    { "lightgray", 9, 0xD3D3D3FF },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "mediumslateblue", 15, 0x7B68EEFF },
+    { "limegreen", 9, 0x32CD32FF },
+    { NULL },
+    { "lightseagreen", 13, 0x20B2AAFF },
+    { "snow", 4, 0xFFFAFAFF },
+    { "darkslateblue", 13, 0x483D8BFF },
+    { "silver", 6, 0xC0C0C0FF },
+    { "cyan", 4, 0x00FFFFFF },
+    { "plum", 4, 0xDDA0DDFF },
+    { "darkgreen", 9, 0x006400FF },
+    { NULL },
+    { "gold", 4, 0xFFD700FF },
+    { NULL },
+    { NULL },
+    { "indigo", 6, 0x4B0082FF },
+    { NULL },
+    { "crimson", 7, 0xDC143CFF },
+    { "lightgreen", 10, 0x90EE90FF },
+    { "darkorange", 10, 0xFF8C00FF },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "antiquewhite", 12, 0xFAEBD7FF },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "slategray", 9, 0x708090FF },
+    { NULL },
+    { NULL },
+    { "maroon", 6, 0x800000FF },
+    { NULL },
+    { "chocolate", 9, 0xD2691EFF },
+    { NULL },
+    { "slateblue", 9, 0x6A5ACDFF },
+    { "purple", 6, 0x800080FF },
+    { NULL },
+    { NULL },
+    { "skyblue", 7, 0x87CEEBFF },
+    { NULL },
+    { "lightyellow", 11, 0xFFFFE0FF },
+    { "turquoise", 9, 0x40E0D0FF },
+    { NULL },
+    { NULL },
+    { "yellowgreen", 11, 0x9ACD32FF },
+    { "darkkhaki", 9, 0xBDB76BFF },
+    { NULL },
+    { "lightblue", 9, 0xADD8E6FF },
+    { "mediumspringgreen", 17, 0x00FA9AFF },
+    { "darkslategrey", 13, 0x2F4F4FFF },
+    { "springgreen", 11, 0x00FF7FFF },
+    { "fuchsia", 7, 0xFF00FFFF },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "mediumpurple", 12, 0x9370DBFF },
+    { NULL },
+    { "honeydew", 8, 0xF0FFF0FF },
+    { NULL },
+    { "lightcyan", 9, 0xE0FFFFFF },
+    { "orangered", 9, 0xFF4500FF },
+    { NULL },
+    { "darkblue", 8, 0x00008BFF },
+    { NULL },
+    { "paleturquoise", 13, 0xAFEEEEFF },
+    { "gray", 4, 0x808080FF },
+    { NULL },
+    { NULL },
+    { "darkgray", 8, 0xA9A9A9FF },
+    { "rebeccapurple", 13, 0x663399FF },
+    { NULL },
+    { NULL },
+    { "floralwhite", 11, 0xFFFAF0FF },
+    { "deeppink", 8, 0xFF1493FF },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "forestgreen", 11, 0x228B22FF },
+    { "lawngreen", 9, 0x7CFC00FF },
+    { "khaki", 5, 0xF0E68CFF },
+    { "cornsilk", 8, 0xFFF8DCFF },
+    { "hotpink", 7, 0xFF69B4FF },
+    { NULL },
+    { "azure", 5, 0xF0FFFFFF },
+    { "midnightblue", 12, 0x191970FF },
+    { "rosybrown", 9, 0xBC8F8FFF },
+    { "blueviolet", 10, 0x8A2BE2FF },
+    { "peru", 4, 0xCD853FFF },
+    { "lightsalmon", 11, 0xFFA07AFF },
+    { NULL },
+    { "burlywood", 9, 0xDEB887FF },
+    { NULL },
+    { "moccasin", 8, 0xFFE4B5FF },
+    { "lightgoldenrodyellow", 20, 0xFAFAD2FF },
+    { "mintcream", 9, 0xF5FFFAFF },
+    { "slategrey", 9, 0x708090FF },
+    { "whitesmoke", 10, 0xF5F5F5FF },
+    { "lightpink", 9, 0xFFB6C1FF },
+    { "navy", 4, 0x000080FF },
+    { NULL },
+    { "darkred", 7, 0x8B0000FF },
+    { "papayawhip", 10, 0xFFEFD5FF },
+    { NULL },
+    { "beige", 5, 0xF5F5DCFF },
+    { NULL },
+    { NULL },
+    { "navajowhite", 11, 0xFFDEADFF },
+    { "saddlebrown", 11, 0x8B4513FF },
+    { "grey", 4, 0x808080FF },
+    { NULL },
+    { "chartreuse", 10, 0x7FFF00FF },
+    { "lightskyblue", 12, 0x87CEFAFF },
+    { "lime", 4, 0x00FF00FF },
+    { "lemonchiffon", 12, 0xFFFACDFF },
+    { NULL },
+    { "peachpuff", 9, 0xFFDAB9FF },
+    { "pink", 4, 0xFFC0CBFF },
+    { "red", 3, 0xFF0000FF },
+    { NULL },
+    { "mediumseagreen", 14, 0x3CB371FF },
+    { "transparent", 11, 0x00000000 },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "darkmagenta", 11, 0x8B008BFF },
+};
+
+static inline uint32_t css_color_hash(const char *s, size_t len, uint32_t seed)
+{
+    uint32_t h = 0x811c9dc5u ^ seed;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t b = s[i];
+        h ^= b | ((b >= 'A' && b <= 'Z') ? 0x20 : 0);
+        h *= 0x01000193u;
+    }
+    return h ^ (h >> 16);
+}
+
+/* Returns the entry of the len bytes at s, or NULL if it is not a key */
+static inline const struct css_color_entry *css_color_lookup(const char *s, size_t len)
+{
+    uint32_t seed = css_color_seeds[css_color_hash(s, len, 0) % 38];
+    const struct css_color_entry *e = &css_color_table[css_color_hash(s, len, seed) % 256];
+    if (e->key == NULL || e->key_len != len || strncasecmp(e->key, s, len) != 0)
+        return NULL;
+    return e;
+}
+
+#endif /* _VTT2ASS_CSS_COLOR_TABLE_H */
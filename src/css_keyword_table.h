@@ -0,0 +1,75 @@
+/* Generated by tools/gen_phash.py from src/keywords.h CSS_KEYWORD_DEF, do not edit */
+#ifndef _VTT2ASS_CSS_KEYWORD_TABLE_H
+#define _VTT2ASS_CSS_KEYWORD_TABLE_H
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+
+struct css_keyword_entry {
+    const char *key; /* NULL for an empty slot */
+    uint8_t key_len;
+    enum css_keyword val;
+};
+
+static const uint32_t css_keyword_seeds[8] = {
+    278, 10, 5, 92, 1, 9, 49, 361,
+};
+
+static const struct css_keyword_entry css_keyword_table[32] = {
+    { "vw", 2, CKW_VW },
+    { "font-style", 10, CKW_FONT_STYLE },
+    { "background", 10, CKW_BACKGROUND },
+    { "em", 2, CKW_EM },
+    { "normal", 6, CKW_NORMAL },
+    { "ruby-position", 13, CKW_RUBY_POSITION },
+    { "px", 2, CKW_PX },
+    { "background-color", 16, CKW_BACKGROUND_COLOR },
+    { "rgb", 3, CKW_RGB },
+    { "over", 4, CKW_OVER },
+    { "text-shadow", 11, CKW_TEXT_SHADOW },
+    { "text-decoration-line", 20, CKW_TEXT_DECORATION_LINE },
+    { "vh", 2, CKW_VH },
+    { "underline", 9, CKW_UNDERLINE },
+    { "italic", 6, CKW_ITALIC },
+    { NULL },
+    { NULL },
+    { "deg", 3, CKW_DEG },
+    { "lighter", 7, CKW_LIGHTER },
+    { "bolder", 6, CKW_BOLDER },
+    { "text-decoration", 15, CKW_TEXT_DECORATION },
+    { "font-weight", 11, CKW_FONT_WEIGHT },
+    { "under", 5, CKW_UNDER },
+    { "none", 4, CKW_NONE },
+    { "opacity", 7, CKW_OPACITY },
+    { "bold", 4, CKW_BOLD },
+    { "oblique", 7, CKW_OBLIQUE },
+    { "alternate", 9, CKW_ALTERNATE },
+    { "x-ttml-shear", 12, CKW_X_TTML_SHEAR },
+    { "color", 5, CKW_COLOR },
+    { "rgba", 4, CKW_RGBA },
+    { "line-through", 12, CKW_LINE_THROUGH },
+};
+
+static inline uint32_t css_keyword_hash(const char *s, size_t len, uint32_t seed)
+{
+    uint32_t h = 0x811c9dc5u ^ seed;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t b = s[i];
+        h ^= b | ((b >= 'A' && b <= 'Z') ? 0x20 : 0);
+        h *= 0x01000193u;
+    }
+    return h ^ (h >> 16);
+}
+
+/* Returns the entry of the len bytes at s, or NULL if it is not a key */
+static inline const struct css_keyword_entry *css_keyword_lookup(const char *s, size_t len)
+{
+    uint32_t seed = css_keyword_seeds[css_keyword_hash(s, len, 0) % 8];
+    const struct css_keyword_entry *e = &css_keyword_table[css_keyword_hash(s, len, seed) % 32];
+    if (e->key == NULL || e->key_len != len || strncasecmp(e->key, s, len) != 0)
+        return NULL;
+    return e;
+}
+
+#endif /* _VTT2ASS_CSS_KEYWORD_TABLE_H */
@@ -2,73 +2,264 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
-#include <regex.h>
 #include <assert.h>
 
 #include "tokenizer.h"
+#include "keywords.h"
 #include "util.h"
 
 static void cuestyle_free(void *data)
 {
     struct cue_style *cs = data;
     SAFE_FREE(cs->selector);
+    SAFE_FREE(cs->sel.id);
+    if (cs->sel.classes)
+        dyna_destroy(cs->sel.classes);
 }
 
-static void parse_text_shadow(const char *val, struct cue_style *cs)
+/* Length of the type, class or id name at str */
+static int selector_name_len(const char *str)
 {
-    regex_t reg;
-    regmatch_t regm[12];
-    int xpos, ypos;
-    char color[24];
-    int consumed;
-    int r, shad_count;
-    size_t val_off = 0;
+    int len = 0;
+    while (str[len] && strchr(".#()[]:*, \t>+~", str[len]) == NULL)
+        len++;
+    return len;
+}
+
+/* Parses ::cue, ::cue() and ::cue(type.class.class#id) style selectors.
+ * Anything else, like attributes, pseudo classes or combinators is left as unsupported */
+static void parse_selector(const char *str, struct cue_selector *sel)
+{
+    const char *p;
+    int len;
 
-    r = regcomp(&reg, "(-?[[:digit:]]+)(px)? (-?[[:digit:]]+)(px)? ([^,]+),?", REG_EXTENDED);
-    assert(r == 0);
-    assert(reg.re_nsub < ARRSIZE(regm));
+    *sel = (struct cue_selector){ .type = -1 };
 
-    for (shad_count = 0; shad_count < ARRSIZE(cs->text_shadow); shad_count++) {
-        r = regexec(&reg, val + val_off, reg.re_nsub + 1, regm, 0);
-        assert(r == 0);
+    if (strncmp(str, "::cue", 5) != 0)
+        return;
+    p = str + 5;
+    if (*p == '\0') {
+        sel->type = VNODE_ROOT;
+        sel->supported = true;
+        return;
+    }
+    if (*p++ != '(')
+        return;
+
+    if (*p == '*') {
+        p++;
+    } else if ((len = selector_name_len(p)) > 0) {
+        /* The type names are the tag names */
+        sel->type = kw_tag_type(kw_lookup(p, len));
+        if (sel->type == -1)
+            return;
+        sel->specificity += 1;
+        p += len;
+    }
 
-        cs->text_shadow[shad_count].xpos = strtol(val + val_off + regm[1].rm_so, NULL, 10);
-        cs->text_shadow[shad_count].ypos = strtol(val + val_off + regm[3].rm_so, NULL, 10);
-        int colorlen = regm[5].rm_eo - regm[5].rm_so;
-        assert(colorlen < sizeof(cs->text_shadow[0].color));
-        memcpy(cs->text_shadow[shad_count].color, val + val_off + regm[5].rm_so, colorlen);
-        cs->text_shadow[shad_count].color[colorlen] = '\0';
+    while (*p == '.' || *p == '#') {
+        char c = *p++;
 
-        val_off += regm[0].rm_eo;
+        len = selector_name_len(p);
+        if (len == 0)
+            return;
+        if (c == '.') {
+            atom_t name = atom_intern(p, len);
+            if (sel->classes == NULL)
+                sel->classes = dyna_create_size(sizeof(atom_t), 2);
+            dyna_append(sel->classes, &name);
+            sel->specificity += 10;
+        } else {
+            if (sel->id)
+                return;
+            sel->id = strndup(p, len);
+            sel->specificity += 100;
+        }
+        p += len;
     }
 
-    cs->text_shadow_count = shad_count;
+    if (strcmp(p, ")") != 0)
+        return;
 
-    regfree(&reg);
+    if (sel->type == -1 && sel->classes == NULL)
+        sel->type = VNODE_ROOT;
+    sel->supported = true;
 }
 
-static void parse_keyval(struct token *tok, struct cue_style *cs)
+static bool parse_text_shadow(struct css_scan *sc, struct cue_style *cs)
 {
-    const char *key = tok->style_keyval.key;
-    const char *val = tok->style_keyval.value;
+    int count = css_parse_shadows(sc, ARRSIZE(cs->text_shadow), cs->text_shadow);
+    if (count < 0)
+        return false;
+    cs->text_shadow_count = count;
+    return true;
+}
+
+static bool parse_font_weight(struct css_scan *sc, struct cue_style *cs)
+{
+    float weight;
 
-    if (strcmp(key, "ruby-position") == 0) {
-        if (strcmp(val, "under") == 0) {
-            cs->ruby_position = RUBYPOS_UNDER;
+    if (css_parse_number(sc, &weight)) {
+        cs->bold = weight >= 600;
+    } else {
+        switch (css_parse_keyword(sc)) {
+        case CKW_BOLD:
+        case CKW_BOLDER:
+            cs->bold = true;
+            break;
+        case CKW_NORMAL:
+        case CKW_LIGHTER:
+            cs->bold = false;
+            break;
+        default:
+            return false;
         }
-    } else if (strcmp(key, "x-ttml-shear") == 0) {
+    }
+    cs->bold_set = true;
+    return true;
+}
+
+static bool parse_font_style(struct css_scan *sc, struct cue_style *cs)
+{
+    float angle;
+
+    switch (css_parse_keyword(sc)) {
+    case CKW_OBLIQUE:
+        /* oblique can have an angle after it */
+        if (css_parse_number(sc, &angle) && css_parse_keyword(sc) != CKW_DEG)
+            return false;
+        /* fallthrough */
+    case CKW_ITALIC:
         cs->italic = true;
-    } else if (strcmp(key, "text-shadow") == 0) {
-        parse_text_shadow(val, cs);
+        break;
+    case CKW_NORMAL:
+        cs->italic = false;
+        break;
+    default:
+        return false;
+    }
+    cs->italic_set = true;
+    return true;
+}
+
+/* Only the line keywords of text-decoration, the style and color are skipped */
+static bool parse_text_decoration(struct css_scan *sc, struct cue_style *cs)
+{
+    const char *ident;
+    int len;
+    bool underline = false, line_through = false;
+
+    while (css_parse_ident(sc, &ident, &len)) {
+        switch (kw_css_lookup(ident, len)) {
+        case CKW_UNDERLINE:
+            underline = true;
+            break;
+        case CKW_LINE_THROUGH:
+            line_through = true;
+            break;
+        default:
+            break;
+        }
+    }
+    if (!css_at_end(sc))
+        return false;
+
+    cs->underline = underline;
+    cs->line_through = line_through;
+    cs->decoration_set = true;
+    return true;
+}
+
+static bool parse_opacity(struct css_scan *sc, struct cue_style *cs)
+{
+    float v;
+
+    if (!css_parse_number(sc, &v))
+        return false;
+    if (sc->p < sc->end && *sc->p == '%') {
+        sc->p++;
+        v /= 100.0f;
+    }
+    cs->opacity = v < 0 ? 0 : v > 1 ? 1 : v;
+    cs->opacity_set = true;
+    return true;
+}
+
+static bool parse_ruby_position(struct css_scan *sc, struct cue_style *cs)
+{
+    switch (css_parse_keyword(sc)) {
+    case CKW_UNDER:
+        cs->ruby_position = RUBYPOS_UNDER;
+        return true;
+    case CKW_OVER:
+    case CKW_ALTERNATE:
+        cs->ruby_position = RUBYPOS_OVER;
+        return true;
+    default:
+        return false;
+    }
+}
+
+/* Parses a declaration into cs. Unknown properties are skipped,
+ * invalid values are ignored with a warning, like a browser would */
+static void parse_keyval(struct token *tok, struct cue_style *cs)
+{
+    const char *key = tok->style_keyval.key;
+    struct cue_style ncs = *cs;
+    struct css_scan sc;
+    bool ok;
+
+    css_scan_init(&sc, tok->style_keyval.value);
+
+    switch (kw_css_lookup(key, strlen(key))) {
+    case CKW_RUBY_POSITION:
+        ok = parse_ruby_position(&sc, &ncs);
+        break;
+    case CKW_X_TTML_SHEAR:
+        /* Any shear is drawn as italic */
+        ncs.italic = ncs.italic_set = true;
+        ok = css_parse_length(&sc, &(struct css_length){0});
+        break;
+    case CKW_TEXT_SHADOW:
+        ok = parse_text_shadow(&sc, &ncs);
+        break;
+    case CKW_COLOR:
+        ok = ncs.color_set = css_parse_color(&sc, &ncs.color);
+        break;
+    case CKW_BACKGROUND_COLOR:
+    case CKW_BACKGROUND:
+        ok = ncs.background_color_set = css_parse_color(&sc, &ncs.background_color);
+        break;
+    case CKW_OPACITY:
+        ok = parse_opacity(&sc, &ncs);
+        break;
+    case CKW_FONT_WEIGHT:
+        ok = parse_font_weight(&sc, &ncs);
+        break;
+    case CKW_FONT_STYLE:
+        ok = parse_font_style(&sc, &ncs);
+        break;
+    case CKW_TEXT_DECORATION:
+    case CKW_TEXT_DECORATION_LINE:
+        ok = parse_text_decoration(&sc, &ncs);
+        break;
+    default:
+        return;
+    }
+
+    if (!ok || !css_at_end(&sc)) {
+        fprintf(stderr, "[Warning] Invalid value for %s: '%s', ignoring it\n", key, tok->style_keyval.value);
+        return;
     }
+    *cs = ncs;
 }
 
-static int parse_group(struct dyna *tokens, int tok_idx, struct dyna *styles)
+static int parse_group(struct token_vec *tokens, int tok_idx, struct dyna *styles)
 {
 #define ADVANCE() { \
     i++; \
-    if (i >= tokens->e_idx) goto err; \
-    tok = dyna_elem(tokens, i); \
+    if (i >= tokens->count) goto err; \
+    tok = &tokens->data[i]; \
 }
 #define EXP(exp_token_type) if (tok->type != exp_token_type) { \
     fprintf(stderr, "Unexpected token: %s  expected %s\n", tok_type2str(tok->type), tok_type2str(exp_token_type)); \
@@ -76,13 +267,16 @@ static int parse_group(struct dyna *tokens, int tok_idx, struct dyna *styles)
 }
 
     int i = tok_idx;
-    struct token *tok = dyna_elem(tokens, i);
+    struct token *tok = &tokens->data[i];
     struct cue_style cs = {0};
 
     EXP(TOK_STYLE_SELECTOR);
     /* Move string instead of copy */
     cs.selector = tok->style_selector.str;
     tok->style_selector.str = NULL;
+    parse_selector(cs.selector, &cs.sel);
+    if (!cs.sel.supported)
+        fprintf(stderr, "[Warning] Unsupported style selector '%s', ignoring it\n", cs.selector);
 
     ADVANCE(); EXP(TOK_STYLE_OPEN_BRACE);
 
@@ -94,23 +288,59 @@ static int parse_group(struct dyna *tokens, int tok_idx, struct dyna *styles)
     EXP(TOK_STYLE_CLOSE_BRACE);
 
     dyna_append(styles, &cs);
+    return i;
 
 err:
+    cuestyle_free(&cs);
     return i;
 #undef ADVANCE
 #undef EXP
 }
 
-struct dyna *cuestyle_parse(struct dyna *tokens)
+static void index_rule(struct dyna **list, int rule_idx)
+{
+    if (*list == NULL)
+        *list = dyna_create_size(sizeof(int), 4);
+    dyna_append(*list, &rule_idx);
+}
+
+static void build_index(struct cue_styles *styles)
+{
+    styles->by_class = hmap_create(styles->rules->e_idx, HMAPFLAG_NONE);
+    styles->by_id = hmap_create(0, HMAPFLAG_NONE);
+    hmap_set_free_fn(styles->by_class, (hmap_free_fn)dyna_destroy);
+    hmap_set_free_fn(styles->by_id, (hmap_free_fn)dyna_destroy);
+
+    for (int i = 0; i < styles->rules->e_idx; i++) {
+        const struct cue_style *cs = dyna_elem(styles->rules, i);
+        const struct cue_selector *sel = &cs->sel;
+
+        if (!sel->supported)
+            continue;
+
+        /* The keys are owned by the rules */
+        if (sel->classes) {
+            const atom_t *cname = dyna_elem(sel->classes, 0);
+            index_rule((struct dyna**)hmap_put(styles->by_class, cname, sizeof(*cname)), i);
+        } else if (sel->id) {
+            index_rule((struct dyna**)hmap_put_str(styles->by_id, sel->id), i);
+        } else {
+            index_rule(&styles->by_type[sel->type], i);
+        }
+    }
+}
+
+struct cue_styles *cuestyle_parse(struct token_vec *tokens)
 {
-    struct dyna *styles = dyna_create_size(sizeof(struct cue_style), 4);
-    dyna_set_free_fn(styles, cuestyle_free);
+    struct cue_styles *styles;
+    struct dyna *rules = dyna_create_size(sizeof(struct cue_style), 4);
+    dyna_set_free_fn(rules, cuestyle_free);
 
-    for (int i = 0; i < tokens->e_idx; i++) {
-        struct token *tok = dyna_elem(tokens, i);
+    for (int i = 0; i < tokens->count; i++) {
+        struct token *tok = &tokens->data[i];
 
         if (tok->type == TOK_STYLE_SELECTOR) {
-            i = parse_group(tokens, i, styles);
+            i = parse_group(tokens, i, rules);
             continue;
         }
 
@@ -121,34 +351,145 @@ struct dyna *cuestyle_parse(struct dyna *tokens)
         }
     }
 
-    if (styles->e_idx == 0) {
+    if (rules->e_idx == 0) {
         /* No styles definied, return NULL */
-        dyna_destroy(styles);
-        styles = NULL;
+        dyna_destroy(rules);
+        return NULL;
     }
 
+    styles = calloc(1, sizeof(*styles));
+    assert(styles);
+    styles->rules = rules;
+    build_index(styles);
     return styles;
 }
 
+void cuestyle_destroy(struct cue_styles *styles)
+{
+    hmap_destroy(styles->by_class);
+    hmap_destroy(styles->by_id);
+    for (int i = 0; i < VNODE_TYPE_COUNT; i++) {
+        if (styles->by_type[i])
+            dyna_destroy(styles->by_type[i]);
+    }
+    dyna_destroy(styles->rules);
+    free(styles);
+}
+
+static bool node_has_class(const struct vtt_node *node, atom_t cname)
+{
+    const atom_t *classes = ctxt_classes(&node->classes);
+    for (int i = 0; i < node->classes.count; i++) {
+        if (classes[i] == cname)
+            return true;
+    }
+    return false;
+}
+
+static bool selector_matches(const struct cue_selector *sel, const char *cue_ident, const struct vtt_node *node)
+{
+    if (sel->type != -1 && sel->type != node->type)
+        return false;
+    if (sel->id && (cue_ident == NULL || strcmp(sel->id, cue_ident) != 0))
+        return false;
+    for (int i = 0; sel->classes && i < sel->classes->e_idx; i++) {
+        if (!node_has_class(node, *(atom_t*)dyna_elem(sel->classes, i)))
+            return false;
+    }
+    return true;
+}
+
+/* Adds the matching rules of the list to the sorted idxs, returns the new count */
+static int match_list(const struct cue_styles *styles, const struct dyna *list, const char *cue_ident,
+        const struct vtt_node *node, int count, int max, int idxs[max])
+{
+    for (int i = 0; list && i < list->e_idx; i++) {
+        int ri = *(int*)dyna_elem(list, i), at;
+        const struct cue_style *cs = dyna_elem(styles->rules, ri);
+
+        if (!selector_matches(&cs->sel, cue_ident, node))
+            continue;
+
+        /* Keep them ordered by specificity, then by source order */
+        for (at = count; at > 0; at--) {
+            const struct cue_style *prev = dyna_elem(styles->rules, idxs[at - 1]);
+            if (idxs[at - 1] == ri)
+                goto next;
+            if (prev->sel.specificity < cs->sel.specificity ||
+                    (prev->sel.specificity == cs->sel.specificity && idxs[at - 1] < ri))
+                break;
+        }
+        if (count >= max) {
+            fprintf(stderr, "[Warning] Too many style rules match a node, ignoring the rest\n");
+            return count;
+        }
+        memmove(&idxs[at + 1], &idxs[at], (count - at) * sizeof(*idxs));
+        idxs[at] = ri;
+        count++;
+next:;
+    }
+    return count;
+}
+
+int cuestyle_match(const struct cue_styles *styles, const char *cue_ident, const struct vtt_node *node,
+        int max, const struct cue_style *out[max])
+{
+    int idxs[max];
+    int count = 0;
+    struct dyna **list;
+
+    if (styles == NULL)
+        return 0;
+
+    count = match_list(styles, styles->by_type[node->type], cue_ident, node, count, max, idxs);
+    if (cue_ident && (list = (struct dyna**)hmap_get_str(styles->by_id, cue_ident)))
+        count = match_list(styles, *list, cue_ident, node, count, max, idxs);
+    const atom_t *classes = ctxt_classes(&node->classes);
+    for (int i = 0; i < node->classes.count; i++) {
+        if ((list = (struct dyna**)hmap_get(styles->by_class, &classes[i], sizeof(*classes))))
+            count = match_list(styles, *list, cue_ident, node, count, max, idxs);
+    }
+
+    for (int i = 0; i < count; i++)
+        out[i] = dyna_elem(styles->rules, idxs[i]);
+    return count;
+}
+
 int cuestyle_print(int o_text_size, char o_text[o_text_size], struct cue_style *cs)
 {
     int r = snprintf(o_text, o_text_size,
-            "Selector: %s\nruby-position: %d\nitalic: %d\n",
-            cs->selector, cs->ruby_position, cs->italic);
+            "Selector: %s\nruby-position: %d\nitalic: %d\nbold: %d\nunderline: %d\ncolor: %08x\ntext-shadows: %d\n",
+            cs->selector, cs->ruby_position, cs->italic, cs->bold, cs->underline, cs->color, cs->text_shadow_count);
 
     return r;
 }
 
-const struct cue_style *cuestyle_get_by_selector(const struct dyna *styles, const char *selector)
+int cuestyle_node_key(const struct cue_styles *styles, const char *cue_ident, const struct vtt_node *node,
+        int max, char out[max])
 {
-    if (styles == NULL)
-        return NULL;
+    int w = 0, len;
 
-    for (int i = 0; i < styles->e_idx; i++) {
-        const struct cue_style *cs = dyna_elem(styles, i);
+    if (max < sizeof(int))
+        return -1;
+    memcpy(out, &(int){node->type}, sizeof(int));
+    w += sizeof(int);
 
-        if (cs->selector && strcmp(cs->selector, selector) == 0)
-            return cs;
+    /* Only matters if there are rules for ids */
+    if (styles && styles->by_id->count > 0 && cue_ident) {
+        len = strlen(cue_ident) + 1;
+        if (w + len > max)
+            return -1;
+        memcpy(out + w, cue_ident, len);
+        w += len;
     }
-    return NULL;
+    if (w >= max)
+        return -1;
+    out[w++] = '\0';
+
+    len = node->classes.count * sizeof(atom_t);
+    if (w + len > max)
+        return -1;
+    memcpy(out + w, ctxt_classes(&node->classes), len);
+    w += len;
+    return w;
 }
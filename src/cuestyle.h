@@ -1,11 +1,30 @@
 #ifndef _VTT2ASS_CUESTYLE_H
 #define _VTT2ASS_CUESTYLE_H
 #include <stdbool.h>
+#include <stdint.h>
 
+#include "css.h"
 #include "dyna.h"
+#include "hmap.h"
+#include "cuetext.h"
+#include "tokenizer.h"
+
+#define VNODE_TYPE_COUNT (VNODE_TIMESTAMP + 1)
+/* The most rules that can match a single node */
+#define CUESTYLE_MAX_MATCH 16
+
+/* A parsed ::cue(...) selector, every part that is set has to match the node */
+struct cue_selector {
+    int type; /* enum vtt_node_type, -1 for any. A selector without a type or classes is VNODE_ROOT */
+    char *id; /* Identifier of the cue, NULL for any. free */
+    struct dyna *classes; /* atom_t, the node has to have each of them. NULL if none */
+    int specificity;
+    bool supported; /* If false, this rule is never matched */
+};
 
 struct cue_style {
     char *selector; /* free */
+    struct cue_selector sel;
 
     enum {
         RUBYPOS_UNSET = 0,
@@ -13,17 +32,47 @@ struct cue_style {
         RUBYPOS_UNDER,
     } ruby_position;
 
-    struct {
-        int xpos, ypos;
-        char color[12];
-    } text_shadow[4];
+    struct css_shadow text_shadow[4];
     int text_shadow_count;
 
+    uint32_t color; /* 0xRRGGBBAA, as in css */
+    uint32_t background_color;
+    float opacity;
+
     bool italic : 1;
+    bool bold : 1;
+    bool underline : 1;
+    bool line_through : 1;
+
+    /* Only the properties that are set override the ones from other rules */
+    bool color_set : 1;
+    bool background_color_set : 1;
+    bool opacity_set : 1;
+    bool italic_set : 1;
+    bool bold_set : 1;
+    bool decoration_set : 1; /* underline and line_through */
+};
+
+/* The rules of the STYLE blocks, indexed by the parts of their selectors.
+ * Every rule is in exactly one index */
+struct cue_styles {
+    struct dyna *rules; /* struct cue_style, in source order */
+    struct hmap *by_class; /* first class atom -> struct dyna of int rule indexes */
+    struct hmap *by_id; /* cue id -> struct dyna of int rule indexes, if there are no classes */
+    struct dyna *by_type[VNODE_TYPE_COUNT]; /* int rule indexes, for the rest. Can be NULL */
 };
 
-struct dyna *cuestyle_parse(struct dyna *tokens);
-const struct cue_style *cuestyle_get_by_selector(const struct dyna *styles, const char *selector);
+/* Returns NULL if there are no styles */
+struct cue_styles *cuestyle_parse(struct token_vec *tokens);
+void cuestyle_destroy(struct cue_styles *styles);
+/* Finds the rules that apply to node in a cue with cue_ident (can be NULL).
+ * They are put in out in the order they should be applied in, the count is returned */
+int cuestyle_match(const struct cue_styles *styles, const char *cue_ident, const struct vtt_node *node,
+        int max, const struct cue_style *out[max]);
+/* Writes a key of everything cuestyle_match() looks at in the node,
+ * nodes with the same key get the same rules. Returns -1 if max is too small */
+int cuestyle_node_key(const struct cue_styles *styles, const char *cue_ident, const struct vtt_node *node,
+        int max, char out[max]);
 int cuestyle_print(int o_text_size, char o_text[o_text_size], struct cue_style *cs);
 
 #endif /* _VTT2ASS_CUESTYLE_H */
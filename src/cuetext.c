@@ -6,9 +6,17 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include "dyna.h"
 #include "util.h"
+#include "keywords.h"
+#include "strbuf.h"
+#include "html_entity_table.h"
 
 #define SAFE_FREE(x) if (x) free(x);
 
@@ -16,36 +24,37 @@ struct ctxt_class {
     char *name;
 };
 
-#define x(n, ...) #n,
-static const char *ctxt_token_str_map[] = {
-    TEXT_TOKEN_DEF(x)
-};
-#undef x
-
 #define ex(n) #n,
 static const char *ctxt_node_type_str_map[] = {
     VTT_NODE_TYPE_DEF(ex)
 };
 #undef ex
 
-static void ctxt_token_free(struct ctxt_token *tok)
+void ctxt_classes_add(struct vtt_classes *cl, atom_t a)
 {
-    switch (tok->type) {
-        case TTOK_STRING:
-            SAFE_FREE(tok->ttok_string.value);
-            break;
-        case TTOK_TAG_START:
-            SAFE_FREE(tok->ttok_tag_start.tag_name);
-            if (tok->ttok_tag_start.classes)
-                dyna_destroy(tok->ttok_tag_start.classes);
-            SAFE_FREE(tok->ttok_tag_start.annotation);
-            break;
-        case TTOK_TAG_END:
-            SAFE_FREE(tok->ttok_tag_end.tag_name);
-            break;
-        case TTOK_TIMESTAMP:
-            break;
+    if (cl->count < VTT_INLINE_CLASSES) {
+        cl->inl[cl->count++] = a;
+        return;
+    }
+    if (cl->count == VTT_INLINE_CLASSES) {
+        /* Move them to the heap */
+        atom_t *heap = malloc(sizeof(*heap) * VTT_INLINE_CLASSES * 2);
+        assert(heap);
+        memcpy(heap, cl->inl, sizeof(cl->inl));
+        cl->heap = heap;
+    } else if ((cl->count & (cl->count - 1)) == 0) {
+        /* Grow when the count reaches a power of 2 */
+        cl->heap = realloc(cl->heap, sizeof(*cl->heap) * cl->count * 2);
+        assert(cl->heap);
     }
+    cl->heap[cl->count++] = a;
+}
+
+void ctxt_classes_free(struct vtt_classes *cl)
+{
+    if (cl->count > VTT_INLINE_CLASSES)
+        free(cl->heap);
+    cl->count = 0;
 }
 
 static void ctxt_print_node_inner(const struct vtt_node *node, int nest, int *n, char *out[*n])
@@ -61,9 +70,8 @@ static void ctxt_print_node_inner(const struct vtt_node *node, int nest, int *n,
 
     wr = snprintf(*out, *n, "%s [", ctxt_node_type_str_map[node->type]);
     CN();
-    for (int i = 0; node->class_names && i < node->class_names->e_idx; i++) {
-        char **cn = dyna_elem(node->class_names, i);
-        wr = snprintf(*out, *n, ".%s", *cn);
+    for (int i = 0; i < node->classes.count; i++) {
+        wr = snprintf(*out, *n, ".%s", atom_str(ctxt_classes(&node->classes)[i]));
         CN();
     }
     wr = snprintf(*out, *n, "] ");
@@ -76,7 +84,7 @@ static void ctxt_print_node_inner(const struct vtt_node *node, int nest, int *n,
         wr = snprintf(*out, *n, " .text: %s", node->text);
         CN();
     } else if (node->type == VNODE_VOICE) {
-        wr = snprintf(*out, *n, " .annotation: %s", node->annotation);
+        wr = snprintf(*out, *n, " .annotation: %s", atom_str(node->annotation));
         CN();
     }
     wr = snprintf(*out, *n, "\n");
@@ -152,77 +160,265 @@ enum ctxt_states {
 };
 
 // https://html.spec.whatwg.org/multipage/named-characters.html#named-character-references
-struct html_charref {
-    const char *name, *chars;
-};
-static const struct html_charref html_charrefs[] = {
-    //{ .name = "lrm", .chars = "\u200E" },
-    { .name = "lrm", .chars = "" }, /* Just strip it out for now */
-};
+/* Longest name in the table, without the ';' */
+#define MAX_CHARREF_NAME 32
 
-const struct html_charref *find_html_charref(const char *name)
+/* Writes code point cp as utf-8 to out, returns the byte count */
+static int ctxt_utf8_encode(uint32_t cp, char out[4])
 {
-    for (int i = 0; i < ARRSIZE(html_charrefs); i++) {
-        const struct html_charref *cr = &html_charrefs[i];
-        if (strcmp(cr->name, name) == 0) {
-            return cr;
-        }
+    if (cp < 0x80) {
+        out[0] = cp;
+        return 1;
+    }
+    if (cp < 0x800) {
+        out[0] = 0xC0 | (cp >> 6);
+        out[1] = 0x80 | (cp & 0x3F);
+        return 2;
     }
-    return NULL;
+    if (cp < 0x10000) {
+        out[0] = 0xE0 | (cp >> 12);
+        out[1] = 0x80 | ((cp >> 6) & 0x3F);
+        out[2] = 0x80 | (cp & 0x3F);
+        return 3;
+    }
+    out[0] = 0xF0 | (cp >> 18);
+    out[1] = 0x80 | ((cp >> 12) & 0x3F);
+    out[2] = 0x80 | ((cp >> 6) & 0x3F);
+    out[3] = 0x80 | (cp & 0x3F);
+    return 4;
 }
 
-/* Returns the characters advanced - 1
- * out_buff, is the output buffer for charaters
- * out_buff_idx is the index into out_buff (this will be advanced)
- * out_buff_size is the max size of it */
-int read_html_character_references(const char *txt, char *out_buff, int *out_buff_idx, size_t out_buff_size)
+/* Reads a &#123; or &#x7B; reference, txt is after the '#'.
+ * The ';' is optional, like in html. Returns the length read, or 0 */
+static int read_numeric_character_reference(const char *txt, uint32_t *out_cp)
 {
-#define MAX_CHARREF_SIZE 16
-    char buff[MAX_CHARREF_SIZE];
-    int buffi = 0;
-    const struct html_charref *htmlchar;
+    bool hex = (*txt == 'x' || *txt == 'X');
+    int i = hex ? 1 : 0, start = i;
+    uint32_t cp = 0;
 
-    for (int i = 0; i < sizeof(buff); i++) {
+    for (;; i++) {
         char c = txt[i];
+        int d;
 
-        switch (c) {
-        case ';':
-            buff[buffi] = '\0';
-            htmlchar = find_html_charref(buff);
-            if (htmlchar == NULL) {
-                /* Don't add anything if not found, but consume the escape sequence */
-                fprintf(stderr, "[Warning] HTML escape character not found with name '%s' skipping...\n", buff);
-                return buffi;
-            }
-            /* If found, copy it into the output buffer */
-            strcpy(out_buff + *out_buff_idx, htmlchar->chars);
-            *out_buff_idx += strlen(htmlchar->chars);
-            assert(*out_buff_idx < out_buff_size);
-            return buffi;
-        default:
-            buff[buffi++] = c;
+        if (c >= '0' && c <= '9')
+            d = c - '0';
+        else if (hex && (c | 0x20) >= 'a' && (c | 0x20) <= 'f')
+            d = (c | 0x20) - 'a' + 10;
+        else
+            break;
+        /* Saturate, anything this large is invalid anyway */
+        if (cp <= 0x10FFFF)
+            cp = cp * (hex ? 16 : 10) + d;
+    }
+    if (i == start)
+        return 0;
+    if (txt[i] == ';')
+        i++;
+
+    /* Invalid code points are replaced, like in html */
+    if (cp == 0 || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+        cp = 0xFFFD;
+    *out_cp = cp;
+    return i;
+}
+
+/* Decodes the character reference at txt, which is right after a '&'.
+ * The characters are appended to out.
+ * Returns the length of the reference that was read, or 0 if there is no reference
+ * at txt, in which case the '&' should be kept as it is */
+int read_html_character_references(const char *txt, struct strbuf *out)
+{
+    const struct html_entity_entry *e;
+    int len, match = 0;
+
+    if (*txt == '#') {
+        uint32_t cp;
+        len = read_numeric_character_reference(txt + 1, &cp);
+        if (len == 0)
+            return 0;
+        char utf8[4];
+        strbuf_append(out, utf8, ctxt_utf8_encode(cp, utf8));
+        return len + 1;
+    }
+
+    for (len = 0; len <= MAX_CHARREF_NAME && isalnum((unsigned char)txt[len]); len++)
+        ;
+    if (len == 0)
+        return 0;
+
+    /* The longest name in the table that the text starts with, like html does.
+     * Only the legacy names (like "amp") are in it without the ';', so "&amp;",
+     * "&amp" and "&ampx" all read "amp" */
+    e = NULL;
+    if (txt[len] == ';' && (e = html_entity_lookup(txt, len + 1)))
+        match = len + 1;
+    for (int n = len; e == NULL && n > 0; n--) {
+        if ((e = html_entity_lookup(txt, n)))
+            match = n;
+    }
+    if (e == NULL) {
+        if (txt[len] == ';')
+            fprintf(stderr, "[Warning] HTML escape character not found with name '%.*s', keeping it as text\n", len, txt);
+        return 0;
+    }
+    /* If found, copy it into the output */
+    strbuf_append_str(out, e->val);
+    return match;
+}
+
+static void ctxt_free_node_inner(void *data)
+{
+    struct vtt_node *node = data;
+    if (node->type == VNODE_TEXT) {
+        if (node->text)
+            free(node->text);
+    } else { 
+        if (node->childs) {
+            dyna_destroy(node->childs);
         }
+        ctxt_classes_free(&node->classes);
     }
+}
 
-    //printf("smth: %16s\n", txt);
-    assert(buffi < sizeof(buff));
+void ctxt_free_node(struct vtt_node *node)
+{
+    ctxt_free_node_inner(node);
+    free(node);
+}
 
-    return buffi;
+#ifdef __SSE2__
+/* Returns the length of the run before the first '<', '&' or '\0' in s, 16 bytes at a time.
+ * The loads are aligned, so they never cross into the next page even if they
+ * read past the end of the string. This is not a real overflow, so asan and tsan should not check it */
+__attribute__((no_sanitize_address, no_sanitize_thread))
+static size_t ctxt_plain_len(const char *s)
+{
+    const char *p = (const char*)((uintptr_t)s & ~(uintptr_t)15);
+    const __m128i lt = _mm_set1_epi8('<'), amp = _mm_set1_epi8('&'), zero = _mm_setzero_si128();
+    /* Skip the bytes before s in the first block */
+    unsigned int skip = ~0u << (s - p);
+
+    for (;; p += 16, skip = ~0u) {
+        __m128i v = _mm_load_si128((const __m128i*)p);
+        __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, lt), _mm_cmpeq_epi8(v, amp)), _mm_cmpeq_epi8(v, zero));
+        unsigned int bits = _mm_movemask_epi8(m) & skip;
+        if (bits)
+            return p + __builtin_ctz(bits) - s;
+    }
+}
+#else
+static size_t ctxt_plain_len(const char *s)
+{
+    return strcspn(s, "<&");
+}
+#endif
+
+/* The enum vtt_node_type of a tag name, or -1 */
+static int ctxt_tag_type(const char *name, int len)
+{
+    return kw_tag_type(kw_lookup(name, len));
+}
+
+/* Appends node as the last child of parent, returns where it got stored */
+static struct vtt_node *ctxt_add_child(struct vtt_node *parent, struct vtt_node *node)
+{
+    node->parent = parent;
+    if (parent->childs == NULL) {
+        parent->childs = dyna_create_size_flags(sizeof(struct vtt_node), 3, DYNAFLAG_HEAPCOPY);
+        dyna_set_free_fn(parent->childs, ctxt_free_node_inner);
+    }
+    return dyna_append(parent->childs, node);
+}
+
+static void ctxt_add_text(struct vtt_node *current, const char *str, int len)
+{
+    struct vtt_node node = {
+        .type = VNODE_TEXT,
+        .text = strndup(str, len),
+    };
+    ctxt_add_child(current, &node);
+}
+
+/* Returns the new current node. classes are moved into the new node */
+static struct vtt_node *ctxt_start_tag(struct vtt_node *current, int tag_type, struct vtt_classes *classes, atom_t annotation)
+{
+    struct vtt_node node = {0};
+
+    if (tag_type == -1) {
+        /* Unknown tags are skipped */
+        ctxt_classes_free(classes);
+        return current;
+    }
+    assert(tag_type != VNODE_LANGUAGE && "Lang tags are not supported");
+
+    node.type = tag_type;
+    if (tag_type == VNODE_VOICE)
+        node.annotation = annotation;
+    node.classes = *classes;
+    *classes = (struct vtt_classes){0};
+    return ctxt_add_child(current, &node);
+}
+
+/* Returns the new current node */
+static struct vtt_node *ctxt_end_tag(struct vtt_node *current, int tag_type)
+{
+    if (tag_type == VNODE_LANGUAGE && current->type == VNODE_LANGUAGE) {
+        assert(0 && "Language tag not supported");
+    } else if (tag_type != -1 && tag_type == current->type) {
+        return current->parent;
+    } else if (tag_type == VNODE_RUBY && current->type == VNODE_RUBY_TEXT) {
+        return current->parent->parent;
+    }
+    return current;
+}
+
+/* Called with the current node after each start tag */
+static void ctxt_info_tag(struct ctxt_info *info, const struct vtt_node *node)
+{
+    int depth = 0;
+
+    /* The root is its own parent while parsing */
+    for (const struct vtt_node *n = node; n->parent != n; n = n->parent)
+        depth++;
+    if (depth > info->max_depth)
+        info->max_depth = depth;
+    if (node->type == VNODE_RUBY_TEXT)
+        info->has_ruby = true;
+    if (node->classes.count > 0)
+        info->has_classes = true;
 }
 
-struct dyna *ctxt_tokenize(const char *txt)
+static void ctxt_info_text(struct ctxt_info *info, struct strbuf *plain, const struct vtt_node *current, const char *str, int len)
 {
-    char result[1024] = {0};
-    int resi = 0;
-    char buffer[1024] = {0};
-    int bufi = 0;
-    struct dyna *classes = dyna_create_size(sizeof(char*), 4);
-    dyna_set_free_fn(classes, deref_free);
+    const char *nl = str, *end = str + len;
 
-    struct dyna *tokens = dyna_create_size_flags(sizeof(struct ctxt_token), 6, DYNAFLAG_HEAPCOPY);
-    dyna_set_free_fn(tokens, (dyna_free_fn)ctxt_token_free);
+    while ((nl = memchr(nl, '\n', end - nl))) {
+        info->lines++;
+        nl++;
+    }
+    if (current->type != VNODE_RUBY_TEXT)
+        strbuf_append(plain, str, len);
+}
 
-    struct ctxt_token tok = {0};
+/* https://www.w3.org/TR/webvtt1/#cue-text-parsing-rules
+ * The tokenizer and the tree building are done in one pass,
+ * nodes are added as soon as their token is complete */
+struct vtt_node *ctxt_parse(const char *txt, struct ctxt_info *out_info)
+{
+    /* The text or the tag name, and the class or the annotation being read */
+    struct strbuf result, buffer;
+    struct vtt_classes classes = {0};
+    struct ctxt_info info = { .lines = 1 };
+    struct strbuf plain;
+
+    struct vtt_node *root = calloc(1, sizeof(*root));
+    struct vtt_node *current = root;
+    assert(root);
+    /* The root is its own parent while parsing, so stray end tags stay at the root */
+    root->parent = root;
+    strbuf_init(&plain);
+    strbuf_init(&result);
+    strbuf_init(&buffer);
 
     enum ctxt_states state = STATE_DATA;
 
@@ -234,18 +430,17 @@ struct dyna *ctxt_tokenize(const char *txt)
         case STATE_DATA:
             switch (c) {
             case '<':
-                if (resi == 0) {
+                if (result.len == 0) {
                     state = STATE_TAG;
                     goto next;
                 }
                 txt--;
             /* Fall */
             case '\0':
-                if (resi > 0) {
-                    tok.type = TTOK_STRING;
-                    tok.ttok_string.value = strndup(result, resi);
-                    dyna_append(tokens, &tok);
-                    resi = 0;
+                if (result.len > 0) {
+                    ctxt_add_text(current, strbuf_data(&result), result.len);
+                    ctxt_info_text(&info, &plain, current, strbuf_data(&result), result.len);
+                    strbuf_clear(&result);
                 }
                 goto next;
                 break;
@@ -253,10 +448,21 @@ struct dyna *ctxt_tokenize(const char *txt)
                 state = STATE_HTML_CHAR_REF_IN_DATA_STATE;
                 goto next;
                 break;
-            default:
-                result[resi++] = c;
+            default: {
+                /* Take the whole run of plain text at once */
+                size_t run = ctxt_plain_len(txt);
+                if (result.len == 0 && txt[run] != '&') {
+                    /* The run is the whole text node, so it is used from txt without a copy */
+                    ctxt_add_text(current, txt, run);
+                    ctxt_info_text(&info, &plain, current, txt, run);
+                    txt += run - 1;
+                    goto next;
+                }
+                strbuf_append(&result, txt, run);
+                txt += run - 1;
                 goto next;
             }
+            }
             break;
 
         case STATE_TAG:
@@ -278,16 +484,12 @@ struct dyna *ctxt_tokenize(const char *txt)
                     assert(0 && "No timestamp");
                     break;
                 case '>':
-                    //txt++;
                 case '\0':
+                    /* A tag without a name */
                     state = STATE_DATA;
-                    tok.type = TTOK_TAG_START;
-                    tok.ttok_tag_start.tag_name = tok.ttok_tag_start.annotation = NULL;
-                    tok.ttok_tag_start.classes = NULL;
-                    dyna_append(tokens, &tok);
                     goto next;
                 default:
-                    result[resi++] = c;
+                    strbuf_append_char(&result, c);
                     state = STATE_START_TAG;
                     goto next;
             }
@@ -307,18 +509,14 @@ struct dyna *ctxt_tokenize(const char *txt)
                     state = STATE_START_TAG_CLASS;
                     goto next;
                 case '>':
-                    //txt++;
                 case '\0':
                     state = STATE_DATA;
-                    tok.type = TTOK_TAG_START;
-                    tok.ttok_tag_start.tag_name = strndup(result, resi);
-                    resi = 0;
-                    tok.ttok_tag_start.annotation = NULL;
-                    tok.ttok_tag_start.classes = NULL;
-                    dyna_append(tokens, &tok);
+                    current = ctxt_start_tag(current, ctxt_tag_type(strbuf_data(&result), result.len), &classes, ATOM_NONE);
+                    ctxt_info_tag(&info, current);
+                    strbuf_clear(&result);
                     goto next;
                 default:
-                    result[resi++] = c;
+                    strbuf_append_char(&result, c);
             }
             break;
 
@@ -328,33 +526,27 @@ struct dyna *ctxt_tokenize(const char *txt)
                 case '\f':
                 case ' ':
                     state = STATE_TAG_ANNOTATION;
-                    *(char**)dyna_emplace(classes) = strndup(buffer, bufi);
-                    bufi = 0;
+                    ctxt_classes_add(&classes, atom_intern(strbuf_data(&buffer), buffer.len));
+                    strbuf_clear(&buffer);
                     goto next;
                 case '\n':
                     assert(0 && "Newline annotation not supported!");
                     break;
                 case '.':
-                    *(char**)dyna_emplace(classes) = strndup(buffer, bufi);
-                    bufi = 0;
+                    ctxt_classes_add(&classes, atom_intern(strbuf_data(&buffer), buffer.len));
+                    strbuf_clear(&buffer);
                     goto next;
                 case '>':
-                    //txt++;
                 case '\0':
                     state = STATE_DATA;
-                    *(char**)dyna_emplace(classes) = strndup(buffer, bufi);
-                    tok.type = TTOK_TAG_START;
-                    tok.ttok_tag_start.tag_name = strndup(result, resi);
-                    tok.ttok_tag_start.classes = classes;
-                    tok.ttok_tag_start.annotation = NULL;
-                    dyna_append(tokens, &tok);
-
-                    classes = dyna_create_size(sizeof(char*), 4);
-                    dyna_set_free_fn(classes, deref_free);
-                    resi = bufi = 0;
+                    ctxt_classes_add(&classes, atom_intern(strbuf_data(&buffer), buffer.len));
+                    current = ctxt_start_tag(current, ctxt_tag_type(strbuf_data(&result), result.len), &classes, ATOM_NONE);
+                    ctxt_info_tag(&info, current);
+                    strbuf_clear(&result);
+                    strbuf_clear(&buffer);
                     goto next;
                 default:
-                    buffer[bufi++] = c;
+                    strbuf_append_char(&buffer, c);
             }
             break;
 
@@ -365,46 +557,34 @@ struct dyna *ctxt_tokenize(const char *txt)
                 break;
             case '>':
             case '\0': {
-                state = STATE_DATA;
-                tok.type = TTOK_TAG_START;
-                tok.ttok_tag_start.tag_name = strndup(result, resi);
-                if (classes->e_idx > 0) {
-                    tok.ttok_tag_start.classes = classes;
-                    classes = dyna_create_size(sizeof(char*), 4);
-                    dyna_set_free_fn(classes, deref_free);
-                } else {
-                    tok.ttok_tag_start.classes = NULL;
-                }
+                atom_t annotation = ATOM_NONE;
 
-                ctxt_normalize_annotation_str(&bufi, buffer);
+                state = STATE_DATA;
+                int bufi = buffer.len;
+                ctxt_normalize_annotation_str(&bufi, strbuf_data(&buffer));
                 if (bufi)
-                    tok.ttok_tag_start.annotation = strndup(buffer, bufi);
-                else
-                    tok.ttok_tag_start.annotation = NULL;
-
-                dyna_append(tokens, &tok);
-                resi = 0;
-                bufi = 0;
+                    annotation = atom_intern(strbuf_data(&buffer), bufi);
+                current = ctxt_start_tag(current, ctxt_tag_type(strbuf_data(&result), result.len), &classes, annotation);
+                ctxt_info_tag(&info, current);
+                strbuf_clear(&result);
+                strbuf_clear(&buffer);
             }
                 break;
             default:
-                buffer[bufi++] = c;
+                strbuf_append_char(&buffer, c);
             }
             break;
 
         case STATE_END_TAG:
             switch (c) {
             case '>':
-                //txt++;
             case '\0':
                 state = STATE_DATA;
-                tok.type = TTOK_TAG_END;
-                tok.ttok_tag_end.tag_name = strndup(result, resi);
-                dyna_append(tokens, &tok);
-                resi = 0;
+                current = ctxt_end_tag(current, ctxt_tag_type(strbuf_data(&result), result.len));
+                strbuf_clear(&result);
                 break;
             default:
-                result[resi++] = c;
+                strbuf_append_char(&result, c);
                 goto next;
             }
             break;
@@ -412,11 +592,18 @@ struct dyna *ctxt_tokenize(const char *txt)
         case STATE_TIMESTAMP:
             assert(0 && "No timestamp state");
             break;
-        case STATE_HTML_CHAR_REF_IN_DATA_STATE:
-            txt += read_html_character_references(txt, result, &resi, sizeof(result));
+        case STATE_HTML_CHAR_REF_IN_DATA_STATE: {
+            int len = read_html_character_references(txt, &result);
             state = STATE_DATA;
+            if (len == 0) {
+                /* Not a reference, the '&' is text, and the current character is read again as data */
+                strbuf_append_char(&result, '&');
+                continue;
+            }
+            txt += len - 1;
             goto next;
         }
+        }
 
 next:
         if (c == '\0')
@@ -424,169 +611,19 @@ next:
         txt++;
     }
 
-end:
-    dyna_destroy(classes);
-    return tokens;
-}
-
-void ctxt_token_print(const struct ctxt_token *tok, int len, char out[len])
-{
-    int i = 0;
-    i += snprintf(out, len - i, "type: %s", ctxt_token_str_map[tok->type]);
-    switch (tok->type) {
-        case TTOK_STRING:
-            i += snprintf(out + i, len - i, "\n .value = %s", tok->ttok_string.value);
-            break;
-        case TTOK_TAG_START: {
-            i += snprintf(out + i, len - i, "\n .tag_name = %s\n .classes = ", tok->ttok_tag_start.tag_name);
-            struct dyna *cl = tok->ttok_tag_start.classes;
-            for (int c = 0; cl && c < cl->e_idx; c++) {
-                i += snprintf(out + i, len - i, "%s ", *(char**)dyna_elem(cl, c));
-            }
-            break;
-        }
-        case TTOK_TAG_END:
-            i += snprintf(out + i, len - i, "\n .tag_name = %s", tok->ttok_tag_end.tag_name);
-            break;
-    }
-}
-
-static void ctxt_free_node_inner(void *data)
-{
-    struct vtt_node *node = data;
-    if (node->type == VNODE_TEXT) {
-        if (node->text)
-            free(node->text);
-    } else { 
-        if (node->childs) {
-            dyna_destroy(node->childs);
-        }
-        if (node->class_names) {
-            dyna_destroy(node->class_names);
-        }
-        if (node->annotation) {
-            free(node->annotation);
-        }
-    }
-}
-
-void ctxt_free_node(struct vtt_node *node)
-{
-    ctxt_free_node_inner(node);
-    free(node);
-}
-
-/* https://www.w3.org/TR/webvtt1/#cue-text-parsing-rules */
-static struct vtt_node *ctxt_parse_nodes(struct dyna *tokens)
-{
-    struct vtt_node node;
-    struct vtt_node *root = calloc(1, sizeof(*root));
-    struct vtt_node *current = root;
-    current->parent = root;
-
-    for (int i = 0; i < tokens->e_idx; i++) {
-        struct ctxt_token *tok = dyna_elem(tokens, i);
-
-        char *tn;
-        switch (tok->type) {
-        case TTOK_STRING:
-            /* Move instead of copy */
-            memset(&node, 0, sizeof(node));
-            node.type = VNODE_TEXT;
-            node.text = tok->ttok_string.value;
-            tok->ttok_string.value = NULL;
-
-            node.parent = current;
-            if (current->childs == NULL) {
-                current->childs = dyna_create_size_flags(sizeof(struct vtt_node), 3, DYNAFLAG_HEAPCOPY);
-                dyna_set_free_fn(current->childs, ctxt_free_node_inner);
-            }
-            dyna_append(current->childs, &node);
-            break;
-        case TTOK_TAG_START:
-            tn = tok->ttok_tag_start.tag_name;
-            memset(&node, 0, sizeof(node));
-            if (strcmp(tn, "c") == 0) {
-                node.type = VNODE_CLASS;
-            } else if (strcmp(tn, "i") == 0) {
-                node.type = VNODE_ITALIC;
-            } else if (strcmp(tn, "b") == 0) {
-                node.type = VNODE_BOLD;
-            } else if (strcmp(tn, "u") == 0) {
-                node.type = VNODE_UNDERLINE;
-            } else if (strcmp(tn, "ruby") == 0) {
-                node.type = VNODE_RUBY;
-            } else if (strcmp(tn, "rt") == 0) {
-                node.type = VNODE_RUBY_TEXT;
-            } else if (strcmp(tn, "v") == 0) {
-                node.type = VNODE_VOICE;
-                node.annotation = tok->ttok_tag_start.annotation;
-                tok->ttok_tag_start.annotation = NULL;
-            } else if (strcmp(tn, "lang") == 0) {
-                assert(0 && "Lang tags are not supported");
-                break;
-            } else {
-                continue;
-            }
-            node.class_names = tok->ttok_tag_start.classes;
-            tok->ttok_tag_start.classes = NULL;
-            node.childs = NULL;
-            node.parent = current;
-
-            if (current->childs == NULL) {
-                current->childs = dyna_create_size_flags(sizeof(struct vtt_node), 3, DYNAFLAG_HEAPCOPY);
-                dyna_set_free_fn(current->childs, ctxt_free_node_inner);
-            }
-            current = dyna_append(current->childs, &node);
-            break;
-        case TTOK_TAG_END:
-            tn = tok->ttok_tag_end.tag_name;
-            if (    (strcmp(tn, "c") == 0 && current->type == VNODE_CLASS) ||
-                    (strcmp(tn, "i") == 0 && current->type == VNODE_ITALIC) ||
-                    (strcmp(tn, "b") == 0 && current->type == VNODE_BOLD) ||
-                    (strcmp(tn, "u") == 0 && current->type == VNODE_UNDERLINE) ||
-                    (strcmp(tn, "ruby") == 0 && current->type == VNODE_RUBY) ||
-                    (strcmp(tn, "rt") == 0 && current->type == VNODE_RUBY_TEXT) ||
-                    (strcmp(tn, "v") == 0 && current->type == VNODE_VOICE)) {
-                current = current->parent;
-            } else if ((strcmp(tn, "lang") == 0 && current->type == VNODE_LANGUAGE)) {
-                assert(0 && "Language tag not supported");
-                return NULL;
-            } else if ((strcmp(tn, "ruby") == 0 && current->type == VNODE_RUBY_TEXT)) {
-                current = current->parent->parent;
-            }
-            break;
-        case TTOK_TIMESTAMP:
-            assert(0 && "Timestamp not supported");
-            return NULL;
-        }
-    }
-    
+    ctxt_classes_free(&classes);
+    strbuf_free(&result);
+    strbuf_free(&buffer);
     root->parent = NULL;
-    return root;
-}
-
 
-struct vtt_node *ctxt_parse(const char *txt)
-{
-    struct dyna *tokens = ctxt_tokenize(txt);
-
-    #if 0
-    char buf[1024];
-    for (int i = 0; i < tokens->e_idx; i++) {
-        ctxt_token_print(dyna_elem(tokens, i), sizeof(buf), buf);
-        printf("%s\n\n", buf);
+    if (out_info) {
+        info.plain_len = plain.len;
+        info.plain = strbuf_steal(&plain);
+        *out_info = info;
+    } else {
+        strbuf_free(&plain);
     }
-#endif
-
-    //struct dyna *nodes = ctxt_parse_nodes(tokens);
-    struct vtt_node *root_node = ctxt_parse_nodes(tokens);
-    dyna_destroy(tokens);
-
-    //ctxt_print_node(root_node);
-
-    //ctxt_free_node(root_node);
-    return root_node;
+    return root;
 }
 
 static int ctxt_text_inner(const struct vtt_node *node, int size, char out[size], int idx)
@@ -1,29 +1,21 @@
 #ifndef _VTT2ASS_CUETEXT_H
 #define _VTT2ASS_CUETEXT_H
 #include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
 #include "dyna.h"
+#include "atom.h"
 
-#define TEXT_TOKEN_DEF(ex_compl) \
-    ex_compl(TTOK_STRING, ttok_string, { char *value; /* free */ }) \
-    ex_compl(TTOK_TAG_START, ttok_tag_start, { char *tag_name; struct dyna *classes; char *annotation; /* free */ }) \
-    ex_compl(TTOK_TAG_END, ttok_tag_end, { char *tag_name; /* free */ }) \
-    ex_compl(TTOK_TIMESTAMP, ttok_timestamp, { float value; }) \
+#define VTT_INLINE_CLASSES 4
 
-#define ex_compl(n, ...) n,
-enum ctxt_token_type {
-    TEXT_TOKEN_DEF(ex_compl)
-};
-#undef ex_compl
-
-#define ex_compl(tok_name, struct_name, ...) \
-    struct struct_name __VA_ARGS__ struct_name;
-struct ctxt_token {
-    enum ctxt_token_type type;
+/* The class names of a tag, a few of them are stored without an allocation */
+struct vtt_classes {
+    int count;
     union {
-        TEXT_TOKEN_DEF(ex_compl)
+        atom_t inl[VTT_INLINE_CLASSES];
+        atom_t *heap; /* If count > VTT_INLINE_CLASSES. free */
     };
 };
-#undef ex_compl
 
 #define VTT_NODE_TYPE_DEF(ex) \
     ex(VNODE_ROOT) \
@@ -50,11 +42,11 @@ enum vtt_node_type {
 struct vtt_node {
     enum vtt_node_type type;
 
-    /* Applicable class names, or NULL */
-    struct dyna *class_names;
+    /* Applicable class names */
+    struct vtt_classes classes;
 
-    /* annotation string, only for VNODE_VOICE, can be NULL */
-    char *annotation;
+    /* Only for VNODE_VOICE, can be ATOM_NONE */
+    atom_t annotation;
 
     /* language tag not supported */
 
@@ -72,12 +64,29 @@ struct vtt_node {
 
 };
 
-struct vtt_node *ctxt_parse(const char *txt);
-struct dyna *ctxt_tokenize(const char *txt);
+/* Facts about the whole text, collected while it is parsed */
+struct ctxt_info {
+    int lines; /* 1 + the newlines in the text nodes */
+    int max_depth; /* The deepest tag nesting, 0 if there are no tags */
+    bool has_ruby; /* Has a VNODE_RUBY_TEXT */
+    bool has_classes; /* A tag has class names */
+    /* The text nodes joined, without the ruby text. Same as ctxt_text(). free */
+    char *plain;
+    size_t plain_len;
+};
+
+static inline const atom_t *ctxt_classes(const struct vtt_classes *cl)
+{
+    return cl->count > VTT_INLINE_CLASSES ? cl->heap : cl->inl;
+}
+void ctxt_classes_add(struct vtt_classes *cl, atom_t a);
+void ctxt_classes_free(struct vtt_classes *cl);
+
+/* out_info can be NULL */
+struct vtt_node *ctxt_parse(const char *txt, struct ctxt_info *out_info);
 void ctxt_free_node(struct vtt_node *node);
 
 int ctxt_text(const struct vtt_node *root, int size, char out[size]);
-void ctxt_token_print(const struct ctxt_token *tok, int len, char out[len]);
 void ctxt_print_node(const struct vtt_node *root, int n, char out[n]);
 
 #endif /* _VTT2ASS_CUETEXT_H */
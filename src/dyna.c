@@ -48,7 +48,7 @@ struct dyna *dyna_create_size_flags(size_t e_size, size_t init_size, enum dyna_f
 void dyna_destroy(struct dyna *dyna)
 {
     if (dyna->e_free_fn) {
-        for (int i = 0; i < dyna->e_idx; i++) {
+        for (int64_t i = 0; i < dyna->e_idx; i++) {
             void *elem = dyna_elem(dyna, i);
             dyna->e_free_fn(elem);
             if (dyna->flags & DYNAFLAG_HEAPCOPY)
@@ -69,7 +69,7 @@ void dyna_set_free_fn(struct dyna *d, dyna_free_fn fn)
 
 static int dyna_grow(struct dyna *d)
 {
-    int new_cap = d->e_cap * 2;
+    int64_t new_cap = d->e_cap * 2;
     size_t delem_size = (d->flags & DYNAFLAG_HEAPCOPY) ? sizeof(void*) : d->e_size;
     void *new_data = reallocarray(d->data, new_cap, delem_size);
     if (new_data == NULL)
@@ -117,4 +117,3 @@ void *dyna_elem(const struct dyna *d, int64_t idx)
     }
     return elemptr;
 }
-
@@ -1,31 +1,67 @@
 #include "font.h"
 
 #include <string.h>
+#include <stdlib.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <assert.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <hb-ft.h>
 
 #include "util.h"
+#include "hmap.h"
+
+#define MAX_FONTS 32
 
 static bool font_did_init = false;
-FT_Library ftlib = NULL;
 
-struct font_cache {
+/* The contents of a font file, mapped once and shared read-only by every thread */
+struct font_blob {
     char *fontpath;
+    const void *data;
+    size_t size;
+};
+static struct font_blob blobs[MAX_FONTS] = {0};
+static int blobs_count = 0;
+/* Only taken when a thread opens a font for the first time */
+static pthread_mutex_t blobs_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* A face and harfbuzz font of a blob, only used by the thread that created it */
+struct font_inst {
+    const struct font_blob *blob;
     FT_Face face;
+    hb_font_t *hfont;
 };
-static struct font_cache caches[32] = {0};
-int caches_count = 0;
+static _Thread_local FT_Library ftlib = NULL;
+static _Thread_local struct font_inst insts[MAX_FONTS];
+static _Thread_local int insts_count = 0;
 
 void font_init()
 {
     if (font_did_init)
         font_dinit();
 
-    int err = FT_Init_FreeType(&ftlib);
-    assert(err == FT_Err_Ok);
     font_did_init = true;
 }
 
+void font_thread_dinit()
+{
+    for (int i = 0; i < insts_count; i++) {
+        hb_font_destroy(insts[i].hfont);
+        FT_Done_Face(insts[i].face);
+    }
+    insts_count = 0;
+
+    if (ftlib) {
+        FT_Done_FreeType(ftlib);
+        ftlib = NULL;
+    }
+}
+
 void font_dinit()
 {
     if (!font_did_init) {
@@ -33,36 +69,120 @@ void font_dinit()
         return;
     }
 
-    for (int i = 0; i < caches_count; i++) {
-        FT_Done_Face(caches[i].face);
-        free(caches[i].fontpath);
+    font_thread_dinit();
+
+    for (int i = 0; i < blobs_count; i++) {
+        munmap((void*)blobs[i].data, blobs[i].size);
+        free(blobs[i].fontpath);
     }
 
-    caches_count = 0;
+    blobs_count = 0;
     font_did_init = false;
 }
 
-FT_Face font_get_face(const char *fontpath)
+static const struct font_blob *font_map_blob(const char *fontpath, struct font_blob *out)
+{
+    struct stat fs;
+    void *mm;
+    int fd;
+
+    fd = open(fontpath, O_RDONLY, 0);
+    if (fd == -1) {
+        perror("open() on font file");
+        return NULL;
+    }
+    if (fstat(fd, &fs) != 0 || fs.st_size == 0) {
+        perror("fstat() on font file");
+        close(fd);
+        return NULL;
+    }
+
+    mm = mmap(NULL, fs.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mm == MAP_FAILED) {
+        perror("mmap() on font file");
+        return NULL;
+    }
+
+    out->fontpath = strdup(fontpath);
+    out->data = mm;
+    out->size = fs.st_size;
+    return out;
+}
+
+static const struct font_blob *font_get_blob(const char *fontpath)
+{
+    const struct font_blob *blob = NULL;
+
+    pthread_mutex_lock(&blobs_lock);
+    for (int i = 0; i < blobs_count; i++) {
+        if (strcmp(blobs[i].fontpath, fontpath) == 0) {
+            blob = &blobs[i];
+            goto end;
+        }
+    }
+
+    assert(blobs_count < ARRSIZE(blobs));
+    blob = font_map_blob(fontpath, &blobs[blobs_count]);
+    if (blob)
+        blobs_count++;
+
+end:
+    pthread_mutex_unlock(&blobs_lock);
+    return blob;
+}
+
+static struct font_inst *font_get_inst(const char *fontpath)
 {
+    const struct font_blob *blob;
+    struct font_inst *inst;
     int err;
-    struct font_cache *cfc;
 
-    for (int i = 0; i < caches_count; i++) {
-        if (strcmp(caches[i].fontpath, fontpath) == 0) {
-            return caches[i].face;
+    /* Hot path, no locking */
+    for (int i = 0; i < insts_count; i++) {
+        if (strcmp(insts[i].blob->fontpath, fontpath) == 0) {
+            return &insts[i];
         }
     }
 
-    assert(caches_count < ARRSIZE(caches));
-    cfc = &caches[caches_count];
-    err = FT_New_Face(ftlib, fontpath, 0, &cfc->face);
+    blob = font_get_blob(fontpath);
+    if (blob == NULL)
+        return NULL;
+
+    if (ftlib == NULL) {
+        err = FT_Init_FreeType(&ftlib);
+        assert(err == FT_Err_Ok);
+    }
+
+    assert(insts_count < ARRSIZE(insts));
+    inst = &insts[insts_count];
+    err = FT_New_Memory_Face(ftlib, blob->data, blob->size, 0, &inst->face);
     if (err != FT_Err_Ok) {
+        fprintf(stderr, "Failed to load font face from '%s'\n", fontpath);
         return NULL;
     }
-    cfc->fontpath = strdup(fontpath);
-    
-    caches_count++;
-    return cfc->face;
+    inst->hfont = hb_ft_font_create_referenced(inst->face);
+    assert(inst->hfont);
+    inst->blob = blob;
+
+    insts_count++;
+    return inst;
+}
+
+FT_Face font_get_face(const char *fontpath)
+{
+    struct font_inst *inst = font_get_inst(fontpath);
+    if (inst == NULL)
+        return NULL;
+    return inst->face;
+}
+
+hb_font_t *font_get_hb_font(const char *fontpath)
+{
+    struct font_inst *inst = font_get_inst(fontpath);
+    if (inst == NULL)
+        return NULL;
+    return inst->hfont;
 }
 
 const char *font_get_name(FT_Face face)
@@ -70,6 +190,14 @@ const char *font_get_name(FT_Face face)
     return FT_Get_Postscript_Name(face);
 }
 
+uint64_t font_get_file_hash(const char *fontpath)
+{
+    const struct font_blob *blob = font_get_blob(fontpath);
+    if (blob == NULL)
+        return 0;
+    return hmap_hash(blob->data, blob->size);
+}
+
 
 FT_Library font_get_lib()
 {
@@ -3,14 +3,31 @@
 #include <ft2build.h>
 #include FT_FREETYPE_H
 #include FT_GLYPH_H
+#include <hb.h>
+#include <stdint.h>
+
+/* Every font file is mapped only once, and shared between threads.
+ * The faces created from them are per thread, because FT_Face is not
+ * thread safe, so there is no locking needed when using them */
 
 void font_init();
+/* Frees the fonts of the calling thread, and every shared font file.
+ * Must be called after the other threads did font_thread_dinit() */
 void font_dinit();
+/* Frees the faces of the calling thread.
+ * Every thread other than the one calling font_init() has to call this
+ * before exiting, if it used any font */
+void font_thread_dinit();
 
-/* Returned face will be free'd with font_dinit() */
+/* Returned face belongs to the calling thread, and will be free'd
+ * with font_thread_dinit() or font_dinit() */
 FT_Face font_get_face(const char *fontpath);
+/* Same as above, the harfbuzz font of the face */
+hb_font_t *font_get_hb_font(const char *fontpath);
 
 const char *font_get_name(FT_Face face);
+/* Hash of the contents of the font file, 0 if it cannot be opened */
+uint64_t font_get_file_hash(const char *fontpath);
 
 /* debug */
 FT_Library font_get_lib();
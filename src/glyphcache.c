@@ -0,0 +1,523 @@
+#include "glyphcache.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <assert.h>
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <hb.h>
+
+#include "font.h"
+#include "hmap.h"
+#include "strbuf.h"
+#include "util.h"
+
+/* Changes when the layout of the file changes */
+#define GCACHE_FORMAT 1
+#define GCACHE_MAGIC "V2AGLYPH"
+#define GCACHE_MAX_FONTS 32
+
+struct gcache_header {
+    char magic[8];
+    uint32_t format;
+    uint32_t shape_version;
+    uint64_t font_hash;
+    char lib_versions[32]; /* harfbuzz and freetype, '\0' padded */
+};
+
+/* A record is this, then the key, then count glyphs. The records are only appended,
+ * a later one with the same key replaces the earlier one.
+ * Nothing is aligned, so everything is read with memcpy() */
+struct gcache_rec {
+    uint32_t size; /* The whole record, with this */
+    uint32_t key_len;
+    uint32_t count;
+};
+
+/* The cache of a font */
+struct gcache_file {
+    char *fontpath; /* free */
+    char *path; /* free */
+    uint64_t font_hash;
+
+    /* The mapped file, NULL if there was none, or it was not valid */
+    const uint8_t *map;
+    size_t map_size;
+    size_t valid_size; /* Every record is valid up to here */
+    struct hmap *index; /* key, pointing into map -> record offset */
+
+    /* The records shaped in this run, in file format */
+    struct strbuf pending;
+    struct hmap *pending_index; /* key -> record offset in pending + 1 */
+    int64_t pending_count;
+};
+
+static char *gcache_dir = NULL;
+static struct gcache_file files[GCACHE_MAX_FONTS];
+static int files_count = 0;
+/* The layout threads share the files, this guards everything in them */
+static pthread_mutex_t files_lock = PTHREAD_MUTEX_INITIALIZER;
+static atomic_int_least64_t gcache_hits, gcache_misses;
+
+#define GCACHE_APPEND(sb, v) strbuf_append(sb, (const char*)&(v), sizeof(v))
+
+static void gcache_make_header(uint64_t font_hash, struct gcache_header *out)
+{
+    memset(out, 0, sizeof(*out));
+    memcpy(out->magic, GCACHE_MAGIC, sizeof(out->magic));
+    out->format = GCACHE_FORMAT;
+    out->shape_version = GCACHE_SHAPE_VERSION;
+    out->font_hash = font_hash;
+    snprintf(out->lib_versions, sizeof(out->lib_versions), "hb %s ft %d.%d.%d",
+            hb_version_string(), FREETYPE_MAJOR, FREETYPE_MINOR, FREETYPE_PATCH);
+}
+
+static void gcache_make_key(const char *text, int text_len, int fs, bool kern, struct strbuf *key)
+{
+    int32_t vals[] = { fs, kern };
+
+    GCACHE_APPEND(key, vals);
+    strbuf_append(key, text, text_len);
+}
+
+/* Returns the header of the record at off, or false if it does not fit in size bytes */
+static bool gcache_rec_at(const uint8_t *base, size_t size, size_t off, struct gcache_rec *out)
+{
+    if (off > size || size - off < sizeof(*out))
+        return false;
+    memcpy(out, base + off, sizeof(*out));
+    return out->size <= size - off && out->size >= sizeof(*out) && out->key_len <= out->size - sizeof(*out) &&
+        (out->size - sizeof(*out) - out->key_len) / sizeof(struct gcache_glyph) == out->count &&
+        (out->size - sizeof(*out) - out->key_len) % sizeof(struct gcache_glyph) == 0;
+}
+
+/* Calls fn with the offset of every record after the header, until the first invalid one.
+ * Returns the offset of the end of the last valid record */
+static size_t gcache_scan(const uint8_t *map, size_t size, void (*fn)(void *arg, const uint8_t *map, size_t off, const struct gcache_rec *rh), void *arg)
+{
+    struct gcache_rec rh;
+    size_t off = sizeof(struct gcache_header);
+
+    while (gcache_rec_at(map, size, off, &rh)) {
+        fn(arg, map, off, &rh);
+        off += rh.size;
+    }
+    return off;
+}
+
+/* Maps the file, and returns its header. Returns NULL if it does not exist or it is not a cache file */
+static const uint8_t *gcache_map(const char *path, size_t *out_size, struct gcache_header *out_hdr)
+{
+    struct stat fs;
+    void *mm;
+    int fd;
+
+    fd = open(path, O_RDONLY, 0);
+    if (fd == -1) {
+        if (errno != ENOENT)
+            perror("open() on glyph cache file");
+        return NULL;
+    }
+    /* So the size is not read in the middle of an append */
+    flock(fd, LOCK_SH);
+    if (fstat(fd, &fs) != 0 || fs.st_size < sizeof(*out_hdr)) {
+        fprintf(stderr, "[Warning] Glyph cache file '%s' is not valid\n", path);
+        close(fd);
+        return NULL;
+    }
+    mm = mmap(NULL, fs.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    /* The mapping keeps the file open, and the lock with it */
+    flock(fd, LOCK_UN);
+    close(fd);
+    if (mm == MAP_FAILED) {
+        perror("mmap() on glyph cache file");
+        return NULL;
+    }
+
+    memcpy(out_hdr, mm, sizeof(*out_hdr));
+    if (memcmp(out_hdr->magic, GCACHE_MAGIC, sizeof(out_hdr->magic)) != 0 || out_hdr->format != GCACHE_FORMAT) {
+        fprintf(stderr, "[Warning] Glyph cache file '%s' is not valid\n", path);
+        munmap(mm, fs.st_size);
+        return NULL;
+    }
+    *out_size = fs.st_size;
+    return mm;
+}
+
+static void gcache_index_rec(void *arg, const uint8_t *map, size_t off, const struct gcache_rec *rh)
+{
+    struct hmap *index = arg;
+    *hmap_put(index, map + off + sizeof(*rh), rh->key_len) = (void*)(intptr_t)off;
+}
+
+static void gcache_file_open(struct gcache_file *f, const char *fontpath)
+{
+    struct gcache_header want, hdr;
+    uint64_t font_hash = font_get_file_hash(fontpath);
+    char path[strlen(gcache_dir) + 32];
+
+    snprintf(path, sizeof(path), "%s/%016" PRIx64 ".v2g", gcache_dir, font_hash);
+    *f = (struct gcache_file){
+        .fontpath = strdup(fontpath),
+        .path = strdup(path),
+        .font_hash = font_hash,
+        .index = hmap_create(1024, HMAPFLAG_NONE),
+        .pending_index = hmap_create(256, HMAPFLAG_COPYKEY),
+    };
+    assert(f->fontpath && f->path && f->index && f->pending_index);
+    strbuf_init(&f->pending);
+
+    f->map = gcache_map(path, &f->map_size, &hdr);
+    if (f->map == NULL)
+        return;
+
+    /* Written by another version, it will be replaced */
+    gcache_make_header(font_hash, &want);
+    if (memcmp(&hdr, &want, sizeof(hdr)) != 0) {
+        munmap((void*)f->map, f->map_size);
+        f->map = NULL;
+        return;
+    }
+    f->valid_size = gcache_scan(f->map, f->map_size, gcache_index_rec, f->index);
+}
+
+/* Returns the cache of the font, opening it on the 1st call. The lock must be held */
+static struct gcache_file *gcache_file_get(const char *fontpath)
+{
+    for (int i = 0; i < files_count; i++) {
+        if (strcmp(files[i].fontpath, fontpath) == 0)
+            return &files[i];
+    }
+
+    assert(files_count < ARRSIZE(files));
+    gcache_file_open(&files[files_count], fontpath);
+    return &files[files_count++];
+}
+
+static struct gcache_glyph *gcache_copy_glyphs(const uint8_t *rec, const struct gcache_rec *rh, int *out_count)
+{
+    /* Not NULL even if there are no glyphs, because that means a miss */
+    struct gcache_glyph *glyphs = malloc(rh->count * sizeof(*glyphs) + 1);
+    assert(glyphs);
+    memcpy(glyphs, rec + sizeof(*rh) + rh->key_len, rh->count * sizeof(*glyphs));
+    *out_count = rh->count;
+    return glyphs;
+}
+
+struct gcache_glyph *gcache_get(const char *fontpath, const char *text, int text_len, int fs, bool kern, int *out_count)
+{
+    struct gcache_glyph *glyphs = NULL;
+    struct gcache_file *f;
+    struct gcache_rec rh;
+    struct strbuf key;
+    void **val;
+
+    if (gcache_dir == NULL)
+        return NULL;
+
+    strbuf_init(&key);
+    gcache_make_key(text, text_len, fs, kern, &key);
+
+    pthread_mutex_lock(&files_lock);
+    f = gcache_file_get(fontpath);
+    if ((val = hmap_get(f->index, strbuf_data(&key), key.len))) {
+        size_t off = (intptr_t)*val;
+        gcache_rec_at(f->map, f->map_size, off, &rh);
+        glyphs = gcache_copy_glyphs(f->map + off, &rh, out_count);
+    } else if ((val = hmap_get(f->pending_index, strbuf_data(&key), key.len))) {
+        const uint8_t *rec = (const uint8_t*)strbuf_data(&f->pending) + (intptr_t)*val - 1;
+        memcpy(&rh, rec, sizeof(rh));
+        glyphs = gcache_copy_glyphs(rec, &rh, out_count);
+    }
+    pthread_mutex_unlock(&files_lock);
+
+    strbuf_free(&key);
+    atomic_fetch_add(glyphs ? &gcache_hits : &gcache_misses, 1);
+    return glyphs;
+}
+
+void gcache_put(const char *fontpath, const char *text, int text_len, int fs, bool kern,
+        const struct gcache_glyph *glyphs, int count)
+{
+    struct gcache_file *f;
+    struct strbuf key;
+    struct gcache_rec rh = { .count = count };
+
+    if (gcache_dir == NULL)
+        return;
+
+    strbuf_init(&key);
+    gcache_make_key(text, text_len, fs, kern, &key);
+    rh.key_len = key.len;
+    rh.size = sizeof(rh) + key.len + count * sizeof(*glyphs);
+
+    pthread_mutex_lock(&files_lock);
+    f = gcache_file_get(fontpath);
+    void **val = hmap_put(f->pending_index, strbuf_data(&key), key.len);
+    if (*val == NULL) {
+        /* Another thread could have shaped the same text since our lookup */
+        *val = (void*)(intptr_t)(f->pending.len + 1);
+        GCACHE_APPEND(&f->pending, rh);
+        strbuf_append(&f->pending, strbuf_data(&key), key.len);
+        strbuf_append(&f->pending, (const char*)glyphs, count * sizeof(*glyphs));
+        f->pending_count++;
+    }
+    pthread_mutex_unlock(&files_lock);
+
+    strbuf_free(&key);
+}
+
+static int gcache_write_all(int fd, const void *data, size_t len)
+{
+    const char *p = data;
+
+    while (len > 0) {
+        ssize_t w = write(fd, p, len);
+        if (w < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        p += w;
+        len -= w;
+    }
+    return 0;
+}
+
+/* Writes hdr and the records into a new file, and moves it to path */
+static int gcache_replace(const char *path, const struct gcache_header *hdr, const void *recs, size_t recs_len)
+{
+    char tmppath[strlen(path) + 8];
+    int fd;
+
+    snprintf(tmppath, sizeof(tmppath), "%s.XXXXXX", path);
+    fd = mkstemp(tmppath);
+    if (fd == -1) {
+        perror("Failed to create the new glyph cache file");
+        return -1;
+    }
+    fchmod(fd, 0644);
+    if (gcache_write_all(fd, hdr, sizeof(*hdr)) != 0 || gcache_write_all(fd, recs, recs_len) != 0 ||
+            fsync(fd) != 0) {
+        perror("Failed to write the glyph cache file");
+        close(fd);
+        unlink(tmppath);
+        return -1;
+    }
+    close(fd);
+
+    /* Readers that have the old file open keep using it */
+    if (rename(tmppath, path) != 0) {
+        perror("rename() on glyph cache file");
+        unlink(tmppath);
+        return -1;
+    }
+    return 0;
+}
+
+/* Opens the file at path and takes the exclusive lock on it, its stat is stored in out_fs.
+ * The file can be replaced by another run while waiting for the lock, then the
+ * one that is at path now is opened. Returns -1 on error */
+static int gcache_open_locked(const char *path, int flags, struct stat *out_fs)
+{
+    struct stat ps;
+    int fd;
+
+    for (;;) {
+        fd = open(path, flags, 0644);
+        if (fd == -1)
+            return -1;
+        if (flock(fd, LOCK_EX) != 0 || fstat(fd, out_fs) != 0) {
+            close(fd);
+            return -1;
+        }
+        if (stat(path, &ps) == 0 && ps.st_dev == out_fs->st_dev && ps.st_ino == out_fs->st_ino)
+            return fd;
+        close(fd);
+    }
+}
+
+/* Appends the new records to the file, or replaces it, if it was not valid */
+static int gcache_file_write(struct gcache_file *f)
+{
+    struct gcache_header want, hdr;
+    struct stat fs;
+    int fd, r = 0;
+
+    gcache_make_header(f->font_hash, &want);
+
+    /* Other runs can append to it at the same time */
+    fd = gcache_open_locked(f->path, O_RDWR | O_CREAT, &fs);
+    if (fd == -1) {
+        perror("open() on glyph cache file");
+        return -1;
+    }
+
+    if (fs.st_size < sizeof(hdr) || pread(fd, &hdr, sizeof(hdr), 0) != sizeof(hdr) ||
+            memcmp(&hdr, &want, sizeof(hdr)) != 0) {
+        /* New, or written by another version */
+        r = gcache_replace(f->path, &want, strbuf_data(&f->pending), f->pending.len);
+        close(fd);
+        return r;
+    }
+
+    /* Drop a broken tail, if nobody appended since we looked at it, otherwise
+     * the new records would be after it, where they are never read */
+    if (f->map && fs.st_size == f->map_size && f->valid_size < f->map_size)
+        r = ftruncate(fd, f->valid_size);
+    if (r == 0 && lseek(fd, 0, SEEK_END) != -1)
+        r = gcache_write_all(fd, strbuf_data(&f->pending), f->pending.len);
+    else
+        r = -1;
+    if (r != 0)
+        perror("Failed to append to the glyph cache file");
+    close(fd);
+    return r;
+}
+
+void gcache_init(const char *dir)
+{
+    if (dir == NULL)
+        return;
+    if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+        perror("Failed to create the glyph cache directory");
+        return;
+    }
+    gcache_dir = strdup(dir);
+    atomic_init(&gcache_hits, 0);
+    atomic_init(&gcache_misses, 0);
+}
+
+void gcache_dinit()
+{
+    if (gcache_dir == NULL)
+        return;
+
+    printf("Glyph cache: %ld hits, %ld misses\n", (long)atomic_load(&gcache_hits), (long)atomic_load(&gcache_misses));
+    for (int i = 0; i < files_count; i++) {
+        struct gcache_file *f = &files[i];
+
+        if (f->pending_count > 0 && gcache_file_write(f) != 0)
+            fprintf(stderr, "[Warning] The glyph cache of '%s' could not be saved\n", f->fontpath);
+
+        /* The index points into the map */
+        hmap_destroy(f->index);
+        if (f->map)
+            munmap((void*)f->map, f->map_size);
+        hmap_destroy(f->pending_index);
+        strbuf_free(&f->pending);
+        free(f->fontpath);
+        free(f->path);
+    }
+    files_count = 0;
+    free(gcache_dir);
+    gcache_dir = NULL;
+}
+
+/* What the tool counts */
+struct gcache_stats {
+    struct hmap *keys; /* key -> offset of the newest record with it */
+    int64_t records, glyphs;
+};
+
+static void gcache_stat_rec(void *arg, const uint8_t *map, size_t off, const struct gcache_rec *rh)
+{
+    struct gcache_stats *st = arg;
+    st->records++;
+    st->glyphs += rh->count;
+    *hmap_put(st->keys, map + off + sizeof(*rh), rh->key_len) = (void*)(intptr_t)off;
+}
+
+/* Keeps the newest records with a unique key, up to max bytes. Returns the new size */
+static size_t gcache_prune(const uint8_t *map, size_t valid_size, const struct gcache_stats *st,
+        size_t max, struct strbuf *out)
+{
+    size_t *offs = malloc(st->keys->count * sizeof(*offs));
+    int64_t n = 0, first;
+    size_t total = 0;
+    struct gcache_rec rh;
+
+    assert(offs);
+    /* Only the newest record of a key is kept, those are in file order in the map */
+    for (size_t off = sizeof(struct gcache_header); off < valid_size; off += rh.size) {
+        gcache_rec_at(map, valid_size, off, &rh);
+        void **val = hmap_get(st->keys, map + off + sizeof(rh), rh.key_len);
+        if ((intptr_t)*val == off)
+            offs[n++] = off;
+    }
+
+    /* Newest first, until it is full */
+    for (first = n; first > 0; first--) {
+        gcache_rec_at(map, valid_size, offs[first - 1], &rh);
+        if (total + rh.size > max)
+            break;
+        total += rh.size;
+    }
+    for (int64_t i = first; i < n; i++) {
+        gcache_rec_at(map, valid_size, offs[i], &rh);
+        strbuf_append(out, (const char*)map + offs[i], rh.size);
+    }
+
+    free(offs);
+    return out->len;
+}
+
+int gcache_tool(const char *path, int prune_mib)
+{
+    struct gcache_header hdr;
+    struct gcache_stats st = {0};
+    const uint8_t *map;
+    size_t size, valid_size;
+    int r = 0;
+
+    map = gcache_map(path, &size, &hdr);
+    if (map == NULL) {
+        printf("Cannot read glyph cache file '%s'\n", path);
+        return -1;
+    }
+    st.keys = hmap_create(1024, HMAPFLAG_NONE);
+    assert(st.keys);
+    valid_size = gcache_scan(map, size, gcache_stat_rec, &st);
+
+    printf("Font hash: %016" PRIx64 "\n", hdr.font_hash);
+    printf("Written by: %.*s, shaping version %u\n", (int)sizeof(hdr.lib_versions), hdr.lib_versions, hdr.shape_version);
+    printf("Size: %zu bytes, %zu of them after the last valid record\n", size, size - valid_size);
+    printf("Records: %" PRId64 ", %" PRId64 " of them duplicates\n", st.records, st.records - st.keys->count);
+    printf("Glyphs: %" PRId64 "\n", st.glyphs);
+
+    if (prune_mib > 0) {
+        struct strbuf recs;
+        struct stat fs;
+        /* Runs appending to it wait until it is replaced */
+        int fd = gcache_open_locked(path, O_RDONLY, &fs);
+
+        if (fd == -1) {
+            perror("Failed to lock the glyph cache file");
+            r = -1;
+        } else if (fs.st_size != size) {
+            printf("The file was changed while reading it, not pruning it\n");
+            r = -1;
+        } else {
+            strbuf_init(&recs);
+            gcache_prune(map, valid_size, &st, (size_t)prune_mib << 20, &recs);
+            r = gcache_replace(path, &hdr, strbuf_data(&recs), recs.len);
+            if (r == 0)
+                printf("Pruned to %zu bytes\n", sizeof(hdr) + recs.len);
+            strbuf_free(&recs);
+        }
+        if (fd != -1)
+            close(fd);
+    }
+
+    hmap_destroy(st.keys);
+    munmap((void*)map, size);
+    return r;
+}
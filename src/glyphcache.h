@@ -0,0 +1,34 @@
+#ifndef _VTT2ASS_GLYPHCACHE_H
+#define _VTT2ASS_GLYPHCACHE_H
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Bump this when the shaping in te_create_obj() changes, so the older results are not used */
+#define GCACHE_SHAPE_VERSION 1
+
+/* What is kept of a shaped glyph */
+struct gcache_glyph {
+    uint32_t cluster; /* Byte offset of the text the glyph belongs to */
+    int32_t x_advance; /* In 1/64 pixels */
+};
+
+/* The shaping results of strings, kept between runs in a file per font, named after the
+ * hash of the font file. The files are mapped the first time a font is used, and the new
+ * results are appended to them at the end, so many runs can share a directory.
+ * Without gcache_init(), nothing is cached */
+void gcache_init(const char *dir);
+/* Appends the new results to the files, then frees everything */
+void gcache_dinit();
+
+/* Returns the glyphs of text_len bytes of text, shaped with the font at fs, in a malloc'd array.
+ * Returns NULL if it is not cached. Thread safe */
+struct gcache_glyph *gcache_get(const char *fontpath, const char *text, int text_len, int fs, bool kern, int *out_count);
+/* Stores the shaping result of the text. Thread safe */
+void gcache_put(const char *fontpath, const char *text, int text_len, int fs, bool kern,
+        const struct gcache_glyph *glyphs, int count);
+
+/* Prints what is in a cache file. If prune_mib is not 0, rewrites it without the duplicate
+ * records, and without the oldest ones that do not fit in prune_mib MiB. Returns -1 on error */
+int gcache_tool(const char *path, int prune_mib);
+
+#endif /* _VTT2ASS_GLYPHCACHE_H */
@@ -0,0 +1,136 @@
+#include "hmap.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+/* Grow when more than 3/4 is used */
+#define HMAP_FULL(cap, count) ((count) * 4 >= (cap) * 3)
+
+struct hmap *hmap_create(int64_t init_size, enum hmap_flags flags)
+{
+    struct hmap *hm = calloc(1, sizeof(*hm));
+    if (hm == NULL)
+        return NULL;
+
+    hm->cap = 8;
+    while (HMAP_FULL(hm->cap, init_size))
+        hm->cap *= 2;
+    hm->flags = flags;
+
+    hm->entries = calloc(hm->cap, sizeof(*hm->entries));
+    if (hm->entries == NULL) {
+        free(hm);
+        return NULL;
+    }
+    return hm;
+}
+
+void hmap_destroy(struct hmap *hm)
+{
+    for (int64_t i = 0; i < hm->cap; i++) {
+        struct hmap_entry *e = &hm->entries[i];
+        if (e->key == NULL)
+            continue;
+
+        if (hm->free_fn)
+            hm->free_fn(e->val);
+        if (hm->flags & HMAPFLAG_COPYKEY)
+            free((void*)e->key);
+    }
+
+    free(hm->entries);
+    free(hm);
+}
+
+void hmap_set_free_fn(struct hmap *hm, hmap_free_fn fn)
+{
+    hm->free_fn = fn;
+}
+
+uint64_t hmap_hash(const void *key, size_t key_len)
+{
+    /* FNV-1a */
+    const uint8_t *k = key;
+    uint64_t h = 0xcbf29ce484222325ull;
+
+    for (size_t i = 0; i < key_len; i++) {
+        h ^= k[i];
+        h *= 0x100000001b3ull;
+    }
+    /* The low bits are used as the index, so mix the high bits into them */
+    h ^= h >> 32;
+    return h ^ (h >> 16);
+}
+
+/* Returns the entry of the key, or the empty entry where it should go */
+static struct hmap_entry *hmap_find(const struct hmap *hm, const void *key, size_t key_len, uint64_t hash)
+{
+    int64_t mask = hm->cap - 1;
+
+    for (int64_t i = hash & mask;; i = (i + 1) & mask) {
+        struct hmap_entry *e = &hm->entries[i];
+
+        if (e->key == NULL)
+            return e;
+        if (e->hash == hash && e->key_len == key_len && memcmp(e->key, key, key_len) == 0)
+            return e;
+    }
+}
+
+static void hmap_grow(struct hmap *hm)
+{
+    struct hmap_entry *old = hm->entries;
+    int64_t old_cap = hm->cap;
+
+    hm->cap *= 2;
+    hm->entries = calloc(hm->cap, sizeof(*hm->entries));
+    assert(hm->entries);
+
+    for (int64_t i = 0; i < old_cap; i++) {
+        if (old[i].key == NULL)
+            continue;
+        *hmap_find(hm, old[i].key, old[i].key_len, old[i].hash) = old[i];
+    }
+    free(old);
+}
+
+void **hmap_get(const struct hmap *hm, const void *key, size_t key_len)
+{
+    struct hmap_entry *e = hmap_find(hm, key, key_len, hmap_hash(key, key_len));
+    if (e->key == NULL)
+        return NULL;
+    return &e->val;
+}
+
+void **hmap_put(struct hmap *hm, const void *key, size_t key_len)
+{
+    uint64_t hash = hmap_hash(key, key_len);
+    struct hmap_entry *e = hmap_find(hm, key, key_len, hash);
+
+    if (e->key)
+        return &e->val;
+
+    if (HMAP_FULL(hm->cap, hm->count + 1)) {
+        hmap_grow(hm);
+        e = hmap_find(hm, key, key_len, hash);
+    }
+
+    if (hm->flags & HMAPFLAG_COPYKEY) {
+        /* +1 so an empty key still gets a non NULL pointer */
+        void *kcopy = malloc(key_len + 1);
+        assert(kcopy);
+        memcpy(kcopy, key, key_len);
+        key = kcopy;
+    }
+
+    *e = (struct hmap_entry){
+        .key = key,
+        .key_len = key_len,
+        .hash = hash,
+        .val = NULL,
+    };
+    hm->count++;
+    return &e->val;
+}
@@ -0,0 +1,43 @@
+#ifndef _VTT2ASS_HMAP_H
+#define _VTT2ASS_HMAP_H
+#include <stdint.h>
+#include <stddef.h>
+
+enum hmap_flags {
+    HMAPFLAG_NONE       = 0u,       /* Only the key pointer is stored, the key must outlive the map */
+    HMAPFLAG_COPYKEY    = 1u << 0,  /* Heap alloc a copy of the key */
+};
+
+typedef void(*hmap_free_fn)(void *val);
+
+struct hmap_entry {
+    const void *key; /* NULL if the entry is empty */
+    size_t key_len;
+    uint64_t hash;
+    void *val;
+};
+
+/* Open addressing hash map with linear probing, from byte string keys to pointers */
+struct hmap {
+    struct hmap_entry *entries;
+    int64_t cap; /* Always a power of 2 */
+    int64_t count;
+    hmap_free_fn free_fn; /* Called on each value on hmap_destroy */
+    enum hmap_flags flags;
+};
+
+struct hmap *hmap_create(int64_t init_size, enum hmap_flags flags);
+void hmap_destroy(struct hmap *hm);
+void hmap_set_free_fn(struct hmap *hm, hmap_free_fn fn);
+
+uint64_t hmap_hash(const void *key, size_t key_len);
+
+/* Returns a pointer to the value of the key, or NULL if it is not in the map */
+void **hmap_get(const struct hmap *hm, const void *key, size_t key_len);
+/* Returns a pointer to the value of the key, inserting it with a NULL value if it is not in the map */
+void **hmap_put(struct hmap *hm, const void *key, size_t key_len);
+
+#define hmap_get_str(hm, str) hmap_get(hm, str, strlen(str))
+#define hmap_put_str(hm, str) hmap_put(hm, str, strlen(str))
+
+#endif /* _VTT2ASS_HMAP_H */
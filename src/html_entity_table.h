@@ -0,0 +1,4207 @@
+/* Generated by tools/gen_phash.py from tools/html_entities.txt, do not edit */
+#ifndef _VTT2ASS_HTML_ENTITY_TABLE_H
+#define _VTT2ASS_HTML_ENTITY_TABLE_H
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+struct html_entity_entry {
+    const char *key; /* NULL for an empty slot */
+    uint8_t key_len;
+    const char * val;
+};
+
+static const uint32_t html_entity_seeds[558] = {
+    1, 5, 6, 2, 2, 2, 2, 2,
+    8, 3, 1, 3, 2, 4, 3, 7,
+    11, 1, 2, 7, 5, 3, 1, 8,
+    9, 4, 2, 1, 29, 1, 2, 2,
+    1, 59, 0, 2, 4, 1, 59, 2,
+    14, 2, 2, 5, 17, 1, 9, 6,
+    1, 1, 2, 23, 3, 1, 29, 1,
+    21, 9, 4, 1, 3, 1, 1, 3,
+    0, 1, 1, 3, 13, 6, 9, 2,
+    1, 13, 1, 3, 14, 7, 1, 2,
+    8, 2, 1, 4, 2, 7, 7, 6,
+    2, 1, 1, 1, 2, 1, 1, 1,
+    14, 4, 0, 64, 4, 1, 2, 13,
+    1, 1, 1, 21, 4, 1, 1, 1,
+    2, 27, 3, 7, 48, 4, 2, 49,
+    18, 9, 2, 1, 1, 4, 4, 14,
+    3, 12, 5, 4, 1, 7, 1, 2,
+    14, 2, 8, 3, 6, 10, 3, 2,
+    2, 1, 2, 1, 5, 1, 0, 1,
+    1, 2, 1, 3, 4, 1, 0, 1,
+    2, 3, 2, 8, 55, 6, 2, 2,
+    5, 9, 4, 1, 2, 6, 2, 3,
+    9, 1, 5, 5, 3, 1, 18, 4,
+    4, 1, 1, 5, 1, 2, 68, 2,
+    4, 39, 9, 1, 5, 2, 17, 2,
+    7, 5, 65, 2, 13, 9, 1, 8,
+    3, 2, 1, 3, 2, 5, 2, 4,
+    10, 1, 1, 10, 1, 5, 1, 1,
+    2, 16, 1, 3, 1, 1, 3, 1,
+    32, 3, 16, 2, 5, 1, 2, 10,
+    16, 4, 1, 19, 1, 38, 17, 2,
+    2, 2, 2, 4, 7, 10, 2, 9,
+    1, 5, 6, 8, 2, 5, 4, 10,
+    10, 2, 4, 1, 3, 1, 1, 1,
+    7, 5, 7, 1, 2, 9, 10, 1,
+    5, 2, 2, 2, 1, 2, 1, 2,
+    2, 9, 5, 1, 2, 3, 1, 19,
+    4, 1, 1, 1, 8, 3, 3, 1,
+    19, 22, 5, 1, 1, 9, 3, 3,
+    1, 15, 42, 2, 5, 9, 1, 65,
+    13, 12, 1, 3, 1, 21, 3, 9,
+    5, 10, 2, 6, 10, 2, 5, 4,
+    64, 3, 67, 3, 10, 4, 22, 48,
+    2, 4, 2, 9, 4, 1, 2, 3,
+    1, 9, 2, 13, 0, 5, 4, 0,
+    13, 9, 13, 11, 1, 14, 1, 3,
+    4, 7, 3, 3, 1, 1, 2, 5,
+    16, 6, 3, 3, 9, 14, 2, 0,
+    3, 64, 12, 68, 67, 1, 75, 2,
+    20, 2, 1, 3, 2, 1, 74, 1,
+    42, 4, 29, 17, 2, 2, 1, 12,
+    13, 1, 5, 4, 13, 11, 5, 8,
+    2, 7, 6, 2, 25, 11, 67, 4,
+    4, 1, 5, 1, 8, 29, 1, 1,
+    29, 1, 1, 3, 1, 1, 2, 2,
+    1, 7, 10, 4, 6, 4, 11, 5,
+    10, 2, 2, 3, 5, 7, 1, 10,
+    2, 15, 42, 3, 13, 4, 1, 1,
+    75, 4, 27, 4, 1, 57, 0, 1,
+    3, 4, 6, 26, 2, 12, 3, 3,
+    65, 2, 19, 1, 2, 30, 4, 9,
+    4, 9, 9, 15, 2, 1, 1, 2,
+    18, 11, 30, 8, 8, 0, 2, 20,
+    79, 11, 1, 2, 21, 8, 11, 1,
+    37, 7, 38, 11, 2, 9, 32, 2,
+    12, 1, 1, 1, 6, 4, 5, 10,
+    1, 6, 2, 1, 1, 17, 61, 1,
+    2, 3, 3, 11, 11, 7, 3, 8,
+    6, 18, 3, 11, 5, 2, 1, 10,
+    1, 1, 2, 1, 58, 27,
+};
+
+static const struct html_entity_entry html_entity_table[4096] = {
+    { "upuparrows;", 11, "\xe2\x87\x88" },
+    { NULL },
+    { "DownLeftVector;", 15, "\xe2\x86\xbd" },
+    { "ntlg;", 5, "\xe2\x89\xb8" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "ccupssm;", 8, "\xe2\xa9\x90" },
+    { "isin;", 5, "\xe2\x88\x88" },
+    { "Ocirc", 5, "\xc3\x94" },
+    { NULL },
+    { "perp;", 5, "\xe2\x8a\xa5" },
+    { NULL },
+    { "Ugrave;", 7, "\xc3\x99" },
+    { "sdot;", 5, "\xe2\x8b\x85" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Ucirc", 5, "\xc3\x9b" },
+    { "epsiv;", 6, "\xcf\xb5" },
+    { "gsime;", 6, "\xe2\xaa\x8e" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "sstarf;", 7, "\xe2\x8b\x86" },
+    { "delta;", 6, "\xce\xb4" },
+    { "qopf;", 5, "\xf0\x9d\x95\xa2" },
+    { "mu;", 3, "\xce\xbc" },
+    { "nsupe;", 6, "\xe2\x8a\x89" },
+    { NULL },
+    { "UpTeeArrow;", 11, "\xe2\x86\xa5" },
+    { "Idot;", 5, "\xc4\xb0" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "osol;", 5, "\xe2\x8a\x98" },
+    { NULL },
+    { "clubs;", 6, "\xe2\x99\xa3" },
+    { "reg;", 4, "\xc2\xae" },
+    { "jsercy;", 7, "\xd1\x98" },
+    { "in;", 3, "\xe2\x88\x88" },
+    { NULL },
+    { "downdownarrows;", 15, "\xe2\x87\x8a" },
+    { "larrbfs;", 8, "\xe2\xa4\x9f" },
+    { "boxdL;", 6, "\xe2\x95\x95" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "breve;", 6, "\xcb\x98" },
+    { NULL },
+    { "eacute", 6, "\xc3\xa9" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Emacr;", 6, "\xc4\x92" },
+    { "horbar;", 7, "\xe2\x80\x95" },
+    { "boxvR;", 6, "\xe2\x95\x9e" },
+    { "Delta;", 6, "\xce\x94" },
+    { "boxdr;", 6, "\xe2\x94\x8c" },
+    { "thkap;", 6, "\xe2\x89\x88" },
+    { NULL },
+    { "sacute;", 7, "\xc5\x9b" },
+    { NULL },
+    { "eqslantless;", 12, "\xe2\xaa\x95" },
+    { NULL },
+    { "vcy;", 4, "\xd0\xb2" },
+    { "RightCeiling;", 13, "\xe2\x8c\x89" },
+    { "DiacriticalAcute;", 17, "\xc2\xb4" },
+    { NULL },
+    { NULL },
+    { "iocy;", 5, "\xd1\x91" },
+    { "lbrace;", 7, "\x7b" },
+    { "rceil;", 6, "\xe2\x8c\x89" },
+    { NULL },
+    { "ultri;", 6, "\xe2\x97\xb8" },
+    { "fscr;", 5, "\xf0\x9d\x92\xbb" },
+    { "NotPrecedesSlantEqual;", 22, "\xe2\x8b\xa0" },
+    { NULL },
+    { "puncsp;", 7, "\xe2\x80\x88" },
+    { "inodot;", 7, "\xc4\xb1" },
+    { "vartriangleleft;", 16, "\xe2\x8a\xb2" },
+    { "nvltrie;", 8, "\xe2\x8a\xb4\xe2\x83\x92" },
+    { "rppolint;", 9, "\xe2\xa8\x92" },
+    { "ncup;", 5, "\xe2\xa9\x82" },
+    { "sccue;", 6, "\xe2\x89\xbd" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "blk12;", 6, "\xe2\x96\x92" },
+    { NULL },
+    { "NotVerticalBar;", 15, "\xe2\x88\xa4" },
+    { "xlArr;", 6, "\xe2\x9f\xb8" },
+    { NULL },
+    { NULL },
+    { "xsqcup;", 7, "\xe2\xa8\x86" },
+    { NULL },
+    { "lpar;", 5, "\x28" },
+    { "rbrkslu;", 8, "\xe2\xa6\x90" },
+    { "nvap;", 5, "\xe2\x89\x8d\xe2\x83\x92" },
+    { NULL },
+    { NULL },
+    { "veebar;", 7, "\xe2\x8a\xbb" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "rpar;", 5, "\x29" },
+    { "plusmn", 6, "\xc2\xb1" },
+    { "NotLessEqual;", 13, "\xe2\x89\xb0" },
+    { NULL },
+    { "Wcirc;", 6, "\xc5\xb4" },
+    { "prnap;", 6, "\xe2\xaa\xb9" },
+    { "oror;", 5, "\xe2\xa9\x96" },
+    { "NotSubsetEqual;", 15, "\xe2\x8a\x88" },
+    { NULL },
+    { "Bernoullis;", 11, "\xe2\x84\xac" },
+    { NULL },
+    { "vsubnE;", 7, "\xe2\xab\x8b\xef\xb8\x80" },
+    { "wcirc;", 6, "\xc5\xb5" },
+    { "boxUl;", 6, "\xe2\x95\x9c" },
+    { NULL },
+    { "Ccaron;", 7, "\xc4\x8c" },
+    { "fjlig;", 6, "\x66\x6a" },
+    { "mcomma;", 7, "\xe2\xa8\xa9" },
+    { "OverBrace;", 10, "\xe2\x8f\x9e" },
+    { "starf;", 6, "\xe2\x98\x85" },
+    { NULL },
+    { "Jukcy;", 6, "\xd0\x84" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "naturals;", 9, "\xe2\x84\x95" },
+    { "lt;", 3, "\x3c" },
+    { "supsetneq;", 10, "\xe2\x8a\x8b" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "nrtrie;", 7, "\xe2\x8b\xad" },
+    { "Kscr;", 5, "\xf0\x9d\x92\xa6" },
+    { NULL },
+    { NULL },
+    { "Cacute;", 7, "\xc4\x86" },
+    { NULL },
+    { "urtri;", 6, "\xe2\x97\xb9" },
+    { NULL },
+    { "dfr;", 4, "\xf0\x9d\x94\xa1" },
+    { NULL },
+    { "gt;", 3, "\x3e" },
+    { "questeq;", 8, "\xe2\x89\x9f" },
+    { "IOcy;", 5, "\xd0\x81" },
+    { NULL },
+    { "lbbrk;", 6, "\xe2\x9d\xb2" },
+    { "Product;", 8, "\xe2\x88\x8f" },
+    { "sext;", 5, "\xe2\x9c\xb6" },
+    { "vBar;", 5, "\xe2\xab\xa8" },
+    { NULL },
+    { "filig;", 6, "\xef\xac\x81" },
+    { NULL },
+    { "mapstoleft;", 11, "\xe2\x86\xa4" },
+    { NULL },
+    { NULL },
+    { "imath;", 6, "\xc4\xb1" },
+    { "aleph;", 6, "\xe2\x84\xb5" },
+    { "fflig;", 6, "\xef\xac\x80" },
+    { "bNot;", 5, "\xe2\xab\xad" },
+    { "erarr;", 6, "\xe2\xa5\xb1" },
+    { NULL },
+    { NULL },
+    { "nsqsube;", 8, "\xe2\x8b\xa2" },
+    { "ecirc", 5, "\xc3\xaa" },
+    { NULL },
+    { "prop;", 5, "\xe2\x88\x9d" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "NotLessGreater;", 15, "\xe2\x89\xb8" },
+    { "qfr;", 4, "\xf0\x9d\x94\xae" },
+    { "eqvparsl;", 9, "\xe2\xa7\xa5" },
+    { NULL },
+    { NULL },
+    { "Racute;", 7, "\xc5\x94" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Igrave;", 7, "\xc3\x8c" },
+    { "OverBar;", 8, "\xe2\x80\xbe" },
+    { NULL },
+    { NULL },
+    { "ENG;", 4, "\xc5\x8a" },
+    { "boxhD;", 6, "\xe2\x95\xa5" },
+    { "ldca;", 5, "\xe2\xa4\xb6" },
+    { NULL },
+    { NULL },
+    { "Bopf;", 5, "\xf0\x9d\x94\xb9" },
+    { "simne;", 6, "\xe2\x89\x86" },
+    { "ngeq;", 5, "\xe2\x89\xb1" },
+    { NULL },
+    { "rtriltri;", 9, "\xe2\xa7\x8e" },
+    { "Pi;", 3, "\xce\xa0" },
+    { "thetasym;", 9, "\xcf\x91" },
+    { NULL },
+    { NULL },
+    { "ic;", 3, "\xe2\x81\xa3" },
+    { NULL },
+    { "lang;", 5, "\xe2\x9f\xa8" },
+    { "larr;", 5, "\xe2\x86\x90" },
+    { "percnt;", 7, "\x25" },
+    { NULL },
+    { "NoBreak;", 8, "\xe2\x81\xa0" },
+    { "euro;", 5, "\xe2\x82\xac" },
+    { NULL },
+    { "nsub;", 5, "\xe2\x8a\x84" },
+    { "vopf;", 5, "\xf0\x9d\x95\xa7" },
+    { NULL },
+    { "dtdot;", 6, "\xe2\x8b\xb1" },
+    { NULL },
+    { "gneq;", 5, "\xe2\xaa\x88" },
+    { NULL },
+    { NULL },
+    { "nleftrightarrow;", 16, "\xe2\x86\xae" },
+    { "Del;", 4, "\xe2\x88\x87" },
+    { "blacksquare;", 12, "\xe2\x96\xaa" },
+    { NULL },
+    { NULL },
+    { "tscr;", 5, "\xf0\x9d\x93\x89" },
+    { NULL },
+    { NULL },
+    { "iuml", 4, "\xc3\xaf" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "OpenCurlyQuote;", 15, "\xe2\x80\x98" },
+    { "sup1", 4, "\xc2\xb9" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "smid;", 5, "\xe2\x88\xa3" },
+    { NULL },
+    { "bot;", 4, "\xe2\x8a\xa5" },
+    { NULL },
+    { "Zopf;", 5, "\xe2\x84\xa4" },
+    { NULL },
+    { "sfr;", 4, "\xf0\x9d\x94\xb0" },
+    { "ring;", 5, "\xcb\x9a" },
+    { "ncaron;", 7, "\xc5\x88" },
+    { "nsupseteq;", 10, "\xe2\x8a\x89" },
+    { NULL },
+    { "varkappa;", 9, "\xcf\xb0" },
+    { "cent", 4, "\xc2\xa2" },
+    { "bigcup;", 7, "\xe2\x8b\x83" },
+    { NULL },
+    { "rightarrowtail;", 15, "\xe2\x86\xa3" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "PrecedesEqual;", 14, "\xe2\xaa\xaf" },
+    { NULL },
+    { NULL },
+    { "UpperRightArrow;", 16, "\xe2\x86\x97" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "xopf;", 5, "\xf0\x9d\x95\xa9" },
+    { "Uarrocir;", 9, "\xe2\xa5\x89" },
+    { "niv;", 4, "\xe2\x88\x8b" },
+    { "Auml;", 5, "\xc3\x84" },
+    { NULL },
+    { "nbsp;", 5, "\xc2\xa0" },
+    { "nsime;", 6, "\xe2\x89\x84" },
+    { NULL },
+    { "omicron;", 8, "\xce\xbf" },
+    { "vartriangleright;", 17, "\xe2\x8a\xb3" },
+    { NULL },
+    { "xharr;", 6, "\xe2\x9f\xb7" },
+    { "coloneq;", 8, "\xe2\x89\x94" },
+    { "Kfr;", 4, "\xf0\x9d\x94\x8e" },
+    { "DoubleVerticalBar;", 18, "\xe2\x88\xa5" },
+    { NULL },
+    { "scnE;", 5, "\xe2\xaa\xb6" },
+    { NULL },
+    { "roplus;", 7, "\xe2\xa8\xae" },
+    { "succsim;", 8, "\xe2\x89\xbf" },
+    { "yicy;", 5, "\xd1\x97" },
+    { "rsquor;", 7, "\xe2\x80\x99" },
+    { "latail;", 7, "\xe2\xa4\x99" },
+    { NULL },
+    { "Ncedil;", 7, "\xc5\x85" },
+    { NULL },
+    { "lambda;", 7, "\xce\xbb" },
+    { "bbrktbrk;", 9, "\xe2\x8e\xb6" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "khcy;", 5, "\xd1\x85" },
+    { NULL },
+    { NULL },
+    { "brvbar;", 7, "\xc2\xa6" },
+    { "Uacute;", 7, "\xc3\x9a" },
+    { "hopf;", 5, "\xf0\x9d\x95\x99" },
+    { NULL },
+    { "RoundImplies;", 13, "\xe2\xa5\xb0" },
+    { NULL },
+    { "iiiint;", 7, "\xe2\xa8\x8c" },
+    { "ddarr;", 6, "\xe2\x87\x8a" },
+    { NULL },
+    { NULL },
+    { "lcy;", 4, "\xd0\xbb" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "curlywedge;", 11, "\xe2\x8b\x8f" },
+    { "curvearrowleft;", 15, "\xe2\x86\xb6" },
+    { NULL },
+    { "NotDoubleVerticalBar;", 21, "\xe2\x88\xa6" },
+    { "cudarrl;", 8, "\xe2\xa4\xb8" },
+    { NULL },
+    { NULL },
+    { "gnapprox;", 9, "\xe2\xaa\x8a" },
+    { "nspar;", 6, "\xe2\x88\xa6" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Wscr;", 5, "\xf0\x9d\x92\xb2" },
+    { "Prime;", 6, "\xe2\x80\xb3" },
+    { NULL },
+    { "curarrm;", 8, "\xe2\xa4\xbc" },
+    { "Dscr;", 5, "\xf0\x9d\x92\x9f" },
+    { "rarrc;", 6, "\xe2\xa4\xb3" },
+    { "ulcorn;", 7, "\xe2\x8c\x9c" },
+    { NULL },
+    { "imagpart;", 9, "\xe2\x84\x91" },
+    { "supdot;", 7, "\xe2\xaa\xbe" },
+    { "popf;", 5, "\xf0\x9d\x95\xa1" },
+    { "subne;", 6, "\xe2\x8a\x8a" },
+    { "Upsilon;", 8, "\xce\xa5" },
+    { NULL },
+    { "scirc;", 6, "\xc5\x9d" },
+    { "succneqq;", 9, "\xe2\xaa\xb6" },
+    { "lnap;", 5, "\xe2\xaa\x89" },
+    { NULL },
+    { "mdash;", 6, "\xe2\x80\x94" },
+    { "cularrp;", 8, "\xe2\xa4\xbd" },
+    { "dbkarow;", 8, "\xe2\xa4\x8f" },
+    { "leftharpoondown;", 16, "\xe2\x86\xbd" },
+    { "xhArr;", 6, "\xe2\x9f\xba" },
+    { NULL },
+    { NULL },
+    { "Abreve;", 7, "\xc4\x82" },
+    { NULL },
+    { "not;", 4, "\xc2\xac" },
+    { "hscr;", 5, "\xf0\x9d\x92\xbd" },
+    { NULL },
+    { "ccedil", 6, "\xc3\xa7" },
+    { "HumpDownHump;", 13, "\xe2\x89\x8e" },
+    { NULL },
+    { NULL },
+    { "exist;", 6, "\xe2\x88\x83" },
+    { "rcy;", 4, "\xd1\x80" },
+    { "DoubleLeftRightArrow;", 21, "\xe2\x87\x94" },
+    { "ncedil;", 7, "\xc5\x86" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "simgE;", 6, "\xe2\xaa\xa0" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "infin;", 6, "\xe2\x88\x9e" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "clubsuit;", 9, "\xe2\x99\xa3" },
+    { "Gcirc;", 6, "\xc4\x9c" },
+    { "nlArr;", 6, "\xe2\x87\x8d" },
+    { NULL },
+    { "circeq;", 7, "\xe2\x89\x97" },
+    { "Cap;", 4, "\xe2\x8b\x92" },
+    { "lrhar;", 6, "\xe2\x87\x8b" },
+    { NULL },
+    { "sup3", 4, "\xc2\xb3" },
+    { "LeftUpDownVector;", 17, "\xe2\xa5\x91" },
+    { "larrlp;", 7, "\xe2\x86\xab" },
+    { "Zdot;", 5, "\xc5\xbb" },
+    { "xi;", 3, "\xce\xbe" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "lsh;", 4, "\xe2\x86\xb0" },
+    { "sigma;", 6, "\xcf\x83" },
+    { "supsub;", 7, "\xe2\xab\x94" },
+    { NULL },
+    { "Iukcy;", 6, "\xd0\x86" },
+    { "dharr;", 6, "\xe2\x87\x82" },
+    { "DD;", 3, "\xe2\x85\x85" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Sc;", 3, "\xe2\xaa\xbc" },
+    { NULL },
+    { "nlE;", 4, "\xe2\x89\xa6\xcc\xb8" },
+    { "rfloor;", 7, "\xe2\x8c\x8b" },
+    { "disin;", 6, "\xe2\x8b\xb2" },
+    { "acy;", 4, "\xd0\xb0" },
+    { NULL },
+    { "uacute;", 7, "\xc3\xba" },
+    { NULL },
+    { NULL },
+    { "Ubreve;", 7, "\xc5\xac" },
+    { "iacute", 6, "\xc3\xad" },
+    { "zhcy;", 5, "\xd0\xb6" },
+    { "mldr;", 5, "\xe2\x80\xa6" },
+    { "CupCap;", 7, "\xe2\x89\x8d" },
+    { "jopf;", 5, "\xf0\x9d\x95\x9b" },
+    { NULL },
+    { "angmsdaa;", 9, "\xe2\xa6\xa8" },
+    { NULL },
+    { "SmallCircle;", 12, "\xe2\x88\x98" },
+    { "gscr;", 5, "\xe2\x84\x8a" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Yuml;", 5, "\xc5\xb8" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "rho;", 4, "\xcf\x81" },
+    { "TRADE;", 6, "\xe2\x84\xa2" },
+    { "Lopf;", 5, "\xf0\x9d\x95\x83" },
+    { "ubreve;", 7, "\xc5\xad" },
+    { NULL },
+    { "UpEquilibrium;", 14, "\xe2\xa5\xae" },
+    { "bprime;", 7, "\xe2\x80\xb5" },
+    { NULL },
+    { "REG;", 4, "\xc2\xae" },
+    { NULL },
+    { "ssetmn;", 7, "\xe2\x88\x96" },
+    { "nlsim;", 6, "\xe2\x89\xb4" },
+    { "cdot;", 5, "\xc4\x8b" },
+    { "Uring;", 6, "\xc5\xae" },
+    { NULL },
+    { "nleftarrow;", 11, "\xe2\x86\x9a" },
+    { NULL },
+    { "exponentiale;", 13, "\xe2\x85\x87" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Xscr;", 5, "\xf0\x9d\x92\xb3" },
+    { "pointint;", 9, "\xe2\xa8\x95" },
+    { NULL },
+    { "notinvc;", 8, "\xe2\x8b\xb6" },
+    { "VerticalLine;", 13, "\x7c" },
+    { "prap;", 5, "\xe2\xaa\xb7" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "tshcy;", 6, "\xd1\x9b" },
+    { "qscr;", 5, "\xf0\x9d\x93\x86" },
+    { NULL },
+    { "DoubleLeftTee;", 14, "\xe2\xab\xa4" },
+    { "hoarr;", 6, "\xe2\x87\xbf" },
+    { NULL },
+    { "boxtimes;", 9, "\xe2\x8a\xa0" },
+    { "Oacute", 6, "\xc3\x93" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "NotCupCap;", 10, "\xe2\x89\xad" },
+    { NULL },
+    { "smallsetminus;", 14, "\xe2\x88\x96" },
+    { "Proportion;", 11, "\xe2\x88\xb7" },
+    { NULL },
+    { "Oopf;", 5, "\xf0\x9d\x95\x86" },
+    { "egrave;", 7, "\xc3\xa8" },
+    { NULL },
+    { "spadesuit;", 10, "\xe2\x99\xa0" },
+    { "gneqq;", 6, "\xe2\x89\xa9" },
+    { NULL },
+    { "colone;", 7, "\xe2\x89\x94" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Gscr;", 5, "\xf0\x9d\x92\xa2" },
+    { NULL },
+    { "zcy;", 4, "\xd0\xb7" },
+    { NULL },
+    { NULL },
+    { "LeftDownVector;", 15, "\xe2\x87\x83" },
+    { "ExponentialE;", 13, "\xe2\x85\x87" },
+    { "minusb;", 7, "\xe2\x8a\x9f" },
+    { NULL },
+    { "oacute", 6, "\xc3\xb3" },
+    { NULL },
+    { "succnapprox;", 12, "\xe2\xaa\xba" },
+    { "times;", 6, "\xc3\x97" },
+    { "supsup;", 7, "\xe2\xab\x96" },
+    { NULL },
+    { "aring;", 6, "\xc3\xa5" },
+    { NULL },
+    { "auml;", 5, "\xc3\xa4" },
+    { NULL },
+    { "boxh;", 5, "\xe2\x94\x80" },
+    { NULL },
+    { "Eacute", 6, "\xc3\x89" },
+    { "RightUpVector;", 14, "\xe2\x86\xbe" },
+    { "DownTeeArrow;", 13, "\xe2\x86\xa7" },
+    { "sqsubset;", 9, "\xe2\x8a\x8f" },
+    { "Lcedil;", 7, "\xc4\xbb" },
+    { NULL },
+    { NULL },
+    { "utdot;", 6, "\xe2\x8b\xb0" },
+    { NULL },
+    { NULL },
+    { "hyphen;", 7, "\xe2\x80\x90" },
+    { NULL },
+    { "NotTildeTilde;", 14, "\xe2\x89\x89" },
+    { "Longleftarrow;", 14, "\xe2\x9f\xb8" },
+    { "Map;", 4, "\xe2\xa4\x85" },
+    { "jmath;", 6, "\xc8\xb7" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "leftrightharpoons;", 18, "\xe2\x87\x8b" },
+    { "larrsim;", 8, "\xe2\xa5\xb3" },
+    { NULL },
+    { "rlm;", 4, "" },
+    { "lhard;", 6, "\xe2\x86\xbd" },
+    { NULL },
+    { NULL },
+    { "lessapprox;", 11, "\xe2\xaa\x85" },
+    { "LeftAngleBracket;", 17, "\xe2\x9f\xa8" },
+    { NULL },
+    { "Eta;", 4, "\xce\x97" },
+    { "bnequiv;", 8, "\xe2\x89\xa1\xe2\x83\xa5" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "omacr;", 6, "\xc5\x8d" },
+    { NULL },
+    { "scaron;", 7, "\xc5\xa1" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Jcirc;", 6, "\xc4\xb4" },
+    { "vnsup;", 6, "\xe2\x8a\x83\xe2\x83\x92" },
+    { "tint;", 5, "\xe2\x88\xad" },
+    { "Exists;", 7, "\xe2\x88\x83" },
+    { NULL },
+    { NULL },
+    { "larrhk;", 7, "\xe2\x86\xa9" },
+    { NULL },
+    { "sime;", 5, "\xe2\x89\x83" },
+    { NULL },
+    { "Colone;", 7, "\xe2\xa9\xb4" },
+    { "utri;", 5, "\xe2\x96\xb5" },
+    { "angzarr;", 8, "\xe2\x8d\xbc" },
+    { NULL },
+    { NULL },
+    { "rarrtl;", 7, "\xe2\x86\xa3" },
+    { "xscr;", 5, "\xf0\x9d\x93\x8d" },
+    { "Dfr;", 4, "\xf0\x9d\x94\x87" },
+    { NULL },
+    { NULL },
+    { "iff;", 4, "\xe2\x87\x94" },
+    { NULL },
+    { NULL },
+    { "equivDD;", 8, "\xe2\xa9\xb8" },
+    { "Ncaron;", 7, "\xc5\x87" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "oint;", 5, "\xe2\x88\xae" },
+    { NULL },
+    { NULL },
+    { "preceq;", 7, "\xe2\xaa\xaf" },
+    { NULL },
+    { "longmapsto;", 11, "\xe2\x9f\xbc" },
+    { "rscr;", 5, "\xf0\x9d\x93\x87" },
+    { "nharr;", 6, "\xe2\x86\xae" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "lmoust;", 7, "\xe2\x8e\xb0" },
+    { "Otimes;", 7, "\xe2\xa8\xb7" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "quatint;", 8, "\xe2\xa8\x96" },
+    { "QUOT", 4, "\x22" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "eth;", 4, "\xc3\xb0" },
+    { "rx;", 3, "\xe2\x84\x9e" },
+    { "amp;", 4, "\x26" },
+    { NULL },
+    { "rightrightarrows;", 17, "\xe2\x87\x89" },
+    { "circlearrowleft;", 16, "\xe2\x86\xba" },
+    { "LessTilde;", 10, "\xe2\x89\xb2" },
+    { "LeftVectorBar;", 14, "\xe2\xa5\x92" },
+    { "oS;", 3, "\xe2\x93\x88" },
+    { NULL },
+    { "RightFloor;", 11, "\xe2\x8c\x8b" },
+    { "easter;", 7, "\xe2\xa9\xae" },
+    { "bsolhsub;", 9, "\xe2\x9f\x88" },
+    { NULL },
+    { NULL },
+    { "profsurf;", 9, "\xe2\x8c\x93" },
+    { "gjcy;", 5, "\xd1\x93" },
+    { "caret;", 6, "\xe2\x81\x81" },
+    { NULL },
+    { NULL },
+    { "olcross;", 8, "\xe2\xa6\xbb" },
+    { "ange;", 5, "\xe2\xa6\xa4" },
+    { NULL },
+    { "uhblk;", 6, "\xe2\x96\x80" },
+    { NULL },
+    { NULL },
+    { "angmsdab;", 9, "\xe2\xa6\xa9" },
+    { NULL },
+    { NULL },
+    { "Iuml;", 5, "\xc3\x8f" },
+    { NULL },
+    { "THORN;", 6, "\xc3\x9e" },
+    { "Topf;", 5, "\xf0\x9d\x95\x8b" },
+    { NULL },
+    { "SucceedsTilde;", 14, "\xe2\x89\xbf" },
+    { "frac56;", 7, "\xe2\x85\x9a" },
+    { NULL },
+    { "NotTilde;", 9, "\xe2\x89\x81" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "gtrsim;", 7, "\xe2\x89\xb3" },
+    { "cong;", 5, "\xe2\x89\x85" },
+    { NULL },
+    { "planckh;", 8, "\xe2\x84\x8e" },
+    { "midcir;", 7, "\xe2\xab\xb0" },
+    { NULL },
+    { NULL },
+    { "hookleftarrow;", 14, "\xe2\x86\xa9" },
+    { "ncap;", 5, "\xe2\xa9\x83" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "male;", 5, "\xe2\x99\x82" },
+    { "uuml", 4, "\xc3\xbc" },
+    { NULL },
+    { NULL },
+    { "lesdoto;", 8, "\xe2\xaa\x81" },
+    { "triangledown;", 13, "\xe2\x96\xbf" },
+    { NULL },
+    { "rdca;", 5, "\xe2\xa4\xb7" },
+    { "ucy;", 4, "\xd1\x83" },
+    { "nsccue;", 7, "\xe2\x8b\xa1" },
+    { "backcong;", 9, "\xe2\x89\x8c" },
+    { "diamond;", 8, "\xe2\x8b\x84" },
+    { "downarrow;", 10, "\xe2\x86\x93" },
+    { NULL },
+    { "egs;", 4, "\xe2\xaa\x96" },
+    { "iuml;", 5, "\xc3\xaf" },
+    { NULL },
+    { "gap;", 4, "\xe2\xaa\x86" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "straightphi;", 12, "\xcf\x95" },
+    { "ordm", 4, "\xc2\xba" },
+    { "RightArrowBar;", 14, "\xe2\x87\xa5" },
+    { "subE;", 5, "\xe2\xab\x85" },
+    { NULL },
+    { NULL },
+    { "seArr;", 6, "\xe2\x87\x98" },
+    { NULL },
+    { "geqq;", 5, "\xe2\x89\xa7" },
+    { NULL },
+    { "lne;", 4, "\xe2\xaa\x87" },
+    { "star;", 5, "\xe2\x98\x86" },
+    { "wr;", 3, "\xe2\x89\x80" },
+    { NULL },
+    { NULL },
+    { "curlyeqsucc;", 12, "\xe2\x8b\x9f" },
+    { "divonx;", 7, "\xe2\x8b\x87" },
+    { NULL },
+    { "DoubleRightTee;", 15, "\xe2\x8a\xa8" },
+    { "angmsdae;", 9, "\xe2\xa6\xac" },
+    { "bsol;", 5, "\x5c" },
+    { NULL },
+    { NULL },
+    { "sqsup;", 6, "\xe2\x8a\x90" },
+    { "conint;", 7, "\xe2\x88\xae" },
+    { "VDash;", 6, "\xe2\x8a\xab" },
+    { NULL },
+    { "uuarr;", 6, "\xe2\x87\x88" },
+    { NULL },
+    { NULL },
+    { "ruluhar;", 8, "\xe2\xa5\xa8" },
+    { "Ntilde;", 7, "\xc3\x91" },
+    { "NotReverseElement;", 18, "\xe2\x88\x8c" },
+    { NULL },
+    { "pluse;", 6, "\xe2\xa9\xb2" },
+    { "nGg;", 4, "\xe2\x8b\x99\xcc\xb8" },
+    { "Gfr;", 4, "\xf0\x9d\x94\x8a" },
+    { "kopf;", 5, "\xf0\x9d\x95\x9c" },
+    { "plus;", 5, "\x2b" },
+    { NULL },
+    { NULL },
+    { "simrarr;", 8, "\xe2\xa5\xb2" },
+    { NULL },
+    { "Xfr;", 4, "\xf0\x9d\x94\x9b" },
+    { "ucirc;", 6, "\xc3\xbb" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "kfr;", 4, "\xf0\x9d\x94\xa8" },
+    { "wedgeq;", 7, "\xe2\x89\x99" },
+    { "otimesas;", 9, "\xe2\xa8\xb6" },
+    { "Ubrcy;", 6, "\xd0\x8e" },
+    { NULL },
+    { NULL },
+    { "DDotrahd;", 9, "\xe2\xa4\x91" },
+    { NULL },
+    { "Ocirc;", 6, "\xc3\x94" },
+    { "Mellintrf;", 10, "\xe2\x84\xb3" },
+    { NULL },
+    { "Dstrok;", 7, "\xc4\x90" },
+    { "gtcir;", 6, "\xe2\xa9\xba" },
+    { NULL },
+    { "lates;", 6, "\xe2\xaa\xad\xef\xb8\x80" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "iogon;", 6, "\xc4\xaf" },
+    { NULL },
+    { NULL },
+    { "bumpE;", 6, "\xe2\xaa\xae" },
+    { "rcub;", 5, "\x7d" },
+    { NULL },
+    { "nsim;", 5, "\xe2\x89\x81" },
+    { "setminus;", 9, "\xe2\x88\x96" },
+    { "hkswarow;", 9, "\xe2\xa4\xa6" },
+    { "solbar;", 7, "\xe2\x8c\xbf" },
+    { "xnis;", 5, "\xe2\x8b\xbb" },
+    { "nparallel;", 10, "\xe2\x88\xa6" },
+    { "lesseqqgtr;", 11, "\xe2\xaa\x8b" },
+    { "macr", 4, "\xc2\xaf" },
+    { "gvnE;", 5, "\xe2\x89\xa9\xef\xb8\x80" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "ograve;", 7, "\xc3\xb2" },
+    { "Fouriertrf;", 11, "\xe2\x84\xb1" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "DownRightTeeVector;", 19, "\xe2\xa5\x9f" },
+    { NULL },
+    { NULL },
+    { "nltrie;", 7, "\xe2\x8b\xac" },
+    { "aacute;", 7, "\xc3\xa1" },
+    { "ljcy;", 5, "\xd1\x99" },
+    { NULL },
+    { "Uacute", 6, "\xc3\x9a" },
+    { "reals;", 6, "\xe2\x84\x9d" },
+    { NULL },
+    { "esim;", 5, "\xe2\x89\x82" },
+    { NULL },
+    { "bigstar;", 8, "\xe2\x98\x85" },
+    { "curlyvee;", 9, "\xe2\x8b\x8e" },
+    { NULL },
+    { "cirscir;", 8, "\xe2\xa7\x82" },
+    { "lozenge;", 8, "\xe2\x97\x8a" },
+    { "NotLessTilde;", 13, "\xe2\x89\xb4" },
+    { "Otilde", 6, "\xc3\x95" },
+    { "bopf;", 5, "\xf0\x9d\x95\x93" },
+    { NULL },
+    { "nltri;", 6, "\xe2\x8b\xaa" },
+    { NULL },
+    { "cuesc;", 6, "\xe2\x8b\x9f" },
+    { "squf;", 5, "\xe2\x96\xaa" },
+    { NULL },
+    { "subrarr;", 8, "\xe2\xa5\xb9" },
+    { NULL },
+    { "Nscr;", 5, "\xf0\x9d\x92\xa9" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "UpArrowBar;", 11, "\xe2\xa4\x92" },
+    { NULL },
+    { NULL },
+    { "complexes;", 10, "\xe2\x84\x82" },
+    { "hksearow;", 9, "\xe2\xa4\xa5" },
+    { NULL },
+    { "kcy;", 4, "\xd0\xba" },
+    { "varphi;", 7, "\xcf\x95" },
+    { "OElig;", 6, "\xc5\x92" },
+    { "szlig", 5, "\xc3\x9f" },
+    { "Yfr;", 4, "\xf0\x9d\x94\x9c" },
+    { "plussim;", 8, "\xe2\xa8\xa6" },
+    { NULL },
+    { "weierp;", 7, "\xe2\x84\x98" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "timesd;", 7, "\xe2\xa8\xb0" },
+    { NULL },
+    { "itilde;", 7, "\xc4\xa9" },
+    { "suplarr;", 8, "\xe2\xa5\xbb" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "yen;", 4, "\xc2\xa5" },
+    { NULL },
+    { "Cconint;", 8, "\xe2\x88\xb0" },
+    { NULL },
+    { NULL },
+    { "empty;", 6, "\xe2\x88\x85" },
+    { "nsupE;", 6, "\xe2\xab\x86\xcc\xb8" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Vbar;", 5, "\xe2\xab\xab" },
+    { "lstrok;", 7, "\xc5\x82" },
+    { NULL },
+    { NULL },
+    { "topfork;", 8, "\xe2\xab\x9a" },
+    { "succ;", 5, "\xe2\x89\xbb" },
+    { "rharu;", 6, "\xe2\x87\x80" },
+    { "luruhar;", 8, "\xe2\xa5\xa6" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "nLeftarrow;", 11, "\xe2\x87\x8d" },
+    { "circledast;", 11, "\xe2\x8a\x9b" },
+    { "NotLess;", 8, "\xe2\x89\xae" },
+    { "nesim;", 6, "\xe2\x89\x82\xcc\xb8" },
+    { "ordm;", 5, "\xc2\xba" },
+    { NULL },
+    { NULL },
+    { "hstrok;", 7, "\xc4\xa7" },
+    { "cularr;", 7, "\xe2\x86\xb6" },
+    { NULL },
+    { "RightTeeArrow;", 14, "\xe2\x86\xa6" },
+    { "imof;", 5, "\xe2\x8a\xb7" },
+    { NULL },
+    { NULL },
+    { "ltcir;", 6, "\xe2\xa9\xb9" },
+    { "and;", 4, "\xe2\x88\xa7" },
+    { NULL },
+    { "lesseqgtr;", 10, "\xe2\x8b\x9a" },
+    { NULL },
+    { NULL },
+    { "tosa;", 5, "\xe2\xa4\xa9" },
+    { NULL },
+    { "ThinSpace;", 10, "\xe2\x80\x89" },
+    { "scnap;", 6, "\xe2\xaa\xba" },
+    { "sup2", 4, "\xc2\xb2" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Rarrtl;", 7, "\xe2\xa4\x96" },
+    { "pfr;", 4, "\xf0\x9d\x94\xad" },
+    { "upsih;", 6, "\xcf\x92" },
+    { "oline;", 6, "\xe2\x80\xbe" },
+    { "elinters;", 9, "\xe2\x8f\xa7" },
+    { NULL },
+    { NULL },
+    { "leftharpoonup;", 14, "\xe2\x86\xbc" },
+    { NULL },
+    { "dzcy;", 5, "\xd1\x9f" },
+    { NULL },
+    { "NonBreakingSpace;", 17, "\xc2\xa0" },
+    { NULL },
+    { "tprime;", 7, "\xe2\x80\xb4" },
+    { "Fopf;", 5, "\xf0\x9d\x94\xbd" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "nisd;", 5, "\xe2\x8b\xba" },
+    { "notniva;", 8, "\xe2\x88\x8c" },
+    { "RBarr;", 6, "\xe2\xa4\x90" },
+    { NULL },
+    { "leq;", 4, "\xe2\x89\xa4" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "rarrlp;", 7, "\xe2\x86\xac" },
+    { "Lfr;", 4, "\xf0\x9d\x94\x8f" },
+    { NULL },
+    { "multimap;", 9, "\xe2\x8a\xb8" },
+    { "Barv;", 5, "\xe2\xab\xa7" },
+    { "doteqdot;", 9, "\xe2\x89\x91" },
+    { "Tstrok;", 7, "\xc5\xa6" },
+    { "Ouml;", 5, "\xc3\x96" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "comp;", 5, "\xe2\x88\x81" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "REG", 3, "\xc2\xae" },
+    { "THORN", 5, "\xc3\x9e" },
+    { "Pcy;", 4, "\xd0\x9f" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "gtdot;", 6, "\xe2\x8b\x97" },
+    { NULL },
+    { "nhpar;", 6, "\xe2\xab\xb2" },
+    { "Zcaron;", 7, "\xc5\xbd" },
+    { "lesdotor;", 9, "\xe2\xaa\x83" },
+    { "aopf;", 5, "\xf0\x9d\x95\x92" },
+    { "drcorn;", 7, "\xe2\x8c\x9f" },
+    { NULL },
+    { "ncongdot;", 9, "\xe2\xa9\xad\xcc\xb8" },
+    { "period;", 7, "\x2e" },
+    { "Esim;", 5, "\xe2\xa9\xb3" },
+    { NULL },
+    { "Cscr;", 5, "\xf0\x9d\x92\x9e" },
+    { NULL },
+    { "uml", 3, "\xc2\xa8" },
+    { "xoplus;", 7, "\xe2\xa8\x81" },
+    { NULL },
+    { "brvbar", 6, "\xc2\xa6" },
+    { NULL },
+    { NULL },
+    { "boxdl;", 6, "\xe2\x94\x90" },
+    { "hbar;", 5, "\xe2\x84\x8f" },
+    { "rightleftarrows;", 16, "\xe2\x87\x84" },
+    { NULL },
+    { "Rang;", 5, "\xe2\x9f\xab" },
+    { NULL },
+    { NULL },
+    { "RightAngleBracket;", 18, "\xe2\x9f\xa9" },
+    { "npar;", 5, "\xe2\x88\xa6" },
+    { "Efr;", 4, "\xf0\x9d\x94\x88" },
+    { "shortmid;", 9, "\xe2\x88\xa3" },
+    { NULL },
+    { NULL },
+    { "uogon;", 6, "\xc5\xb3" },
+    { "uuml;", 5, "\xc3\xbc" },
+    { "cupbrcap;", 9, "\xe2\xa9\x88" },
+    { "darr;", 5, "\xe2\x86\x93" },
+    { "profline;", 9, "\xe2\x8c\x92" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "image;", 6, "\xe2\x84\x91" },
+    { NULL },
+    { "Acirc;", 6, "\xc3\x82" },
+    { "NotGreaterTilde;", 16, "\xe2\x89\xb5" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Atilde", 6, "\xc3\x83" },
+    { NULL },
+    { "capcup;", 7, "\xe2\xa9\x87" },
+    { "gtrdot;", 7, "\xe2\x8b\x97" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "SquareIntersection;", 19, "\xe2\x8a\x93" },
+    { NULL },
+    { NULL },
+    { "lrm;", 4, "" },
+    { "jscr;", 5, "\xf0\x9d\x92\xbf" },
+    { "swarrow;", 8, "\xe2\x86\x99" },
+    { NULL },
+    { "boxH;", 5, "\xe2\x95\x90" },
+    { NULL },
+    { "Pscr;", 5, "\xf0\x9d\x92\xab" },
+    { "eta;", 4, "\xce\xb7" },
+    { "ugrave", 6, "\xc3\xb9" },
+    { NULL },
+    { NULL },
+    { "yacute;", 7, "\xc3\xbd" },
+    { "scedil;", 7, "\xc5\x9f" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Yacute;", 7, "\xc3\x9d" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Equilibrium;", 12, "\xe2\x87\x8c" },
+    { NULL },
+    { NULL },
+    { "sect;", 5, "\xc2\xa7" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Mopf;", 5, "\xf0\x9d\x95\x84" },
+    { NULL },
+    { "emptyset;", 9, "\xe2\x88\x85" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "jukcy;", 6, "\xd1\x94" },
+    { "Rho;", 4, "\xce\xa1" },
+    { NULL },
+    { "curren", 6, "\xc2\xa4" },
+    { NULL },
+    { "NegativeMediumSpace;", 20, "\xe2\x80\x8b" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "zwnj;", 5, "\xe2\x80\x8c" },
+    { "apacir;", 7, "\xe2\xa9\xaf" },
+    { "rbrksld;", 8, "\xe2\xa6\x8e" },
+    { "euml", 4, "\xc3\xab" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "cirfnint;", 9, "\xe2\xa8\x90" },
+    { NULL },
+    { NULL },
+    { "lat;", 4, "\xe2\xaa\xab" },
+    { "scsim;", 6, "\xe2\x89\xbf" },
+    { "Fscr;", 5, "\xe2\x84\xb1" },
+    { NULL },
+    { "upharpoonright;", 15, "\xe2\x86\xbe" },
+    { "Updownarrow;", 12, "\xe2\x87\x95" },
+    { "IEcy;", 5, "\xd0\x95" },
+    { NULL },
+    { NULL },
+    { "odsold;", 7, "\xe2\xa6\xbc" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "NestedGreaterGreater;", 21, "\xe2\x89\xab" },
+    { NULL },
+    { NULL },
+    { "Rightarrow;", 11, "\xe2\x87\x92" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "sim;", 4, "\xe2\x88\xbc" },
+    { NULL },
+    { NULL },
+    { "sup;", 4, "\xe2\x8a\x83" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Sqrt;", 5, "\xe2\x88\x9a" },
+    { NULL },
+    { "lneqq;", 6, "\xe2\x89\xa8" },
+    { "emsp13;", 7, "\xe2\x80\x84" },
+    { NULL },
+    { "vellip;", 7, "\xe2\x8b\xae" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "nrightarrow;", 12, "\xe2\x86\x9b" },
+    { "nshortmid;", 10, "\xe2\x88\xa4" },
+    { NULL },
+    { NULL },
+    { "RightTeeVector;", 15, "\xe2\xa5\x9b" },
+    { "bsim;", 5, "\xe2\x88\xbd" },
+    { NULL },
+    { NULL },
+    { "subsup;", 7, "\xe2\xab\x93" },
+    { "gtrarr;", 7, "\xe2\xa5\xb8" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "frac58;", 7, "\xe2\x85\x9d" },
+    { "efr;", 4, "\xf0\x9d\x94\xa2" },
+    { "triangleleft;", 13, "\xe2\x97\x83" },
+    { NULL },
+    { NULL },
+    { "ctdot;", 6, "\xe2\x8b\xaf" },
+    { NULL },
+    { NULL },
+    { "dashv;", 6, "\xe2\x8a\xa3" },
+    { "bepsi;", 6, "\xcf\xb6" },
+    { NULL },
+    { NULL },
+    { "rightharpoondown;", 17, "\xe2\x87\x81" },
+    { "odash;", 6, "\xe2\x8a\x9d" },
+    { "LeftTee;", 8, "\xe2\x8a\xa3" },
+    { NULL },
+    { "rbrke;", 6, "\xe2\xa6\x8c" },
+    { "DScy;", 5, "\xd0\x85" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "LeftFloor;", 10, "\xe2\x8c\x8a" },
+    { NULL },
+    { NULL },
+    { "squarf;", 7, "\xe2\x96\xaa" },
+    { "frac78;", 7, "\xe2\x85\x9e" },
+    { "Rcy;", 4, "\xd0\xa0" },
+    { "Assign;", 7, "\xe2\x89\x94" },
+    { "ograve", 6, "\xc3\xb2" },
+    { NULL },
+    { NULL },
+    { "Amacr;", 6, "\xc4\x80" },
+    { "lsimg;", 6, "\xe2\xaa\x8f" },
+    { "prec;", 5, "\xe2\x89\xba" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "rnmid;", 6, "\xe2\xab\xae" },
+    { "ac;", 3, "\xe2\x88\xbe" },
+    { "prnsim;", 7, "\xe2\x8b\xa8" },
+    { NULL },
+    { "lsqb;", 5, "\x5b" },
+    { "between;", 8, "\xe2\x89\xac" },
+    { NULL },
+    { NULL },
+    { "sup1;", 5, "\xc2\xb9" },
+    { NULL },
+    { NULL },
+    { "lscr;", 5, "\xf0\x9d\x93\x81" },
+    { "telrec;", 7, "\xe2\x8c\x95" },
+    { "iscr;", 5, "\xf0\x9d\x92\xbe" },
+    { "Downarrow;", 10, "\xe2\x87\x93" },
+    { "simg;", 5, "\xe2\xaa\x9e" },
+    { NULL },
+    { "nprec;", 6, "\xe2\x8a\x80" },
+    { "lthree;", 7, "\xe2\x8b\x8b" },
+    { NULL },
+    { "setmn;", 6, "\xe2\x88\x96" },
+    { "compfn;", 7, "\xe2\x88\x98" },
+    { "SquareSubsetEqual;", 18, "\xe2\x8a\x91" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "nvlt;", 5, "\x3c\xe2\x83\x92" },
+    { "duarr;", 6, "\xe2\x87\xb5" },
+    { "dotsquare;", 10, "\xe2\x8a\xa1" },
+    { "llhard;", 7, "\xe2\xa5\xab" },
+    { NULL },
+    { "larrfs;", 7, "\xe2\xa4\x9d" },
+    { "LessSlantEqual;", 15, "\xe2\xa9\xbd" },
+    { "qint;", 5, "\xe2\xa8\x8c" },
+    { "plusdo;", 7, "\xe2\x88\x94" },
+    { NULL },
+    { "Zacute;", 7, "\xc5\xb9" },
+    { NULL },
+    { "GreaterSlantEqual;", 18, "\xe2\xa9\xbe" },
+    { "ominus;", 7, "\xe2\x8a\x96" },
+    { "Implies;", 8, "\xe2\x87\x92" },
+    { NULL },
+    { NULL },
+    { "igrave", 6, "\xc3\xac" },
+    { NULL },
+    { "LT;", 3, "\x3c" },
+    { "olt;", 4, "\xe2\xa7\x80" },
+    { NULL },
+    { "napE;", 5, "\xe2\xa9\xb0\xcc\xb8" },
+    { "gsim;", 5, "\xe2\x89\xb3" },
+    { "oopf;", 5, "\xf0\x9d\x95\xa0" },
+    { "nGt;", 4, "\xe2\x89\xab\xe2\x83\x92" },
+    { NULL },
+    { NULL },
+    { "UnderBracket;", 13, "\xe2\x8e\xb5" },
+    { NULL },
+    { "eplus;", 6, "\xe2\xa9\xb1" },
+    { "sqcup;", 6, "\xe2\x8a\x94" },
+    { "Scedil;", 7, "\xc5\x9e" },
+    { NULL },
+    { NULL },
+    { "Dcaron;", 7, "\xc4\x8e" },
+    { "sum;", 4, "\xe2\x88\x91" },
+    { NULL },
+    { "para;", 5, "\xc2\xb6" },
+    { NULL },
+    { "ZHcy;", 5, "\xd0\x96" },
+    { "RightVectorBar;", 15, "\xe2\xa5\x93" },
+    { NULL },
+    { NULL },
+    { "Longrightarrow;", 15, "\xe2\x9f\xb9" },
+    { "varnothing;", 11, "\xe2\x88\x85" },
+    { NULL },
+    { "cupcup;", 7, "\xe2\xa9\x8a" },
+    { NULL },
+    { "trianglerighteq;", 16, "\xe2\x8a\xb5" },
+    { NULL },
+    { "forkv;", 6, "\xe2\xab\x99" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "RightArrowLeftArrow;", 20, "\xe2\x87\x84" },
+    { NULL },
+    { "boxbox;", 7, "\xe2\xa7\x89" },
+    { "xcup;", 5, "\xe2\x8b\x83" },
+    { "GreaterEqualLess;", 17, "\xe2\x8b\x9b" },
+    { "xmap;", 5, "\xe2\x9f\xbc" },
+    { NULL },
+    { "Scirc;", 6, "\xc5\x9c" },
+    { NULL },
+    { NULL },
+    { "rcedil;", 7, "\xc5\x97" },
+    { "ImaginaryI;", 11, "\xe2\x85\x88" },
+    { "gtrless;", 8, "\xe2\x89\xb7" },
+    { "Omega;", 6, "\xce\xa9" },
+    { "leftleftarrows;", 15, "\xe2\x87\x87" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "rsh;", 4, "\xe2\x86\xb1" },
+    { NULL },
+    { "infintie;", 9, "\xe2\xa7\x9d" },
+    { "uparrow;", 8, "\xe2\x86\x91" },
+    { "Ll;", 3, "\xe2\x8b\x98" },
+    { "nprcue;", 7, "\xe2\x8b\xa0" },
+    { NULL },
+    { "SquareSupersetEqual;", 20, "\xe2\x8a\x92" },
+    { "DoubleDot;", 10, "\xc2\xa8" },
+    { "homtht;", 7, "\xe2\x88\xbb" },
+    { NULL },
+    { "ShortLeftArrow;", 15, "\xe2\x86\x90" },
+    { "Iopf;", 5, "\xf0\x9d\x95\x80" },
+    { NULL },
+    { "CenterDot;", 10, "\xc2\xb7" },
+    { "Ntilde", 6, "\xc3\x91" },
+    { "rdldhar;", 8, "\xe2\xa5\xa9" },
+    { "nwarrow;", 8, "\xe2\x86\x96" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "kscr;", 5, "\xf0\x9d\x93\x80" },
+    { "lnE;", 4, "\xe2\x89\xa8" },
+    { "DownLeftRightVector;", 20, "\xe2\xa5\x90" },
+    { "nfr;", 4, "\xf0\x9d\x94\xab" },
+    { NULL },
+    { NULL },
+    { "xfr;", 4, "\xf0\x9d\x94\xb5" },
+    { NULL },
+    { "Lacute;", 7, "\xc4\xb9" },
+    { NULL },
+    { "Gcy;", 4, "\xd0\x93" },
+    { NULL },
+    { "lessgtr;", 8, "\xe2\x89\xb6" },
+    { "prurel;", 7, "\xe2\x8a\xb0" },
+    { NULL },
+    { NULL },
+    { "lcub;", 5, "\x7b" },
+    { "nsucceq;", 8, "\xe2\xaa\xb0\xcc\xb8" },
+    { "DiacriticalTilde;", 17, "\xcb\x9c" },
+    { "nless;", 6, "\xe2\x89\xae" },
+    { NULL },
+    { NULL },
+    { "thetav;", 7, "\xcf\x91" },
+    { "boxV;", 5, "\xe2\x95\x91" },
+    { NULL },
+    { "orderof;", 8, "\xe2\x84\xb4" },
+    { "supne;", 6, "\xe2\x8a\x8b" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "SucceedsEqual;", 14, "\xe2\xaa\xb0" },
+    { NULL },
+    { "ecir;", 5, "\xe2\x89\x96" },
+    { NULL },
+    { NULL },
+    { "lsim;", 5, "\xe2\x89\xb2" },
+    { "supE;", 5, "\xe2\xab\x86" },
+    { "el;", 3, "\xe2\xaa\x99" },
+    { NULL },
+    { "Verbar;", 7, "\xe2\x80\x96" },
+    { "succapprox;", 11, "\xe2\xaa\xb8" },
+    { "Pfr;", 4, "\xf0\x9d\x94\x93" },
+    { "digamma;", 8, "\xcf\x9d" },
+    { "nwarr;", 6, "\xe2\x86\x96" },
+    { "ordf;", 5, "\xc2\xaa" },
+    { "approx;", 7, "\xe2\x89\x88" },
+    { NULL },
+    { NULL },
+    { "hookrightarrow;", 15, "\xe2\x86\xaa" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "ycy;", 4, "\xd1\x8b" },
+    { "NegativeVeryThinSpace;", 22, "\xe2\x80\x8b" },
+    { NULL },
+    { "congdot;", 8, "\xe2\xa9\xad" },
+    { NULL },
+    { "ecirc;", 6, "\xc3\xaa" },
+    { NULL },
+    { "Qopf;", 5, "\xe2\x84\x9a" },
+    { NULL },
+    { NULL },
+    { "middot", 6, "\xc2\xb7" },
+    { "Barwed;", 7, "\xe2\x8c\x86" },
+    { "cuepr;", 6, "\xe2\x8b\x9e" },
+    { NULL },
+    { "plusb;", 6, "\xe2\x8a\x9e" },
+    { NULL },
+    { "Lcy;", 4, "\xd0\x9b" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Lstrok;", 7, "\xc5\x81" },
+    { "bdquo;", 6, "\xe2\x80\x9e" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "ocirc;", 6, "\xc3\xb4" },
+    { "Rsh;", 4, "\xe2\x86\xb1" },
+    { "bemptyv;", 8, "\xe2\xa6\xb0" },
+    { "varr;", 5, "\xe2\x86\x95" },
+    { NULL },
+    { "isinsv;", 7, "\xe2\x8b\xb3" },
+    { NULL },
+    { NULL },
+    { "varpi;", 6, "\xcf\x96" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "gtquest;", 8, "\xe2\xa9\xbc" },
+    { "Kappa;", 6, "\xce\x9a" },
+    { NULL },
+    { NULL },
+    { "Poincareplane;", 14, "\xe2\x84\x8c" },
+    { "Bscr;", 5, "\xe2\x84\xac" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "ell;", 4, "\xe2\x84\x93" },
+    { "geqslant;", 9, "\xe2\xa9\xbe" },
+    { "mapstodown;", 11, "\xe2\x86\xa7" },
+    { NULL },
+    { NULL },
+    { "DoubleDownArrow;", 16, "\xe2\x87\x93" },
+    { NULL },
+    { "alpha;", 6, "\xce\xb1" },
+    { "ngE;", 4, "\xe2\x89\xa7\xcc\xb8" },
+    { NULL },
+    { NULL },
+    { "notnivc;", 8, "\xe2\x8b\xbd" },
+    { NULL },
+    { NULL },
+    { "acirc", 5, "\xc3\xa2" },
+    { "subseteqq;", 10, "\xe2\xab\x85" },
+    { "GreaterTilde;", 13, "\xe2\x89\xb3" },
+    { "ggg;", 4, "\xe2\x8b\x99" },
+    { "EqualTilde;", 11, "\xe2\x89\x82" },
+    { "vsubne;", 7, "\xe2\x8a\x8a\xef\xb8\x80" },
+    { "intlarhk;", 9, "\xe2\xa8\x97" },
+    { NULL },
+    { NULL },
+    { "Rcedil;", 7, "\xc5\x96" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "DoubleLongLeftRightArrow;", 25, "\xe2\x9f\xba" },
+    { NULL },
+    { "rightleftharpoons;", 18, "\xe2\x87\x8c" },
+    { NULL },
+    { "OverBracket;", 12, "\xe2\x8e\xb4" },
+    { "ThickSpace;", 11, "\xe2\x81\x9f\xe2\x80\x8a" },
+    { "udhar;", 6, "\xe2\xa5\xae" },
+    { "nvlArr;", 7, "\xe2\xa4\x82" },
+    { NULL },
+    { "bsolb;", 6, "\xe2\xa7\x85" },
+    { "zeetrf;", 7, "\xe2\x84\xa8" },
+    { NULL },
+    { "GreaterGreater;", 15, "\xe2\xaa\xa2" },
+    { NULL },
+    { "notinvb;", 8, "\xe2\x8b\xb7" },
+    { NULL },
+    { "Ucirc;", 6, "\xc3\x9b" },
+    { "RightTriangleEqual;", 19, "\xe2\x8a\xb5" },
+    { "Vee;", 4, "\xe2\x8b\x81" },
+    { "nleqq;", 6, "\xe2\x89\xa6\xcc\xb8" },
+    { NULL },
+    { NULL },
+    { "mapstoup;", 9, "\xe2\x86\xa5" },
+    { "Upsi;", 5, "\xcf\x92" },
+    { "dfisht;", 7, "\xe2\xa5\xbf" },
+    { NULL },
+    { "RightDownVector;", 16, "\xe2\x87\x82" },
+    { "Iacute", 6, "\xc3\x8d" },
+    { "forall;", 7, "\xe2\x88\x80" },
+    { "zdot;", 5, "\xc5\xbc" },
+    { NULL },
+    { "SucceedsSlantEqual;", 19, "\xe2\x89\xbd" },
+    { NULL },
+    { "ntriangleleft;", 14, "\xe2\x8b\xaa" },
+    { "LeftUpVectorBar;", 16, "\xe2\xa5\x98" },
+    { NULL },
+    { NULL },
+    { "triminus;", 9, "\xe2\xa8\xba" },
+    { NULL },
+    { "xcap;", 5, "\xe2\x8b\x82" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "nVDash;", 7, "\xe2\x8a\xaf" },
+    { NULL },
+    { "DownRightVector;", 16, "\xe2\x87\x81" },
+    { NULL },
+    { "ReverseElement;", 15, "\xe2\x88\x8b" },
+    { "dot;", 4, "\xcb\x99" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "zcaron;", 7, "\xc5\xbe" },
+    { "topbot;", 7, "\xe2\x8c\xb6" },
+    { "angrtvb;", 8, "\xe2\x8a\xbe" },
+    { "lacute;", 7, "\xc4\xba" },
+    { NULL },
+    { NULL },
+    { "frac12;", 7, "\xc2\xbd" },
+    { "Mu;", 3, "\xce\x9c" },
+    { "InvisibleTimes;", 15, "\xe2\x81\xa2" },
+    { NULL },
+    { "circledR;", 9, "\xc2\xae" },
+    { "rarrap;", 7, "\xe2\xa5\xb5" },
+    { NULL },
+    { NULL },
+    { "nacute;", 7, "\xc5\x84" },
+    { "blank;", 6, "\xe2\x90\xa3" },
+    { "xlarr;", 6, "\xe2\x9f\xb5" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "loarr;", 6, "\xe2\x87\xbd" },
+    { NULL },
+    { "VerticalTilde;", 14, "\xe2\x89\x80" },
+    { "beta;", 5, "\xce\xb2" },
+    { "Mscr;", 5, "\xe2\x84\xb3" },
+    { "mnplus;", 7, "\xe2\x88\x93" },
+    { "ofr;", 4, "\xf0\x9d\x94\xac" },
+    { "nwArr;", 6, "\xe2\x87\x96" },
+    { NULL },
+    { "Tscr;", 5, "\xf0\x9d\x92\xaf" },
+    { NULL },
+    { "ffllig;", 7, "\xef\xac\x84" },
+    { NULL },
+    { NULL },
+    { "egsdot;", 7, "\xe2\xaa\x98" },
+    { "ltquest;", 8, "\xe2\xa9\xbb" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "larrpl;", 7, "\xe2\xa4\xb9" },
+    { "bigodot;", 8, "\xe2\xa8\x80" },
+    { NULL },
+    { NULL },
+    { "profalar;", 9, "\xe2\x8c\xae" },
+    { NULL },
+    { "GreaterEqual;", 13, "\xe2\x89\xa5" },
+    { "UnderBrace;", 11, "\xe2\x8f\x9f" },
+    { "nwnear;", 7, "\xe2\xa4\xa7" },
+    { NULL },
+    { "Succeeds;", 9, "\xe2\x89\xbb" },
+    { "diamondsuit;", 12, "\xe2\x99\xa6" },
+    { NULL },
+    { NULL },
+    { "UpTee;", 6, "\xe2\x8a\xa5" },
+    { "Vfr;", 4, "\xf0\x9d\x94\x99" },
+    { "cfr;", 4, "\xf0\x9d\x94\xa0" },
+    { "permil;", 7, "\xe2\x80\xb0" },
+    { NULL },
+    { NULL },
+    { "dotplus;", 8, "\xe2\x88\x94" },
+    { NULL },
+    { NULL },
+    { "Vdash;", 6, "\xe2\x8a\xa9" },
+    { "emptyv;", 7, "\xe2\x88\x85" },
+    { NULL },
+    { "ratail;", 7, "\xe2\xa4\x9a" },
+    { "ang;", 4, "\xe2\x88\xa0" },
+    { "Icy;", 4, "\xd0\x98" },
+    { "lurdshar;", 9, "\xe2\xa5\x8a" },
+    { "Equal;", 6, "\xe2\xa9\xb5" },
+    { "gamma;", 6, "\xce\xb3" },
+    { NULL },
+    { NULL },
+    { "wp;", 3, "\xe2\x84\x98" },
+    { "para", 4, "\xc2\xb6" },
+    { "emsp;", 5, "\xe2\x80\x83" },
+    { "gE;", 3, "\xe2\x89\xa7" },
+    { "Nfr;", 4, "\xf0\x9d\x94\x91" },
+    { "ucirc", 5, "\xc3\xbb" },
+    { "dzigrarr;", 9, "\xe2\x9f\xbf" },
+    { NULL },
+    { NULL },
+    { "ApplyFunction;", 14, "\xe2\x81\xa1" },
+    { NULL },
+    { "nles;", 5, "\xe2\xa9\xbd\xcc\xb8" },
+    { NULL },
+    { "copy;", 5, "\xc2\xa9" },
+    { "bne;", 4, "\x3d\xe2\x83\xa5" },
+    { "AMP;", 4, "\x26" },
+    { "Otilde;", 7, "\xc3\x95" },
+    { "llarr;", 6, "\xe2\x87\x87" },
+    { NULL },
+    { NULL },
+    { "Imacr;", 6, "\xc4\xaa" },
+    { "Conint;", 7, "\xe2\x88\xaf" },
+    { "nu;", 3, "\xce\xbd" },
+    { "top;", 4, "\xe2\x8a\xa4" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "vdash;", 6, "\xe2\x8a\xa2" },
+    { NULL },
+    { "thorn", 5, "\xc3\xbe" },
+    { "cent;", 5, "\xc2\xa2" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "copf;", 5, "\xf0\x9d\x95\x94" },
+    { NULL },
+    { "blk34;", 6, "\xe2\x96\x93" },
+    { NULL },
+    { "HorizontalLine;", 15, "\xe2\x94\x80" },
+    { "vsupnE;", 7, "\xe2\xab\x8c\xef\xb8\x80" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "sol;", 4, "\x2f" },
+    { "nsmid;", 6, "\xe2\x88\xa4" },
+    { NULL },
+    { NULL },
+    { "npr;", 4, "\xe2\x8a\x80" },
+    { NULL },
+    { "shchcy;", 7, "\xd1\x89" },
+    { "LessEqualGreater;", 17, "\xe2\x8b\x9a" },
+    { NULL },
+    { "swarr;", 6, "\xe2\x86\x99" },
+    { "apid;", 5, "\xe2\x89\x8b" },
+    { NULL },
+    { "LeftUpVector;", 13, "\xe2\x86\xbf" },
+    { NULL },
+    { NULL },
+    { "risingdotseq;", 13, "\xe2\x89\x93" },
+    { "csube;", 6, "\xe2\xab\x91" },
+    { "ntrianglerighteq;", 17, "\xe2\x8b\xad" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "uplus;", 6, "\xe2\x8a\x8e" },
+    { "tcy;", 4, "\xd1\x82" },
+    { "dHar;", 5, "\xe2\xa5\xa5" },
+    { "bigtriangledown;", 16, "\xe2\x96\xbd" },
+    { "ETH", 3, "\xc3\x90" },
+    { "subsim;", 7, "\xe2\xab\x87" },
+    { "agrave", 6, "\xc3\xa0" },
+    { "larrtl;", 7, "\xe2\x86\xa2" },
+    { NULL },
+    { "epar;", 5, "\xe2\x8b\x95" },
+    { NULL },
+    { NULL },
+    { "oacute;", 7, "\xc3\xb3" },
+    { NULL },
+    { NULL },
+    { "lfr;", 4, "\xf0\x9d\x94\xa9" },
+    { "hellip;", 7, "\xe2\x80\xa6" },
+    { "Psi;", 4, "\xce\xa8" },
+    { "Igrave", 6, "\xc3\x8c" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "bscr;", 5, "\xf0\x9d\x92\xb7" },
+    { "blacktriangledown;", 18, "\xe2\x96\xbe" },
+    { "yacute", 6, "\xc3\xbd" },
+    { "Agrave;", 7, "\xc3\x80" },
+    { "nsupset;", 8, "\xe2\x8a\x83\xe2\x83\x92" },
+    { NULL },
+    { "boxDL;", 6, "\xe2\x95\x97" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "LeftTriangle;", 13, "\xe2\x8a\xb2" },
+    { "ReverseEquilibrium;", 19, "\xe2\x87\x8b" },
+    { NULL },
+    { NULL },
+    { "micro;", 6, "\xc2\xb5" },
+    { NULL },
+    { "pound", 5, "\xc2\xa3" },
+    { "lBarr;", 6, "\xe2\xa4\x8e" },
+    { NULL },
+    { NULL },
+    { "ltrie;", 6, "\xe2\x8a\xb4" },
+    { NULL },
+    { NULL },
+    { "ssmile;", 7, "\xe2\x8c\xa3" },
+    { "gla;", 4, "\xe2\xaa\xa5" },
+    { "loang;", 6, "\xe2\x9f\xac" },
+    { NULL },
+    { "curren;", 7, "\xc2\xa4" },
+    { NULL },
+    { "leqq;", 5, "\xe2\x89\xa6" },
+    { "scy;", 4, "\xd1\x81" },
+    { "pluscir;", 8, "\xe2\xa8\xa2" },
+    { "succcurlyeq;", 12, "\xe2\x89\xbd" },
+    { NULL },
+    { "half;", 5, "\xc2\xbd" },
+    { NULL },
+    { "ncy;", 4, "\xd0\xbd" },
+    { "RightTriangleBar;", 17, "\xe2\xa7\x90" },
+    { NULL },
+    { "egrave", 6, "\xc3\xa8" },
+    { "umacr;", 6, "\xc5\xab" },
+    { NULL },
+    { "icy;", 4, "\xd0\xb8" },
+    { NULL },
+    { NULL },
+    { "Yopf;", 5, "\xf0\x9d\x95\x90" },
+    { "ratio;", 6, "\xe2\x88\xb6" },
+    { "boxDl;", 6, "\xe2\x95\x96" },
+    { "neArr;", 6, "\xe2\x87\x97" },
+    { NULL },
+    { NULL },
+    { "SOFTcy;", 7, "\xd0\xac" },
+    { NULL },
+    { NULL },
+    { "trie;", 5, "\xe2\x89\x9c" },
+    { NULL },
+    { "NotGreaterFullEqual;", 20, "\xe2\x89\xa7\xcc\xb8" },
+    { "lmidot;", 7, "\xc5\x80" },
+    { "Omicron;", 8, "\xce\x9f" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "curvearrowright;", 16, "\xe2\x86\xb7" },
+    { NULL },
+    { NULL },
+    { "smtes;", 6, "\xe2\xaa\xac\xef\xb8\x80" },
+    { "divide", 6, "\xc3\xb7" },
+    { "thickapprox;", 12, "\xe2\x89\x88" },
+    { NULL },
+    { "doublebarwedge;", 15, "\xe2\x8c\x86" },
+    { NULL },
+    { "ensp;", 5, "\xe2\x80\x82" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "NotGreaterSlantEqual;", 21, "\xe2\xa9\xbe\xcc\xb8" },
+    { "uArr;", 5, "\xe2\x87\x91" },
+    { "prsim;", 6, "\xe2\x89\xbe" },
+    { "ntgl;", 5, "\xe2\x89\xb9" },
+    { "timesb;", 7, "\xe2\x8a\xa0" },
+    { "rightthreetimes;", 16, "\xe2\x8b\x8c" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "rarrfs;", 7, "\xe2\xa4\x9e" },
+    { NULL },
+    { "lozf;", 5, "\xe2\xa7\xab" },
+    { NULL },
+    { "LeftTriangleBar;", 16, "\xe2\xa7\x8f" },
+    { NULL },
+    { "atilde", 6, "\xc3\xa3" },
+    { "psi;", 4, "\xcf\x88" },
+    { "jcy;", 4, "\xd0\xb9" },
+    { "rtrie;", 6, "\xe2\x8a\xb5" },
+    { "imacr;", 6, "\xc4\xab" },
+    { NULL },
+    { NULL },
+    { "NotEqualTilde;", 14, "\xe2\x89\x82\xcc\xb8" },
+    { "NotSquareSuperset;", 18, "\xe2\x8a\x90\xcc\xb8" },
+    { NULL },
+    { "ccedil;", 7, "\xc3\xa7" },
+    { "shy", 3, "\xc2\xad" },
+    { "pi;", 3, "\xcf\x80" },
+    { "varepsilon;", 11, "\xcf\xb5" },
+    { NULL },
+    { "lltri;", 6, "\xe2\x97\xba" },
+    { "nvrArr;", 7, "\xe2\xa4\x83" },
+    { NULL },
+    { "Ffr;", 4, "\xf0\x9d\x94\x89" },
+    { "nearhk;", 7, "\xe2\xa4\xa4" },
+    { "zigrarr;", 8, "\xe2\x87\x9d" },
+    { "odiv;", 5, "\xe2\xa8\xb8" },
+    { "rhov;", 5, "\xcf\xb1" },
+    { NULL },
+    { NULL },
+    { "rsqb;", 5, "\x5d" },
+    { "InvisibleComma;", 15, "\xe2\x81\xa3" },
+    { "NotSubset;", 10, "\xe2\x8a\x82\xe2\x83\x92" },
+    { "csup;", 5, "\xe2\xab\x90" },
+    { NULL },
+    { "utrif;", 6, "\xe2\x96\xb4" },
+    { "verbar;", 7, "\x7c" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "phiv;", 5, "\xcf\x95" },
+    { NULL },
+    { "supmult;", 8, "\xe2\xab\x82" },
+    { NULL },
+    { "sub;", 4, "\xe2\x8a\x82" },
+    { NULL },
+    { "wedge;", 6, "\xe2\x88\xa7" },
+    { "dscr;", 5, "\xf0\x9d\x92\xb9" },
+    { NULL },
+    { "notnivb;", 8, "\xe2\x8b\xbe" },
+    { "lg;", 3, "\xe2\x89\xb6" },
+    { "Gamma;", 6, "\xce\x93" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "kgreen;", 7, "\xc4\xb8" },
+    { "lvertneqq;", 10, "\xe2\x89\xa8\xef\xb8\x80" },
+    { NULL },
+    { "ord;", 4, "\xe2\xa9\x9d" },
+    { "DownLeftTeeVector;", 18, "\xe2\xa5\x9e" },
+    { NULL },
+    { "Gammad;", 7, "\xcf\x9c" },
+    { "nlarr;", 6, "\xe2\x86\x9a" },
+    { "boxvl;", 6, "\xe2\x94\xa4" },
+    { "bcy;", 4, "\xd0\xb1" },
+    { NULL },
+    { NULL },
+    { "dagger;", 7, "\xe2\x80\xa0" },
+    { "commat;", 7, "\x40" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Auml", 4, "\xc3\x84" },
+    { "Sopf;", 5, "\xf0\x9d\x95\x8a" },
+    { NULL },
+    { NULL },
+    { "vDash;", 6, "\xe2\x8a\xa8" },
+    { NULL },
+    { "yacy;", 5, "\xd1\x8f" },
+    { NULL },
+    { "aelig", 5, "\xc3\xa6" },
+    { NULL },
+    { "dotminus;", 9, "\xe2\x88\xb8" },
+    { NULL },
+    { "rfisht;", 7, "\xe2\xa5\xbd" },
+    { "varsupsetneq;", 13, "\xe2\x8a\x8b\xef\xb8\x80" },
+    { NULL },
+    { "npart;", 6, "\xe2\x88\x82\xcc\xb8" },
+    { "flat;", 5, "\xe2\x99\xad" },
+    { "isins;", 6, "\xe2\x8b\xb4" },
+    { NULL },
+    { "DownRightVectorBar;", 19, "\xe2\xa5\x97" },
+    { "boxDr;", 6, "\xe2\x95\x93" },
+    { "rsquo;", 6, "\xe2\x80\x99" },
+    { NULL },
+    { "NotRightTriangleEqual;", 22, "\xe2\x8b\xad" },
+    { "dsol;", 5, "\xe2\xa7\xb6" },
+    { "olarr;", 6, "\xe2\x86\xba" },
+    { "nequiv;", 7, "\xe2\x89\xa2" },
+    { NULL },
+    { NULL },
+    { "thksim;", 7, "\xe2\x88\xbc" },
+    { "natural;", 8, "\xe2\x99\xae" },
+    { "downharpoonleft;", 16, "\xe2\x87\x83" },
+    { "robrk;", 6, "\xe2\x9f\xa7" },
+    { NULL },
+    { "Hat;", 4, "\x5e" },
+    { NULL },
+    { "lotimes;", 8, "\xe2\xa8\xb4" },
+    { "mapsto;", 7, "\xe2\x86\xa6" },
+    { NULL },
+    { "uopf;", 5, "\xf0\x9d\x95\xa6" },
+    { NULL },
+    { NULL },
+    { "bbrk;", 5, "\xe2\x8e\xb5" },
+    { "MinusPlus;", 10, "\xe2\x88\x93" },
+    { "nsup;", 5, "\xe2\x8a\x85" },
+    { NULL },
+    { NULL },
+    { "AMP", 3, "\x26" },
+    { "ntrianglelefteq;", 16, "\xe2\x8b\xac" },
+    { "leftrightarrow;", 15, "\xe2\x86\x94" },
+    { NULL },
+    { "NotElement;", 11, "\xe2\x88\x89" },
+    { "NegativeThinSpace;", 18, "\xe2\x80\x8b" },
+    { "marker;", 7, "\xe2\x96\xae" },
+    { "nsubset;", 8, "\xe2\x8a\x82\xe2\x83\x92" },
+    { "dlcorn;", 7, "\xe2\x8c\x9e" },
+    { NULL },
+    { "caps;", 5, "\xe2\x88\xa9\xef\xb8\x80" },
+    { "measuredangle;", 14, "\xe2\x88\xa1" },
+    { NULL },
+    { NULL },
+    { "rdquo;", 6, "\xe2\x80\x9d" },
+    { "NotTildeEqual;", 14, "\xe2\x89\x84" },
+    { "bigoplus;", 9, "\xe2\xa8\x81" },
+    { "Udblac;", 7, "\xc5\xb0" },
+    { NULL },
+    { NULL },
+    { "lAtail;", 7, "\xe2\xa4\x9b" },
+    { "dollar;", 7, "\x24" },
+    { "Yscr;", 5, "\xf0\x9d\x92\xb4" },
+    { NULL },
+    { NULL },
+    { "Bfr;", 4, "\xf0\x9d\x94\x85" },
+    { "HumpEqual;", 10, "\xe2\x89\x8f" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "rang;", 5, "\xe2\x9f\xa9" },
+    { "cedil;", 6, "\xc2\xb8" },
+    { NULL },
+    { "DotDot;", 7, "\xe2\x83\x9c" },
+    { "ddagger;", 8, "\xe2\x80\xa1" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Supset;", 7, "\xe2\x8b\x91" },
+    { NULL },
+    { "nrtri;", 6, "\xe2\x8b\xab" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "sup2;", 5, "\xc2\xb2" },
+    { "bull;", 5, "\xe2\x80\xa2" },
+    { "esdot;", 6, "\xe2\x89\x90" },
+    { "SupersetEqual;", 14, "\xe2\x8a\x87" },
+    { NULL },
+    { "ecy;", 4, "\xd1\x8d" },
+    { "boxUr;", 6, "\xe2\x95\x99" },
+    { NULL },
+    { "cir;", 4, "\xe2\x97\x8b" },
+    { "nsube;", 6, "\xe2\x8a\x88" },
+    { NULL },
+    { NULL },
+    { "laquo", 5, "\xc2\xab" },
+    { "boxplus;", 8, "\xe2\x8a\x9e" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "doteq;", 6, "\xe2\x89\x90" },
+    { "real;", 5, "\xe2\x84\x9c" },
+    { "boxminus;", 9, "\xe2\x8a\x9f" },
+    { NULL },
+    { "precapprox;", 11, "\xe2\xaa\xb7" },
+    { NULL },
+    { "szlig;", 6, "\xc3\x9f" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Umacr;", 6, "\xc5\xaa" },
+    { NULL },
+    { NULL },
+    { "raquo", 5, "\xc2\xbb" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "rharul;", 7, "\xe2\xa5\xac" },
+    { "imped;", 6, "\xc6\xb5" },
+    { "ShortUpArrow;", 13, "\xe2\x86\x91" },
+    { NULL },
+    { "Subset;", 7, "\xe2\x8b\x90" },
+    { "NotSucceedsTilde;", 17, "\xe2\x89\xbf\xcc\xb8" },
+    { NULL },
+    { "ufisht;", 7, "\xe2\xa5\xbe" },
+    { "EmptySmallSquare;", 17, "\xe2\x97\xbb" },
+    { NULL },
+    { NULL },
+    { "Ycirc;", 6, "\xc5\xb6" },
+    { NULL },
+    { "gtreqqless;", 11, "\xe2\xaa\x8c" },
+    { "Ecy;", 4, "\xd0\xad" },
+    { "DiacriticalDoubleAcute;", 23, "\xcb\x9d" },
+    { "CircleMinus;", 12, "\xe2\x8a\x96" },
+    { "SubsetEqual;", 12, "\xe2\x8a\x86" },
+    { NULL },
+    { "DoubleLeftArrow;", 16, "\xe2\x87\x90" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "lrarr;", 6, "\xe2\x87\x86" },
+    { NULL },
+    { "angmsdac;", 9, "\xe2\xa6\xaa" },
+    { "PrecedesSlantEqual;", 19, "\xe2\x89\xbc" },
+    { "ngtr;", 5, "\xe2\x89\xaf" },
+    { NULL },
+    { "varpropto;", 10, "\xe2\x88\x9d" },
+    { NULL },
+    { NULL },
+    { "NotNestedLessLess;", 18, "\xe2\xaa\xa1\xcc\xb8" },
+    { "triplus;", 8, "\xe2\xa8\xb9" },
+    { NULL },
+    { NULL },
+    { "mopf;", 5, "\xf0\x9d\x95\x9e" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Oacute;", 7, "\xc3\x93" },
+    { NULL },
+    { "Cedilla;", 8, "\xc2\xb8" },
+    { NULL },
+    { NULL },
+    { "And;", 4, "\xe2\xa9\x93" },
+    { "geq;", 4, "\xe2\x89\xa5" },
+    { NULL },
+    { NULL },
+    { "Dot;", 4, "\xc2\xa8" },
+    { "nexist;", 7, "\xe2\x88\x84" },
+    { "Lambda;", 7, "\xce\x9b" },
+    { "Lscr;", 5, "\xe2\x84\x92" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Gt;", 3, "\xe2\x89\xab" },
+    { NULL },
+    { "yfr;", 4, "\xf0\x9d\x94\xb6" },
+    { "notin;", 6, "\xe2\x88\x89" },
+    { NULL },
+    { NULL },
+    { "eqcolon;", 8, "\xe2\x89\x95" },
+    { "nbsp", 4, "\xc2\xa0" },
+    { NULL },
+    { "iexcl;", 6, "\xc2\xa1" },
+    { "lap;", 4, "\xe2\xaa\x85" },
+    { "SHcy;", 5, "\xd0\xa8" },
+    { "eDot;", 5, "\xe2\x89\x91" },
+    { "urcorner;", 9, "\xe2\x8c\x9d" },
+    { "div;", 4, "\xc3\xb7" },
+    { "duhar;", 6, "\xe2\xa5\xaf" },
+    { NULL },
+    { "deg", 3, "\xc2\xb0" },
+    { NULL },
+    { "eqcirc;", 7, "\xe2\x89\x96" },
+    { NULL },
+    { NULL },
+    { "nsubseteq;", 10, "\xe2\x8a\x88" },
+    { NULL },
+    { "circleddash;", 12, "\xe2\x8a\x9d" },
+    { "iiota;", 6, "\xe2\x84\xa9" },
+    { NULL },
+    { NULL },
+    { "sect", 4, "\xc2\xa7" },
+    { NULL },
+    { NULL },
+    { "Nopf;", 5, "\xe2\x84\x95" },
+    { NULL },
+    { NULL },
+    { "iexcl", 5, "\xc2\xa1" },
+    { "prime;", 6, "\xe2\x80\xb2" },
+    { NULL },
+    { "fopf;", 5, "\xf0\x9d\x95\x97" },
+    { NULL },
+    { "midast;", 7, "\x2a" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Zeta;", 5, "\xce\x96" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "thinsp;", 7, "\xe2\x80\x89" },
+    { "boxHd;", 6, "\xe2\x95\xa4" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Tau;", 4, "\xce\xa4" },
+    { "nvrtrie;", 8, "\xe2\x8a\xb5\xe2\x83\x92" },
+    { NULL },
+    { "Ascr;", 5, "\xf0\x9d\x92\x9c" },
+    { "planck;", 7, "\xe2\x84\x8f" },
+    { NULL },
+    { "lgE;", 4, "\xe2\xaa\x91" },
+    { "boxUR;", 6, "\xe2\x95\x9a" },
+    { NULL },
+    { "block;", 6, "\xe2\x96\x88" },
+    { "vrtri;", 6, "\xe2\x8a\xb3" },
+    { "ncong;", 6, "\xe2\x89\x87" },
+    { NULL },
+    { "boxul;", 6, "\xe2\x94\x98" },
+    { "yucy;", 5, "\xd1\x8e" },
+    { NULL },
+    { "srarr;", 6, "\xe2\x86\x92" },
+    { NULL },
+    { NULL },
+    { "vBarv;", 6, "\xe2\xab\xa9" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "malt;", 5, "\xe2\x9c\xa0" },
+    { NULL },
+    { "timesbar;", 9, "\xe2\xa8\xb1" },
+    { NULL },
+    { NULL },
+    { "orv;", 4, "\xe2\xa9\x9b" },
+    { "opar;", 5, "\xe2\xa6\xb7" },
+    { NULL },
+    { "ropf;", 5, "\xf0\x9d\x95\xa3" },
+    { "udarr;", 6, "\xe2\x87\x85" },
+    { NULL },
+    { NULL },
+    { "euml;", 5, "\xc3\xab" },
+    { NULL },
+    { NULL },
+    { "ldrushar;", 9, "\xe2\xa5\x8b" },
+    { NULL },
+    { "vprop;", 6, "\xe2\x88\x9d" },
+    { NULL },
+    { "plustwo;", 8, "\xe2\xa8\xa7" },
+    { "TripleDot;", 10, "\xe2\x83\x9b" },
+    { "sce;", 4, "\xe2\xaa\xb0" },
+    { "ulcrop;", 7, "\xe2\x8c\x8f" },
+    { "nparsl;", 7, "\xe2\xab\xbd\xe2\x83\xa5" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "bigwedge;", 9, "\xe2\x8b\x80" },
+    { NULL },
+    { "gg;", 3, "\xe2\x89\xab" },
+    { "circledcirc;", 12, "\xe2\x8a\x9a" },
+    { "leftarrowtail;", 14, "\xe2\x86\xa2" },
+    { "rarrhk;", 7, "\xe2\x86\xaa" },
+    { "eacute;", 7, "\xc3\xa9" },
+    { "SuchThat;", 9, "\xe2\x88\x8b" },
+    { "langd;", 6, "\xe2\xa6\x91" },
+    { "semi;", 5, "\x3b" },
+    { "angrt;", 6, "\xe2\x88\x9f" },
+    { "bnot;", 5, "\xe2\x8c\x90" },
+    { "frown;", 6, "\xe2\x8c\xa2" },
+    { "NotGreaterLess;", 15, "\xe2\x89\xb9" },
+    { "acirc;", 6, "\xc3\xa2" },
+    { NULL },
+    { "frac14", 6, "\xc2\xbc" },
+    { "approxeq;", 9, "\xe2\x89\x8a" },
+    { "eDDot;", 6, "\xe2\xa9\xb7" },
+    { NULL },
+    { "rect;", 5, "\xe2\x96\xad" },
+    { NULL },
+    { NULL },
+    { "realine;", 8, "\xe2\x84\x9b" },
+    { NULL },
+    { "NestedLessLess;", 15, "\xe2\x89\xaa" },
+    { "frac34;", 7, "\xc2\xbe" },
+    { "ltcc;", 5, "\xe2\xaa\xa6" },
+    { "VerticalSeparator;", 18, "\xe2\x9d\x98" },
+    { "beth;", 5, "\xe2\x84\xb6" },
+    { NULL },
+    { "eqsim;", 6, "\xe2\x89\x82" },
+    { NULL },
+    { "Dagger;", 7, "\xe2\x80\xa1" },
+    { NULL },
+    { NULL },
+    { "boxdR;", 6, "\xe2\x95\x92" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "pcy;", 4, "\xd0\xbf" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "ShortRightArrow;", 16, "\xe2\x86\x92" },
+    { "diams;", 6, "\xe2\x99\xa6" },
+    { "mp;", 3, "\xe2\x88\x93" },
+    { NULL },
+    { NULL },
+    { "boxHU;", 6, "\xe2\x95\xa9" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Diamond;", 8, "\xe2\x8b\x84" },
+    { "blacktriangleleft;", 18, "\xe2\x97\x82" },
+    { "uHar;", 5, "\xe2\xa5\xa3" },
+    { NULL },
+    { NULL },
+    { "hArr;", 5, "\xe2\x87\x94" },
+    { "sqsub;", 6, "\xe2\x8a\x8f" },
+    { "DiacriticalDot;", 15, "\xcb\x99" },
+    { NULL },
+    { "ubrcy;", 6, "\xd1\x9e" },
+    { "OverParenthesis;", 16, "\xe2\x8f\x9c" },
+    { "hcirc;", 6, "\xc4\xa5" },
+    { NULL },
+    { "trpezium;", 9, "\xe2\x8f\xa2" },
+    { "notni;", 6, "\xe2\x88\x8c" },
+    { NULL },
+    { "LT", 2, "\x3c" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "ouml", 4, "\xc3\xb6" },
+    { NULL },
+    { NULL },
+    { "isinv;", 6, "\xe2\x88\x88" },
+    { "phi;", 4, "\xcf\x86" },
+    { NULL },
+    { "ufr;", 4, "\xf0\x9d\x94\xb2" },
+    { "boxVh;", 6, "\xe2\x95\xab" },
+    { NULL },
+    { "LessFullEqual;", 14, "\xe2\x89\xa6" },
+    { NULL },
+    { "sqsubseteq;", 11, "\xe2\x8a\x91" },
+    { "gfr;", 4, "\xf0\x9d\x94\xa4" },
+    { "lfloor;", 7, "\xe2\x8c\x8a" },
+    { "minusd;", 7, "\xe2\x88\xb8" },
+    { NULL },
+    { "veeeq;", 6, "\xe2\x89\x9a" },
+    { "Uscr;", 5, "\xf0\x9d\x92\xb0" },
+    { "nleq;", 5, "\xe2\x89\xb0" },
+    { "longleftarrow;", 14, "\xe2\x9f\xb5" },
+    { "intprod;", 8, "\xe2\xa8\xbc" },
+    { NULL },
+    { "GreaterFullEqual;", 17, "\xe2\x89\xa7" },
+    { "nsimeq;", 7, "\xe2\x89\x84" },
+    { "ape;", 4, "\xe2\x89\x8a" },
+    { "Vcy;", 4, "\xd0\x92" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "shcy;", 5, "\xd1\x88" },
+    { NULL },
+    { "supplus;", 8, "\xe2\xab\x80" },
+    { NULL },
+    { NULL },
+    { "boxvL;", 6, "\xe2\x95\xa1" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "dcy;", 4, "\xd0\xb4" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "lsime;", 6, "\xe2\xaa\x8d" },
+    { NULL },
+    { "LeftDownVectorBar;", 18, "\xe2\xa5\x99" },
+    { NULL },
+    { "SHCHcy;", 7, "\xd0\xa9" },
+    { "rlarr;", 6, "\xe2\x87\x84" },
+    { NULL },
+    { "rangle;", 7, "\xe2\x9f\xa9" },
+    { "njcy;", 5, "\xd1\x9a" },
+    { NULL },
+    { NULL },
+    { "twixt;", 6, "\xe2\x89\xac" },
+    { "swarhk;", 7, "\xe2\xa4\xa6" },
+    { "tfr;", 4, "\xf0\x9d\x94\xb1" },
+    { "sqsupset;", 9, "\xe2\x8a\x90" },
+    { "radic;", 6, "\xe2\x88\x9a" },
+    { NULL },
+    { "angst;", 6, "\xc3\x85" },
+    { NULL },
+    { "Hopf;", 5, "\xe2\x84\x8d" },
+    { NULL },
+    { "rtrif;", 6, "\xe2\x96\xb8" },
+    { NULL },
+    { "subseteq;", 9, "\xe2\x8a\x86" },
+    { NULL },
+    { "sfrown;", 7, "\xe2\x8c\xa2" },
+    { "curarr;", 7, "\xe2\x86\xb7" },
+    { "Vvdash;", 7, "\xe2\x8a\xaa" },
+    { "boxv;", 5, "\xe2\x94\x82" },
+    { "nmid;", 5, "\xe2\x88\xa4" },
+    { NULL },
+    { "xvee;", 5, "\xe2\x8b\x81" },
+    { "dstrok;", 7, "\xc4\x91" },
+    { NULL },
+    { NULL },
+    { "Larr;", 5, "\xe2\x86\x9e" },
+    { "notinva;", 8, "\xe2\x88\x89" },
+    { NULL },
+    { "SquareSuperset;", 15, "\xe2\x8a\x90" },
+    { "NotNestedGreaterGreater;", 24, "\xe2\xaa\xa2\xcc\xb8" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "frac12", 6, "\xc2\xbd" },
+    { NULL },
+    { "rarr;", 5, "\xe2\x86\x92" },
+    { "wedbar;", 7, "\xe2\xa9\x9f" },
+    { "cemptyv;", 8, "\xe2\xa6\xb2" },
+    { NULL },
+    { "scap;", 5, "\xe2\xaa\xb8" },
+    { "NotCongruent;", 13, "\xe2\x89\xa2" },
+    { "topf;", 5, "\xf0\x9d\x95\xa5" },
+    { "times", 5, "\xc3\x97" },
+    { NULL },
+    { NULL },
+    { "tcaron;", 7, "\xc5\xa5" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "hercon;", 7, "\xe2\x8a\xb9" },
+    { NULL },
+    { NULL },
+    { "rbrack;", 7, "\x5d" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "circledS;", 9, "\xe2\x93\x88" },
+    { "range;", 6, "\xe2\xa6\xa5" },
+    { "TSHcy;", 6, "\xd0\x8b" },
+    { "gnap;", 5, "\xe2\xaa\x8a" },
+    { NULL },
+    { NULL },
+    { "vfr;", 4, "\xf0\x9d\x94\xb3" },
+    { NULL },
+    { "nvDash;", 7, "\xe2\x8a\xad" },
+    { NULL },
+    { "LongRightArrow;", 15, "\xe2\x9f\xb6" },
+    { "UpArrowDownArrow;", 17, "\xe2\x87\x85" },
+    { NULL },
+    { NULL },
+    { "lneq;", 5, "\xe2\xaa\x87" },
+    { NULL },
+    { "ZeroWidthSpace;", 15, "\xe2\x80\x8b" },
+    { "wreath;", 7, "\xe2\x89\x80" },
+    { "pre;", 4, "\xe2\xaa\xaf" },
+    { "Cfr;", 4, "\xe2\x84\xad" },
+    { NULL },
+    { "CHcy;", 5, "\xd0\xa7" },
+    { "LeftTeeVector;", 14, "\xe2\xa5\x9a" },
+    { "eqslantgtr;", 11, "\xe2\xaa\x96" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Hacek;", 6, "\xcb\x87" },
+    { "lbrke;", 6, "\xe2\xa6\x8b" },
+    { NULL },
+    { "gel;", 4, "\xe2\x8b\x9b" },
+    { NULL },
+    { NULL },
+    { "Gg;", 3, "\xe2\x8b\x99" },
+    { "tritime;", 8, "\xe2\xa8\xbb" },
+    { "kappav;", 7, "\xcf\xb0" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "nvHarr;", 7, "\xe2\xa4\x84" },
+    { NULL },
+    { "RightDownTeeVector;", 19, "\xe2\xa5\x9d" },
+    { "ltrif;", 6, "\xe2\x97\x82" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "prnE;", 5, "\xe2\xaa\xb5" },
+    { "ijlig;", 6, "\xc4\xb3" },
+    { NULL },
+    { NULL },
+    { "yen", 3, "\xc2\xa5" },
+    { "gtreqless;", 10, "\xe2\x8b\x9b" },
+    { NULL },
+    { NULL },
+    { "longrightarrow;", 15, "\xe2\x9f\xb6" },
+    { NULL },
+    { NULL },
+    { "IJlig;", 6, "\xc4\xb2" },
+    { NULL },
+    { "orarr;", 6, "\xe2\x86\xbb" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "DJcy;", 5, "\xd0\x82" },
+    { "vee;", 4, "\xe2\x88\xa8" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "gne;", 4, "\xe2\xaa\x88" },
+    { "nhArr;", 6, "\xe2\x87\x8e" },
+    { "Odblac;", 7, "\xc5\x90" },
+    { "Phi;", 4, "\xce\xa6" },
+    { "quot;", 5, "\x22" },
+    { NULL },
+    { "oast;", 5, "\xe2\x8a\x9b" },
+    { NULL },
+    { "leftrightsquigarrow;", 20, "\xe2\x86\xad" },
+    { "Hstrok;", 7, "\xc4\xa6" },
+    { NULL },
+    { NULL },
+    { "Mfr;", 4, "\xf0\x9d\x94\x90" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "searr;", 6, "\xe2\x86\x98" },
+    { "updownarrow;", 12, "\xe2\x86\x95" },
+    { NULL },
+    { "HilbertSpace;", 13, "\xe2\x84\x8b" },
+    { "lbrkslu;", 8, "\xe2\xa6\x8d" },
+    { "icirc", 5, "\xc3\xae" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "not", 3, "\xc2\xac" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Bumpeq;", 7, "\xe2\x89\x8e" },
+    { NULL },
+    { "Jcy;", 4, "\xd0\x99" },
+    { "rAtail;", 7, "\xe2\xa4\x9c" },
+    { "blk14;", 6, "\xe2\x96\x91" },
+    { "gescc;", 6, "\xe2\xaa\xa9" },
+    { "boxVl;", 6, "\xe2\x95\xa2" },
+    { "RightDownVectorBar;", 19, "\xe2\xa5\x95" },
+    { "nedot;", 6, "\xe2\x89\x90\xcc\xb8" },
+    { NULL },
+    { "DZcy;", 5, "\xd0\x8f" },
+    { NULL },
+    { "RightUpTeeVector;", 17, "\xe2\xa5\x9c" },
+    { NULL },
+    { "grave;", 6, "\x60" },
+    { "Oslash;", 7, "\xc3\x98" },
+    { "mscr;", 5, "\xf0\x9d\x93\x82" },
+    { "uacute", 6, "\xc3\xba" },
+    { NULL },
+    { "boxVH;", 6, "\xe2\x95\xac" },
+    { NULL },
+    { "ofcir;", 6, "\xe2\xa6\xbf" },
+    { NULL },
+    { "Cross;", 6, "\xe2\xa8\xaf" },
+    { NULL },
+    { "notinE;", 7, "\xe2\x8b\xb9\xcc\xb8" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "leg;", 4, "\xe2\x8b\x9a" },
+    { "rAarr;", 6, "\xe2\x87\x9b" },
+    { "bkarow;", 7, "\xe2\xa4\x8d" },
+    { "Superset;", 9, "\xe2\x8a\x83" },
+    { NULL },
+    { "vscr;", 5, "\xf0\x9d\x93\x8b" },
+    { NULL },
+    { "LeftTriangleEqual;", 18, "\xe2\x8a\xb4" },
+    { NULL },
+    { NULL },
+    { "Or;", 3, "\xe2\xa9\x94" },
+    { "nleqslant;", 10, "\xe2\xa9\xbd\xcc\xb8" },
+    { "macr;", 5, "\xc2\xaf" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "fnof;", 5, "\xc6\x92" },
+    { "plusdu;", 7, "\xe2\xa8\xa5" },
+    { "ropar;", 6, "\xe2\xa6\x86" },
+    { "RightTee;", 9, "\xe2\x8a\xa2" },
+    { "leftarrow;", 10, "\xe2\x86\x90" },
+    { "sscr;", 5, "\xf0\x9d\x93\x88" },
+    { "check;", 6, "\xe2\x9c\x93" },
+    { "CircleDot;", 10, "\xe2\x8a\x99" },
+    { "zopf;", 5, "\xf0\x9d\x95\xab" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "laquo;", 6, "\xc2\xab" },
+    { "boxUL;", 6, "\xe2\x95\x9d" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "oelig;", 6, "\xc5\x93" },
+    { NULL },
+    { "lAarr;", 6, "\xe2\x87\x9a" },
+    { NULL },
+    { "Afr;", 4, "\xf0\x9d\x94\x84" },
+    { NULL },
+    { NULL },
+    { "frac14;", 7, "\xc2\xbc" },
+    { NULL },
+    { "Ecirc;", 6, "\xc3\x8a" },
+    { "gnE;", 4, "\xe2\x89\xa9" },
+    { "tstrok;", 7, "\xc5\xa7" },
+    { NULL },
+    { "LeftArrowRightArrow;", 20, "\xe2\x87\x86" },
+    { "straightepsilon;", 16, "\xcf\xb5" },
+    { "cscr;", 5, "\xf0\x9d\x92\xb8" },
+    { "RightTriangle;", 14, "\xe2\x8a\xb3" },
+    { NULL },
+    { "Itilde;", 7, "\xc4\xa8" },
+    { "nrArr;", 6, "\xe2\x87\x8f" },
+    { NULL },
+    { "Breve;", 6, "\xcb\x98" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "therefore;", 10, "\xe2\x88\xb4" },
+    { NULL },
+    { "oslash;", 7, "\xc3\xb8" },
+    { NULL },
+    { "andd;", 5, "\xe2\xa9\x9c" },
+    { NULL },
+    { NULL },
+    { "curlyeqprec;", 12, "\xe2\x8b\x9e" },
+    { NULL },
+    { "incare;", 7, "\xe2\x84\x85" },
+    { NULL },
+    { "epsilon;", 8, "\xce\xb5" },
+    { "angle;", 6, "\xe2\x88\xa0" },
+    { NULL },
+    { NULL },
+    { "Aring;", 6, "\xc3\x85" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "lcedil;", 7, "\xc4\xbc" },
+    { "alefsym;", 8, "\xe2\x84\xb5" },
+    { "Eacute;", 7, "\xc3\x89" },
+    { "Union;", 6, "\xe2\x8b\x83" },
+    { "rangd;", 6, "\xe2\xa6\x92" },
+    { NULL },
+    { NULL },
+    { "lbrack;", 7, "\x5b" },
+    { NULL },
+    { NULL },
+    { "ShortDownArrow;", 15, "\xe2\x86\x93" },
+    { "isindot;", 8, "\xe2\x8b\xb5" },
+    { NULL },
+    { "UnderParenthesis;", 17, "\xe2\x8f\x9d" },
+    { "gopf;", 5, "\xf0\x9d\x95\x98" },
+    { "KJcy;", 5, "\xd0\x8c" },
+    { NULL },
+    { "af;", 3, "\xe2\x81\xa1" },
+    { "Sum;", 4, "\xe2\x88\x91" },
+    { NULL },
+    { "ogon;", 5, "\xcb\x9b" },
+    { NULL },
+    { NULL },
+    { "gesdoto;", 8, "\xe2\xaa\x82" },
+    { "Aopf;", 5, "\xf0\x9d\x94\xb8" },
+    { "Jsercy;", 7, "\xd0\x88" },
+    { "subedot;", 8, "\xe2\xab\x83" },
+    { NULL },
+    { "UnderBar;", 9, "\x5f" },
+    { NULL },
+    { NULL },
+    { "softcy;", 7, "\xd1\x8c" },
+    { "minusdu;", 8, "\xe2\xa8\xaa" },
+    { NULL },
+    { "Icirc", 5, "\xc3\x8e" },
+    { "Aogon;", 6, "\xc4\x84" },
+    { "gt", 2, "\x3e" },
+    { "map;", 4, "\xe2\x86\xa6" },
+    { NULL },
+    { NULL },
+    { "omid;", 5, "\xe2\xa6\xb6" },
+    { NULL },
+    { NULL },
+    { "primes;", 7, "\xe2\x84\x99" },
+    { "ocirc", 5, "\xc3\xb4" },
+    { NULL },
+    { "NotSucceedsEqual;", 17, "\xe2\xaa\xb0\xcc\xb8" },
+    { NULL },
+    { NULL },
+    { "epsi;", 5, "\xce\xb5" },
+    { NULL },
+    { NULL },
+    { "DoubleLongRightArrow;", 21, "\xe2\x9f\xb9" },
+    { "nbumpe;", 7, "\xe2\x89\x8f\xcc\xb8" },
+    { "sc;", 3, "\xe2\x89\xbb" },
+    { "trisb;", 6, "\xe2\xa7\x8d" },
+    { NULL },
+    { "slarr;", 6, "\xe2\x86\x90" },
+    { "uharl;", 6, "\xe2\x86\xbf" },
+    { "ngsim;", 6, "\xe2\x89\xb5" },
+    { NULL },
+    { "Wfr;", 4, "\xf0\x9d\x94\x9a" },
+    { "Ofr;", 4, "\xf0\x9d\x94\x92" },
+    { "Hscr;", 5, "\xe2\x84\x8b" },
+    { NULL },
+    { "DownBreve;", 10, "\xcc\x91" },
+    { "checkmark;", 10, "\xe2\x9c\x93" },
+    { NULL },
+    { NULL },
+    { "caron;", 6, "\xcb\x87" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Hfr;", 4, "\xe2\x84\x8c" },
+    { "lcaron;", 7, "\xc4\xbe" },
+    { NULL },
+    { NULL },
+    { "trianglelefteq;", 15, "\xe2\x8a\xb4" },
+    { NULL },
+    { NULL },
+    { "Acirc", 5, "\xc3\x82" },
+    { "centerdot;", 10, "\xc2\xb7" },
+    { "iecy;", 5, "\xd0\xb5" },
+    { NULL },
+    { "rmoustache;", 11, "\xe2\x8e\xb1" },
+    { NULL },
+    { "frac18;", 7, "\xe2\x85\x9b" },
+    { NULL },
+    { "demptyv;", 8, "\xe2\xa6\xb1" },
+    { NULL },
+    { "Rarr;", 5, "\xe2\x86\xa0" },
+    { NULL },
+    { "nabla;", 6, "\xe2\x88\x87" },
+    { "ee;", 3, "\xe2\x85\x87" },
+    { "qprime;", 7, "\xe2\x81\x97" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Eopf;", 5, "\xf0\x9d\x94\xbc" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "ges;", 4, "\xe2\xa9\xbe" },
+    { NULL },
+    { "subplus;", 8, "\xe2\xaa\xbf" },
+    { "KHcy;", 5, "\xd0\xa5" },
+    { "Lcaron;", 7, "\xc4\xbd" },
+    { "nearr;", 6, "\xe2\x86\x97" },
+    { NULL },
+    { "Uparrow;", 8, "\xe2\x87\x91" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "circlearrowright;", 17, "\xe2\x86\xbb" },
+    { "pitchfork;", 10, "\xe2\x8b\x94" },
+    { "because;", 8, "\xe2\x88\xb5" },
+    { NULL },
+    { "gtlPar;", 7, "\xe2\xa6\x95" },
+    { NULL },
+    { "Vopf;", 5, "\xf0\x9d\x95\x8d" },
+    { NULL },
+    { "sqcaps;", 7, "\xe2\x8a\x93\xef\xb8\x80" },
+    { "dlcrop;", 7, "\xe2\x8c\x8d" },
+    { NULL },
+    { "gtcc;", 5, "\xe2\xaa\xa7" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "lescc;", 6, "\xe2\xaa\xa8" },
+    { "Egrave;", 7, "\xc3\x88" },
+    { NULL },
+    { "Ouml", 4, "\xc3\x96" },
+    { NULL },
+    { "NotSquareSubset;", 16, "\xe2\x8a\x8f\xcc\xb8" },
+    { NULL },
+    { "rpargt;", 7, "\xe2\xa6\x94" },
+    { "awconint;", 9, "\xe2\x88\xb3" },
+    { "rarrpl;", 7, "\xe2\xa5\x85" },
+    { "nLl;", 4, "\xe2\x8b\x98\xcc\xb8" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "mfr;", 4, "\xf0\x9d\x94\xaa" },
+    { NULL },
+    { "Icirc;", 6, "\xc3\x8e" },
+    { "COPY", 4, "\xc2\xa9" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "bottom;", 7, "\xe2\x8a\xa5" },
+    { "lsquo;", 6, "\xe2\x80\x98" },
+    { NULL },
+    { "jfr;", 4, "\xf0\x9d\x94\xa7" },
+    { "Hcirc;", 6, "\xc4\xa4" },
+    { NULL },
+    { "rarrb;", 6, "\xe2\x87\xa5" },
+    { NULL },
+    { "plusacir;", 9, "\xe2\xa8\xa3" },
+    { NULL },
+    { "uwangle;", 8, "\xe2\xa6\xa7" },
+    { NULL },
+    { NULL },
+    { "bigtriangleup;", 14, "\xe2\x96\xb3" },
+    { "npre;", 5, "\xe2\xaa\xaf\xcc\xb8" },
+    { NULL },
+    { "aring", 5, "\xc3\xa5" },
+    { "NotSquareSupersetEqual;", 23, "\xe2\x8b\xa3" },
+    { NULL },
+    { "loplus;", 7, "\xe2\xa8\xad" },
+    { NULL },
+    { "NotSucceeds;", 12, "\xe2\x8a\x81" },
+    { "Colon;", 6, "\xe2\x88\xb7" },
+    { "ntilde", 6, "\xc3\xb1" },
+    { "ltdot;", 6, "\xe2\x8b\x96" },
+    { "divide;", 7, "\xc3\xb7" },
+    { NULL },
+    { "vartheta;", 9, "\xcf\x91" },
+    { "Integral;", 9, "\xe2\x88\xab" },
+    { "integers;", 9, "\xe2\x84\xa4" },
+    { "searrow;", 8, "\xe2\x86\x98" },
+    { NULL },
+    { "tscy;", 5, "\xd1\x86" },
+    { "mDDot;", 6, "\xe2\x88\xba" },
+    { NULL },
+    { NULL },
+    { "swArr;", 6, "\xe2\x87\x99" },
+    { "leftrightarrows;", 16, "\xe2\x87\x86" },
+    { "zacute;", 7, "\xc5\xba" },
+    { NULL },
+    { "becaus;", 7, "\xe2\x88\xb5" },
+    { "NotPrecedesEqual;", 17, "\xe2\xaa\xaf\xcc\xb8" },
+    { NULL },
+    { "YAcy;", 5, "\xd0\xaf" },
+    { NULL },
+    { "elsdot;", 7, "\xe2\xaa\x97" },
+    { "ldsh;", 5, "\xe2\x86\xb2" },
+    { "LongLeftArrow;", 14, "\xe2\x9f\xb5" },
+    { "ccirc;", 6, "\xc4\x89" },
+    { NULL },
+    { "Tcy;", 4, "\xd0\xa2" },
+    { "quot", 4, "\x22" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Ecaron;", 7, "\xc4\x9a" },
+    { "Longleftrightarrow;", 19, "\xe2\x9f\xba" },
+    { NULL },
+    { "nVdash;", 7, "\xe2\x8a\xae" },
+    { "lbarr;", 6, "\xe2\xa4\x8c" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "oplus;", 6, "\xe2\x8a\x95" },
+    { NULL },
+    { "UpArrow;", 8, "\xe2\x86\x91" },
+    { "Sscr;", 5, "\xf0\x9d\x92\xae" },
+    { "NotGreaterGreater;", 18, "\xe2\x89\xab\xcc\xb8" },
+    { NULL },
+    { "ii;", 3, "\xe2\x85\x88" },
+    { "PartialD;", 9, "\xe2\x88\x82" },
+    { "copysr;", 7, "\xe2\x84\x97" },
+    { "vnsub;", 6, "\xe2\x8a\x82\xe2\x83\x92" },
+    { NULL },
+    { "vArr;", 5, "\xe2\x87\x95" },
+    { NULL },
+    { "frac25;", 7, "\xe2\x85\x96" },
+    { NULL },
+    { "DownTee;", 8, "\xe2\x8a\xa4" },
+    { "target;", 7, "\xe2\x8c\x96" },
+    { "square;", 7, "\xe2\x96\xa1" },
+    { "female;", 7, "\xe2\x99\x80" },
+    { NULL },
+    { "Square;", 7, "\xe2\x96\xa1" },
+    { "chcy;", 5, "\xd1\x87" },
+    { NULL },
+    { "Oslash", 6, "\xc3\x98" },
+    { "Cayleys;", 8, "\xe2\x84\xad" },
+    { NULL },
+    { NULL },
+    { "lhblk;", 6, "\xe2\x96\x84" },
+    { NULL },
+    { NULL },
+    { "cwint;", 6, "\xe2\x88\xb1" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "cwconint;", 9, "\xe2\x88\xb2" },
+    { NULL },
+    { NULL },
+    { "scnsim;", 7, "\xe2\x8b\xa9" },
+    { NULL },
+    { "Ccirc;", 6, "\xc4\x88" },
+    { "nLt;", 4, "\xe2\x89\xaa\xe2\x83\x92" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "NotLessLess;", 12, "\xe2\x89\xaa\xcc\xb8" },
+    { "lsaquo;", 7, "\xe2\x80\xb9" },
+    { NULL },
+    { "AElig", 5, "\xc3\x86" },
+    { NULL },
+    { NULL },
+    { "hfr;", 4, "\xf0\x9d\x94\xa5" },
+    { "rdquor;", 7, "\xe2\x80\x9d" },
+    { NULL },
+    { "supsim;", 7, "\xe2\xab\x88" },
+    { "thicksim;", 9, "\xe2\x88\xbc" },
+    { NULL },
+    { "scpolint;", 9, "\xe2\xa8\x93" },
+    { "numsp;", 6, "\xe2\x80\x87" },
+    { "diam;", 5, "\xe2\x8b\x84" },
+    { NULL },
+    { "ugrave;", 7, "\xc3\xb9" },
+    { NULL },
+    { "cirmid;", 7, "\xe2\xab\xaf" },
+    { "acute", 5, "\xc2\xb4" },
+    { "spar;", 5, "\xe2\x88\xa5" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "rarrbfs;", 8, "\xe2\xa4\xa0" },
+    { "lesges;", 7, "\xe2\xaa\x93" },
+    { "andand;", 7, "\xe2\xa9\x95" },
+    { "propto;", 7, "\xe2\x88\x9d" },
+    { "lnsim;", 6, "\xe2\x8b\xa6" },
+    { NULL },
+    { NULL },
+    { "ltri;", 5, "\xe2\x97\x83" },
+    { NULL },
+    { "nLeftrightarrow;", 16, "\xe2\x87\x8e" },
+    { "lEg;", 4, "\xe2\xaa\x8b" },
+    { "DoubleLongLeftArrow;", 20, "\xe2\x9f\xb8" },
+    { "LessLess;", 9, "\xe2\xaa\xa1" },
+    { NULL },
+    { "succnsim;", 9, "\xe2\x8b\xa9" },
+    { NULL },
+    { "fltns;", 6, "\xe2\x96\xb1" },
+    { "NJcy;", 5, "\xd0\x8a" },
+    { NULL },
+    { "Uuml", 4, "\xc3\x9c" },
+    { "aacute", 6, "\xc3\xa1" },
+    { NULL },
+    { "Int;", 4, "\xe2\x88\xac" },
+    { "twoheadleftarrow;", 17, "\xe2\x86\x9e" },
+    { "lmoustache;", 11, "\xe2\x8e\xb0" },
+    { "frac15;", 7, "\xe2\x85\x95" },
+    { "kjcy;", 5, "\xd1\x9c" },
+    { "Congruent;", 10, "\xe2\x89\xa1" },
+    { NULL },
+    { "bcong;", 6, "\xe2\x89\x8c" },
+    { "isinE;", 6, "\xe2\x8b\xb9" },
+    { NULL },
+    { NULL },
+    { "Uogon;", 6, "\xc5\xb2" },
+    { "zscr;", 5, "\xf0\x9d\x93\x8f" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "dscy;", 5, "\xd1\x95" },
+    { "iopf;", 5, "\xf0\x9d\x95\x9a" },
+    { "chi;", 4, "\xcf\x87" },
+    { "cap;", 4, "\xe2\x88\xa9" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "NotLeftTriangle;", 16, "\xe2\x8b\xaa" },
+    { "imagline;", 9, "\xe2\x84\x90" },
+    { NULL },
+    { "gesdotol;", 9, "\xe2\xaa\x84" },
+    { NULL },
+    { NULL },
+    { "triangle;", 9, "\xe2\x96\xb5" },
+    { "Wedge;", 6, "\xe2\x8b\x80" },
+    { NULL },
+    { "coprod;", 7, "\xe2\x88\x90" },
+    { "Nacute;", 7, "\xc5\x83" },
+    { "smile;", 6, "\xe2\x8c\xa3" },
+    { "nap;", 4, "\xe2\x89\x89" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "suphsol;", 8, "\xe2\x9f\x89" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "shy;", 4, "\xc2\xad" },
+    { "Coproduct;", 10, "\xe2\x88\x90" },
+    { "cupdot;", 7, "\xe2\x8a\x8d" },
+    { "otimes;", 7, "\xe2\x8a\x97" },
+    { "cups;", 5, "\xe2\x88\xaa\xef\xb8\x80" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "rhard;", 6, "\xe2\x87\x81" },
+    { NULL },
+    { "ngt;", 4, "\xe2\x89\xaf" },
+    { "subsetneq;", 10, "\xe2\x8a\x8a" },
+    { "rrarr;", 6, "\xe2\x87\x89" },
+    { "Gbreve;", 7, "\xc4\x9e" },
+    { NULL },
+    { "edot;", 5, "\xc4\x97" },
+    { "Chi;", 4, "\xce\xa7" },
+    { NULL },
+    { "barwed;", 7, "\xe2\x8c\x85" },
+    { "tilde;", 6, "\xcb\x9c" },
+    { "HARDcy;", 7, "\xd0\xaa" },
+    { NULL },
+    { "triangleright;", 14, "\xe2\x96\xb9" },
+    { NULL },
+    { "plankv;", 7, "\xe2\x84\x8f" },
+    { NULL },
+    { "DifferentialD;", 14, "\xe2\x85\x86" },
+    { "fpartint;", 9, "\xe2\xa8\x8d" },
+    { NULL },
+    { "Rcaron;", 7, "\xc5\x98" },
+    { "utilde;", 7, "\xc5\xa9" },
+    { "colon;", 6, "\x3a" },
+    { NULL },
+    { "otilde", 6, "\xc3\xb5" },
+    { "Cup;", 4, "\xe2\x8b\x93" },
+    { NULL },
+    { "Rrightarrow;", 12, "\xe2\x87\x9b" },
+    { NULL },
+    { "ast;", 4, "\x2a" },
+    { NULL },
+    { "nearrow;", 8, "\xe2\x86\x97" },
+    { NULL },
+    { NULL },
+    { "supseteqq;", 10, "\xe2\xab\x86" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "zwj;", 4, "\xe2\x80\x8d" },
+    { "ldrdhar;", 8, "\xe2\xa5\xa7" },
+    { NULL },
+    { "Tcaron;", 7, "\xc5\xa4" },
+    { "cuvee;", 6, "\xe2\x8b\x8e" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "lesssim;", 8, "\xe2\x89\xb2" },
+    { NULL },
+    { "gvertneqq;", 10, "\xe2\x89\xa9\xef\xb8\x80" },
+    { NULL },
+    { "frac34", 6, "\xc2\xbe" },
+    { "ouml;", 5, "\xc3\xb6" },
+    { NULL },
+    { "Not;", 4, "\xe2\xab\xac" },
+    { "pscr;", 5, "\xf0\x9d\x93\x85" },
+    { "xwedge;", 7, "\xe2\x8b\x80" },
+    { "nle;", 4, "\xe2\x89\xb0" },
+    { NULL },
+    { NULL },
+    { "OpenCurlyDoubleQuote;", 21, "\xe2\x80\x9c" },
+    { "sqsube;", 7, "\xe2\x8a\x91" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "there4;", 7, "\xe2\x88\xb4" },
+    { "nscr;", 5, "\xf0\x9d\x93\x83" },
+    { "GT", 2, "\x3e" },
+    { NULL },
+    { "Iuml", 4, "\xc3\x8f" },
+    { "bernou;", 7, "\xe2\x84\xac" },
+    { "rbbrk;", 6, "\xe2\x9d\xb3" },
+    { "LeftUpTeeVector;", 16, "\xe2\xa5\xa0" },
+    { "gacute;", 7, "\xc7\xb5" },
+    { "Fcy;", 4, "\xd0\xa4" },
+    { "boxur;", 6, "\xe2\x94\x94" },
+    { "bumpe;", 6, "\xe2\x89\x8f" },
+    { NULL },
+    { NULL },
+    { "rbrace;", 7, "\x7d" },
+    { NULL },
+    { "vsupne;", 7, "\xe2\x8a\x8b\xef\xb8\x80" },
+    { NULL },
+    { "lesg;", 5, "\xe2\x8b\x9a\xef\xb8\x80" },
+    { "mho;", 4, "\xe2\x84\xa7" },
+    { "rBarr;", 6, "\xe2\xa4\x8f" },
+    { NULL },
+    { "Ecirc", 5, "\xc3\x8a" },
+    { "lbrksld;", 8, "\xe2\xa6\x8f" },
+    { "kappa;", 6, "\xce\xba" },
+    { NULL },
+    { "nsce;", 5, "\xe2\xaa\xb0\xcc\xb8" },
+    { "gcy;", 4, "\xd0\xb3" },
+    { "asymp;", 6, "\xe2\x89\x88" },
+    { NULL },
+    { "nges;", 5, "\xe2\xa9\xbe\xcc\xb8" },
+    { "ccups;", 6, "\xe2\xa9\x8c" },
+    { NULL },
+    { NULL },
+    { "larrb;", 6, "\xe2\x87\xa4" },
+    { NULL },
+    { NULL },
+    { "complement;", 11, "\xe2\x88\x81" },
+    { "DoubleUpArrow;", 14, "\xe2\x87\x91" },
+    { NULL },
+    { "operp;", 6, "\xe2\xa6\xb9" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "ContourIntegral;", 16, "\xe2\x88\xae" },
+    { "excl;", 5, "\x21" },
+    { "mcy;", 4, "\xd0\xbc" },
+    { NULL },
+    { "leftthreetimes;", 15, "\xe2\x8b\x8b" },
+    { NULL },
+    { "lceil;", 6, "\xe2\x8c\x88" },
+    { NULL },
+    { "parsl;", 6, "\xe2\xab\xbd" },
+    { NULL },
+    { "boxHu;", 6, "\xe2\x95\xa7" },
+    { "maltese;", 8, "\xe2\x9c\xa0" },
+    { "CapitalDifferentialD;", 21, "\xe2\x85\x85" },
+    { NULL },
+    { "Oscr;", 5, "\xf0\x9d\x92\xaa" },
+    { "rArr;", 5, "\xe2\x87\x92" },
+    { NULL },
+    { NULL },
+    { "ne;", 3, "\xe2\x89\xa0" },
+    { NULL },
+    { "ltlarr;", 7, "\xe2\xa5\xb6" },
+    { NULL },
+    { "rightarrow;", 11, "\xe2\x86\x92" },
+    { "ffilig;", 7, "\xef\xac\x83" },
+    { NULL },
+    { "Xi;", 3, "\xce\x9e" },
+    { "Euml;", 5, "\xc3\x8b" },
+    { "Wopf;", 5, "\xf0\x9d\x95\x8e" },
+    { "heartsuit;", 10, "\xe2\x99\xa5" },
+    { "Egrave", 6, "\xc3\x88" },
+    { "Ropf;", 5, "\xe2\x84\x9d" },
+    { NULL },
+    { NULL },
+    { "icirc;", 6, "\xc3\xae" },
+    { "gammad;", 7, "\xcf\x9d" },
+    { "Lt;", 3, "\xe2\x89\xaa" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Dopf;", 5, "\xf0\x9d\x94\xbb" },
+    { "sopf;", 5, "\xf0\x9d\x95\xa4" },
+    { "DiacriticalGrave;", 17, "\x60" },
+    { "sup3;", 5, "\xc2\xb3" },
+    { "lsquor;", 7, "\xe2\x80\x9a" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "NotExists;", 10, "\xe2\x88\x84" },
+    { "blacklozenge;", 13, "\xe2\xa7\xab" },
+    { NULL },
+    { "escr;", 5, "\xe2\x84\xaf" },
+    { NULL },
+    { NULL },
+    { "iinfin;", 7, "\xe2\xa7\x9c" },
+    { NULL },
+    { NULL },
+    { "ForAll;", 7, "\xe2\x88\x80" },
+    { "xrArr;", 6, "\xe2\x9f\xb9" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Leftrightarrow;", 15, "\xe2\x87\x94" },
+    { NULL },
+    { NULL },
+    { "ccaron;", 7, "\xc4\x8d" },
+    { NULL },
+    { "trade;", 6, "\xe2\x84\xa2" },
+    { "pr;", 3, "\xe2\x89\xba" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "nang;", 5, "\xe2\x88\xa0\xe2\x83\x92" },
+    { NULL },
+    { "LeftVector;", 11, "\xe2\x86\xbc" },
+    { "upharpoonleft;", 14, "\xe2\x86\xbf" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Uopf;", 5, "\xf0\x9d\x95\x8c" },
+    { "nsucc;", 6, "\xe2\x8a\x81" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "frac23;", 7, "\xe2\x85\x94" },
+    { "ldquor;", 7, "\xe2\x80\x9e" },
+    { NULL },
+    { NULL },
+    { "RightUpDownVector;", 18, "\xe2\xa5\x8f" },
+    { NULL },
+    { "smt;", 4, "\xe2\xaa\xaa" },
+    { NULL },
+    { "Qscr;", 5, "\xf0\x9d\x92\xac" },
+    { "ifr;", 4, "\xf0\x9d\x94\xa6" },
+    { NULL },
+    { "theta;", 6, "\xce\xb8" },
+    { "ntriangleright;", 15, "\xe2\x8b\xab" },
+    { NULL },
+    { "UpDownArrow;", 12, "\xe2\x86\x95" },
+    { NULL },
+    { "angmsdah;", 9, "\xe2\xa6\xaf" },
+    { NULL },
+    { "simeq;", 6, "\xe2\x89\x83" },
+    { "Kcedil;", 7, "\xc4\xb6" },
+    { "raquo;", 6, "\xc2\xbb" },
+    { NULL },
+    { "eth", 3, "\xc3\xb0" },
+    { "Lmidot;", 7, "\xc4\xbf" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "RightDoubleBracket;", 19, "\xe2\x9f\xa7" },
+    { NULL },
+    { "TScy;", 5, "\xd0\xa6" },
+    { NULL },
+    { NULL },
+    { "gesl;", 5, "\xe2\x8b\x9b\xef\xb8\x80" },
+    { "DownArrowBar;", 13, "\xe2\xa4\x93" },
+    { "Bcy;", 4, "\xd0\x91" },
+    { "erDot;", 6, "\xe2\x89\x93" },
+    { "nvle;", 5, "\xe2\x89\xa4\xe2\x83\x92" },
+    { "NotRightTriangle;", 17, "\xe2\x8b\xab" },
+    { "Iacute;", 7, "\xc3\x8d" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Iota;", 5, "\xce\x99" },
+    { "varsupsetneqq;", 14, "\xe2\xab\x8c\xef\xb8\x80" },
+    { "strns;", 6, "\xc2\xaf" },
+    { "or;", 3, "\xe2\x88\xa8" },
+    { "gbreve;", 7, "\xc4\x9f" },
+    { NULL },
+    { NULL },
+    { "nvge;", 5, "\xe2\x89\xa5\xe2\x83\x92" },
+    { "boxVL;", 6, "\xe2\x95\xa3" },
+    { NULL },
+    { NULL },
+    { "Atilde;", 7, "\xc3\x83" },
+    { NULL },
+    { NULL },
+    { "Tab;", 4, "\x09" },
+    { "omega;", 6, "\xcf\x89" },
+    { NULL },
+    { NULL },
+    { "Therefore;", 10, "\xe2\x88\xb4" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "xuplus;", 7, "\xe2\xa8\x84" },
+    { "Iscr;", 5, "\xe2\x84\x90" },
+    { "subsetneqq;", 11, "\xe2\xab\x8b" },
+    { NULL },
+    { "daleth;", 7, "\xe2\x84\xb8" },
+    { "hybull;", 7, "\xe2\x81\x83" },
+    { "SquareUnion;", 12, "\xe2\x8a\x94" },
+    { "die;", 4, "\xc2\xa8" },
+    { NULL },
+    { NULL },
+    { "subset;", 7, "\xe2\x8a\x82" },
+    { "ldquo;", 6, "\xe2\x80\x9c" },
+    { "cupor;", 6, "\xe2\xa9\x85" },
+    { "Edot;", 5, "\xc4\x96" },
+    { NULL },
+    { "angrtvbd;", 9, "\xe2\xa6\x9d" },
+    { "rarrw;", 6, "\xe2\x86\x9d" },
+    { "backprime;", 10, "\xe2\x80\xb5" },
+    { NULL },
+    { NULL },
+    { "nopf;", 5, "\xf0\x9d\x95\x9f" },
+    { "Iogon;", 6, "\xc4\xae" },
+    { NULL },
+    { NULL },
+    { "Ufr;", 4, "\xf0\x9d\x94\x98" },
+    { "napid;", 6, "\xe2\x89\x8b\xcc\xb8" },
+    { "middot;", 7, "\xc2\xb7" },
+    { "supdsub;", 8, "\xe2\xab\x98" },
+    { NULL },
+    { "crarr;", 6, "\xe2\x86\xb5" },
+    { NULL },
+    { "sube;", 5, "\xe2\x8a\x86" },
+    { NULL },
+    { NULL },
+    { "abreve;", 7, "\xc4\x83" },
+    { "rmoust;", 7, "\xe2\x8e\xb1" },
+    { "topcir;", 7, "\xe2\xab\xb1" },
+    { NULL },
+    { "varsigma;", 9, "\xcf\x82" },
+    { "Kopf;", 5, "\xf0\x9d\x95\x82" },
+    { "Ccedil;", 7, "\xc3\x87" },
+    { "ocir;", 5, "\xe2\x8a\x9a" },
+    { NULL },
+    { NULL },
+    { "nGtv;", 5, "\xe2\x89\xab\xcc\xb8" },
+    { NULL },
+    { "gnsim;", 6, "\xe2\x8b\xa7" },
+    { "LeftDownTeeVector;", 18, "\xe2\xa5\xa1" },
+    { NULL },
+    { NULL },
+    { "Ucy;", 4, "\xd0\xa3" },
+    { NULL },
+    { "nRightarrow;", 12, "\xe2\x87\x8f" },
+    { "GT;", 3, "\x3e" },
+    { NULL },
+    { "Precedes;", 9, "\xe2\x89\xba" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "equest;", 7, "\xe2\x89\x9f" },
+    { "harrw;", 6, "\xe2\x86\xad" },
+    { NULL },
+    { "lobrk;", 6, "\xe2\x9f\xa6" },
+    { "lE;", 3, "\xe2\x89\xa6" },
+    { "sharp;", 6, "\xe2\x99\xaf" },
+    { NULL },
+    { NULL },
+    { "bsime;", 6, "\xe2\x8b\x8d" },
+    { NULL },
+    { "lopf;", 5, "\xf0\x9d\x95\x9d" },
+    { "boxuL;", 6, "\xe2\x95\x9b" },
+    { "rcaron;", 7, "\xc5\x99" },
+    { "lnapprox;", 9, "\xe2\xaa\x89" },
+    { "Rfr;", 4, "\xe2\x84\x9c" },
+    { NULL },
+    { "ccaps;", 6, "\xe2\xa9\x8d" },
+    { "phone;", 6, "\xe2\x98\x8e" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "lesdot;", 7, "\xe2\xa9\xbf" },
+    { NULL },
+    { "ni;", 3, "\xe2\x88\x8b" },
+    { "cire;", 5, "\xe2\x89\x97" },
+    { "ge;", 3, "\xe2\x89\xa5" },
+    { "vltri;", 6, "\xe2\x8a\xb2" },
+    { NULL },
+    { "NotSuperset;", 12, "\xe2\x8a\x83\xe2\x83\x92" },
+    { "xutri;", 6, "\xe2\x96\xb3" },
+    { NULL },
+    { "afr;", 4, "\xf0\x9d\x94\x9e" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "mumap;", 6, "\xe2\x8a\xb8" },
+    { NULL },
+    { "urcrop;", 7, "\xe2\x8c\x8e" },
+    { NULL },
+    { "models;", 7, "\xe2\x8a\xa7" },
+    { NULL },
+    { "UnionPlus;", 10, "\xe2\x8a\x8e" },
+    { NULL },
+    { NULL },
+    { "Eogon;", 6, "\xc4\x98" },
+    { NULL },
+    { "LeftArrowBar;", 13, "\xe2\x87\xa4" },
+    { "sqsupseteq;", 11, "\xe2\x8a\x92" },
+    { "angmsdag;", 9, "\xe2\xa6\xae" },
+    { NULL },
+    { "angmsd;", 7, "\xe2\x88\xa1" },
+    { NULL },
+    { NULL },
+    { "rotimes;", 8, "\xe2\xa8\xb5" },
+    { NULL },
+    { "DoubleContourIntegral;", 22, "\xe2\x88\xaf" },
+    { "looparrowright;", 15, "\xe2\x86\xac" },
+    { "CirclePlus;", 11, "\xe2\x8a\x95" },
+    { NULL },
+    { "bsemi;", 6, "\xe2\x81\x8f" },
+    { NULL },
+    { "capdot;", 7, "\xe2\xa9\x80" },
+    { "efDot;", 6, "\xe2\x89\x92" },
+    { NULL },
+    { NULL },
+    { "capcap;", 7, "\xe2\xa9\x8b" },
+    { "NotSupersetEqual;", 17, "\xe2\x8a\x89" },
+    { "Sfr;", 4, "\xf0\x9d\x94\x96" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Ograve", 6, "\xc3\x92" },
+    { NULL },
+    { NULL },
+    { "blacktriangleright;", 19, "\xe2\x96\xb8" },
+    { "FilledVerySmallSquare;", 22, "\xe2\x96\xaa" },
+    { NULL },
+    { "Aring", 5, "\xc3\x85" },
+    { "Rscr;", 5, "\xe2\x84\x9b" },
+    { "LeftTeeArrow;", 13, "\xe2\x86\xa4" },
+    { "Epsilon;", 8, "\xce\x95" },
+    { "LeftRightVector;", 16, "\xe2\xa5\x8e" },
+    { NULL },
+    { NULL },
+    { "squ;", 4, "\xe2\x96\xa1" },
+    { "iprod;", 6, "\xe2\xa8\xbc" },
+    { "hslash;", 7, "\xe2\x84\x8f" },
+    { "glE;", 4, "\xe2\xaa\x92" },
+    { "lessdot;", 8, "\xe2\x8b\x96" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "apos;", 5, "\x27" },
+    { "cupcap;", 7, "\xe2\xa9\x86" },
+    { NULL },
+    { "minus;", 6, "\xe2\x88\x92" },
+    { "reg", 3, "\xc2\xae" },
+    { NULL },
+    { NULL },
+    { "fallingdotseq;", 14, "\xe2\x89\x92" },
+    { NULL },
+    { NULL },
+    { "cirE;", 5, "\xe2\xa7\x83" },
+    { "LowerRightArrow;", 16, "\xe2\x86\x98" },
+    { "subnE;", 6, "\xe2\xab\x8b" },
+    { "ovbar;", 6, "\xe2\x8c\xbd" },
+    { "UpperLeftArrow;", 15, "\xe2\x86\x96" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "lArr;", 5, "\xe2\x87\x90" },
+    { "ffr;", 4, "\xf0\x9d\x94\xa3" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "bump;", 5, "\xe2\x89\x8e" },
+    { NULL },
+    { "NotRightTriangleBar;", 20, "\xe2\xa7\x90\xcc\xb8" },
+    { "leqslant;", 9, "\xe2\xa9\xbd" },
+    { NULL },
+    { "frac45;", 7, "\xe2\x85\x98" },
+    { "gimel;", 6, "\xe2\x84\xb7" },
+    { "precnapprox;", 12, "\xe2\xaa\xb9" },
+    { "yuml;", 5, "\xc3\xbf" },
+    { NULL },
+    { "tridot;", 7, "\xe2\x97\xac" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Beta;", 5, "\xce\x92" },
+    { "lowbar;", 7, "\x5f" },
+    { "Scaron;", 7, "\xc5\xa0" },
+    { NULL },
+    { "lowast;", 7, "\xe2\x88\x97" },
+    { "Yacute", 6, "\xc3\x9d" },
+    { NULL },
+    { "amalg;", 6, "\xe2\xa8\xbf" },
+    { NULL },
+    { "dblac;", 6, "\xcb\x9d" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "subsub;", 7, "\xe2\xab\x95" },
+    { "prE;", 4, "\xe2\xaa\xb3" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "supe;", 5, "\xe2\x8a\x87" },
+    { "supset;", 7, "\xe2\x8a\x83" },
+    { "CounterClockwiseContourIntegral;", 32, "\xe2\x88\xb3" },
+    { "Intersection;", 13, "\xe2\x8b\x82" },
+    { NULL },
+    { "lHar;", 5, "\xe2\xa5\xa2" },
+    { "odblac;", 7, "\xc5\x91" },
+    { NULL },
+    { "blacktriangle;", 14, "\xe2\x96\xb4" },
+    { "hearts;", 7, "\xe2\x99\xa5" },
+    { "deg;", 4, "\xc2\xb0" },
+    { "Backslash;", 10, "\xe2\x88\x96" },
+    { "Qfr;", 4, "\xf0\x9d\x94\x94" },
+    { NULL },
+    { NULL },
+    { "COPY;", 5, "\xc2\xa9" },
+    { "numero;", 7, "\xe2\x84\x96" },
+    { "circ;", 5, "\xcb\x86" },
+    { "NotHumpDownHump;", 16, "\xe2\x89\x8e\xcc\xb8" },
+    { NULL },
+    { NULL },
+    { "Theta;", 6, "\xce\x98" },
+    { "nsubE;", 6, "\xe2\xab\x85\xcc\xb8" },
+    { NULL },
+    { NULL },
+    { "glj;", 4, "\xe2\xaa\xa4" },
+    { "TildeTilde;", 11, "\xe2\x89\x88" },
+    { NULL },
+    { "CloseCurlyDoubleQuote;", 22, "\xe2\x80\x9d" },
+    { "thorn;", 6, "\xc3\xbe" },
+    { NULL },
+    { "Jscr;", 5, "\xf0\x9d\x92\xa5" },
+    { "NotPrecedes;", 12, "\xe2\x8a\x80" },
+    { "Tcedil;", 7, "\xc5\xa2" },
+    { "Zcy;", 4, "\xd0\x97" },
+    { "rarrsim;", 8, "\xe2\xa5\xb4" },
+    { "zeta;", 5, "\xce\xb6" },
+    { "searhk;", 7, "\xe2\xa4\xa5" },
+    { NULL },
+    { NULL },
+    { "frasl;", 6, "\xe2\x81\x84" },
+    { "biguplus;", 9, "\xe2\xa8\x84" },
+    { "LeftDoubleBracket;", 18, "\xe2\x9f\xa6" },
+    { "Sacute;", 7, "\xc5\x9a" },
+    { "NotGreater;", 11, "\xe2\x89\xaf" },
+    { "MediumSpace;", 12, "\xe2\x81\x9f" },
+    { "Popf;", 5, "\xe2\x84\x99" },
+    { NULL },
+    { "LessGreater;", 12, "\xe2\x89\xb6" },
+    { NULL },
+    { "Nu;", 3, "\xce\x9d" },
+    { "quaternions;", 12, "\xe2\x84\x8d" },
+    { "backsimeq;", 10, "\xe2\x8b\x8d" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "jcirc;", 6, "\xc4\xb5" },
+    { "DownArrow;", 10, "\xe2\x86\x93" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "backsim;", 8, "\xe2\x88\xbd" },
+    { "otilde;", 7, "\xc3\xb5" },
+    { "raemptyv;", 9, "\xe2\xa6\xb3" },
+    { NULL },
+    { NULL },
+    { "ulcorner;", 9, "\xe2\x8c\x9c" },
+    { NULL },
+    { "wscr;", 5, "\xf0\x9d\x93\x8c" },
+    { NULL },
+    { "ocy;", 4, "\xd0\xbe" },
+    { NULL },
+    { "ogt;", 4, "\xe2\xa7\x81" },
+    { NULL },
+    { "lt", 2, "\x3c" },
+    { "llcorner;", 9, "\xe2\x8c\x9e" },
+    { "rsaquo;", 7, "\xe2\x80\xba" },
+    { NULL },
+    { NULL },
+    { "acute;", 6, "\xc2\xb4" },
+    { "iquest;", 7, "\xc2\xbf" },
+    { NULL },
+    { "uml;", 4, "\xc2\xa8" },
+    { NULL },
+    { "parsim;", 7, "\xe2\xab\xb3" },
+    { NULL },
+    { "emacr;", 6, "\xc4\x93" },
+    { NULL },
+    { "angmsdaf;", 9, "\xe2\xa6\xad" },
+    { "igrave;", 7, "\xc3\xac" },
+    { NULL },
+    { NULL },
+    { "LongLeftRightArrow;", 19, "\xe2\x9f\xb7" },
+    { "les;", 4, "\xe2\xa9\xbd" },
+    { "cylcty;", 7, "\xe2\x8c\xad" },
+    { "kcedil;", 7, "\xc4\xb7" },
+    { "twoheadrightarrow;", 18, "\xe2\x86\xa0" },
+    { NULL },
+    { "hardcy;", 7, "\xd1\x8a" },
+    { "Dcy;", 4, "\xd0\x94" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Because;", 8, "\xe2\x88\xb5" },
+    { "Vert;", 5, "\xe2\x80\x96" },
+    { "vert;", 5, "\x7c" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "lvnE;", 5, "\xe2\x89\xa8\xef\xb8\x80" },
+    { "copy", 4, "\xc2\xa9" },
+    { NULL },
+    { NULL },
+    { "rightharpoonup;", 15, "\xe2\x87\x80" },
+    { NULL },
+    { "nsupseteqq;", 11, "\xe2\xab\x86\xcc\xb8" },
+    { NULL },
+    { NULL },
+    { "gesdot;", 7, "\xe2\xaa\x80" },
+    { "roang;", 6, "\xe2\x9f\xad" },
+    { "acE;", 4, "\xe2\x88\xbe\xcc\xb3" },
+    { "succeq;", 7, "\xe2\xaa\xb0" },
+    { "bigotimes;", 10, "\xe2\xa8\x82" },
+    { "sdote;", 6, "\xe2\xa9\xa6" },
+    { "gdot;", 5, "\xc4\xa1" },
+    { "angmsdad;", 9, "\xe2\xa6\xab" },
+    { "agrave;", 7, "\xc3\xa0" },
+    { "eopf;", 5, "\xf0\x9d\x95\x96" },
+    { NULL },
+    { NULL },
+    { "expectation;", 12, "\xe2\x84\xb0" },
+    { NULL },
+    { "RuleDelayed;", 12, "\xe2\xa7\xb4" },
+    { NULL },
+    { "wfr;", 4, "\xf0\x9d\x94\xb4" },
+    { NULL },
+    { NULL },
+    { "xrarr;", 6, "\xe2\x9f\xb6" },
+    { "VerticalBar;", 12, "\xe2\x88\xa3" },
+    { "Dashv;", 6, "\xe2\xab\xa4" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "rationals;", 10, "\xe2\x84\x9a" },
+    { "toea;", 5, "\xe2\xa4\xa8" },
+    { "langle;", 7, "\xe2\x9f\xa8" },
+    { NULL },
+    { "nvsim;", 6, "\xe2\x88\xbc\xe2\x83\x92" },
+    { "racute;", 7, "\xc5\x95" },
+    { NULL },
+    { "Gdot;", 5, "\xc4\xa0" },
+    { "Aacute", 6, "\xc3\x81" },
+    { "eng;", 4, "\xc5\x8b" },
+    { "lharul;", 7, "\xe2\xa5\xaa" },
+    { NULL },
+    { "nrarrw;", 7, "\xe2\x86\x9d\xcc\xb8" },
+    { NULL },
+    { NULL },
+    { "dcaron;", 7, "\xc4\x8f" },
+    { NULL },
+    { "cuwed;", 6, "\xe2\x8b\x8f" },
+    { "ordf", 4, "\xc2\xaa" },
+    { "tau;", 4, "\xcf\x84" },
+    { "udblac;", 7, "\xc5\xb1" },
+    { NULL },
+    { "apE;", 4, "\xe2\xa9\xb0" },
+    { "mstpos;", 7, "\xe2\x88\xbe" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "PlusMinus;", 10, "\xc2\xb1" },
+    { "napprox;", 8, "\xe2\x89\x89" },
+    { NULL },
+    { NULL },
+    { "par;", 4, "\xe2\x88\xa5" },
+    { NULL },
+    { NULL },
+    { "boxVr;", 6, "\xe2\x95\x9f" },
+    { "frac13;", 7, "\xe2\x85\x93" },
+    { "ngeqslant;", 10, "\xe2\xa9\xbe\xcc\xb8" },
+    { "xcirc;", 6, "\xe2\x97\xaf" },
+    { NULL },
+    { "rHar;", 5, "\xe2\xa5\xa4" },
+    { "GJcy;", 5, "\xd0\x83" },
+    { NULL },
+    { "aogon;", 6, "\xc4\x85" },
+    { NULL },
+    { "siml;", 5, "\xe2\xaa\x9d" },
+    { "uarr;", 5, "\xe2\x86\x91" },
+    { "dd;", 3, "\xe2\x85\x86" },
+    { NULL },
+    { "oscr;", 5, "\xe2\x84\xb4" },
+    { NULL },
+    { "plusmn;", 7, "\xc2\xb1" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "smashp;", 7, "\xe2\xa8\xb3" },
+    { "Tilde;", 6, "\xe2\x88\xbc" },
+    { "DotEqual;", 9, "\xe2\x89\x90" },
+    { "asympeq;", 8, "\xe2\x89\x8d" },
+    { "bfr;", 4, "\xf0\x9d\x94\x9f" },
+    { "LeftRightArrow;", 15, "\xe2\x86\x94" },
+    { "Star;", 5, "\xe2\x8b\x86" },
+    { NULL },
+    { "barvee;", 7, "\xe2\x8a\xbd" },
+    { "rthree;", 7, "\xe2\x8b\x8c" },
+    { "Gcedil;", 7, "\xc4\xa2" },
+    { NULL },
+    { "amp", 3, "\x26" },
+    { NULL },
+    { "uring;", 6, "\xc5\xaf" },
+    { "ndash;", 6, "\xe2\x80\x93" },
+    { NULL },
+    { "xotime;", 7, "\xe2\xa8\x82" },
+    { "precneqq;", 9, "\xe2\xaa\xb5" },
+    { "lrtri;", 6, "\xe2\x8a\xbf" },
+    { "RightArrow;", 11, "\xe2\x86\x92" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "ETH;", 4, "\xc3\x90" },
+    { "fllig;", 6, "\xef\xac\x82" },
+    { "Ifr;", 4, "\xe2\x84\x91" },
+    { "gl;", 3, "\xe2\x89\xb7" },
+    { "supsetneqq;", 11, "\xe2\xab\x8c" },
+    { "ReverseUpEquilibrium;", 21, "\xe2\xa5\xaf" },
+    { "VeryThinSpace;", 14, "\xe2\x80\x8a" },
+    { "sung;", 5, "\xe2\x99\xaa" },
+    { "DoubleUpDownArrow;", 18, "\xe2\x87\x95" },
+    { "solb;", 5, "\xe2\xa7\x84" },
+    { "acd;", 4, "\xe2\x88\xbf" },
+    { "sbquo;", 6, "\xe2\x80\x9a" },
+    { NULL },
+    { "dash;", 5, "\xe2\x80\x90" },
+    { "equals;", 7, "\x3d" },
+    { NULL },
+    { "bigvee;", 7, "\xe2\x8b\x81" },
+    { NULL },
+    { NULL },
+    { "phmmat;", 7, "\xe2\x84\xb3" },
+    { "scE;", 4, "\xe2\xaa\xb4" },
+    { "iukcy;", 6, "\xd1\x96" },
+    { "cup;", 4, "\xe2\x88\xaa" },
+    { "Jopf;", 5, "\xf0\x9d\x95\x81" },
+    { "nrarrc;", 7, "\xe2\xa4\xb3\xcc\xb8" },
+    { NULL },
+    { "varsubsetneqq;", 14, "\xe2\xab\x8b\xef\xb8\x80" },
+    { "NotLeftTriangleBar;", 19, "\xe2\xa7\x8f\xcc\xb8" },
+    { NULL },
+    { "dopf;", 5, "\xf0\x9d\x95\x95" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "LJcy;", 5, "\xd0\x89" },
+    { "rbarr;", 6, "\xe2\xa4\x8d" },
+    { "CircleTimes;", 12, "\xe2\x8a\x97" },
+    { "rfr;", 4, "\xf0\x9d\x94\xaf" },
+    { NULL },
+    { "DoubleRightArrow;", 17, "\xe2\x87\x92" },
+    { NULL },
+    { "LeftCeiling;", 12, "\xe2\x8c\x88" },
+    { NULL },
+    { "andslope;", 9, "\xe2\xa9\x98" },
+    { NULL },
+    { NULL },
+    { "bullet;", 7, "\xe2\x80\xa2" },
+    { NULL },
+    { NULL },
+    { "lagran;", 7, "\xe2\x84\x92" },
+    { "ecaron;", 7, "\xc4\x9b" },
+    { "EmptyVerySmallSquare;", 21, "\xe2\x96\xab" },
+    { "bigsqcup;", 9, "\xe2\xa8\x86" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "iiint;", 6, "\xe2\x88\xad" },
+    { NULL },
+    { "nldr;", 5, "\xe2\x80\xa5" },
+    { "sigmaf;", 7, "\xcf\x82" },
+    { "Ccedil", 6, "\xc3\x87" },
+    { "Vscr;", 5, "\xf0\x9d\x92\xb1" },
+    { NULL },
+    { NULL },
+    { "simplus;", 8, "\xe2\xa8\xa4" },
+    { "suphsub;", 8, "\xe2\xab\x97" },
+    { "ddotseq;", 8, "\xe2\xa9\xb7" },
+    { "Pr;", 3, "\xe2\xaa\xbb" },
+    { "NewLine;", 8, "\x0a" },
+    { "preccurlyeq;", 12, "\xe2\x89\xbc" },
+    { "gcirc;", 6, "\xc4\x9d" },
+    { "dArr;", 5, "\xe2\x87\x93" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "frac35;", 7, "\xe2\x85\x97" },
+    { "lparlt;", 7, "\xe2\xa6\x93" },
+    { "capand;", 7, "\xe2\xa9\x84" },
+    { "xodot;", 6, "\xe2\xa8\x80" },
+    { NULL },
+    { NULL },
+    { "dharl;", 6, "\xe2\x87\x83" },
+    { "fork;", 5, "\xe2\x8b\x94" },
+    { "Kcy;", 4, "\xd0\x9a" },
+    { "awint;", 6, "\xe2\xa8\x91" },
+    { "rtri;", 5, "\xe2\x96\xb9" },
+    { "auml", 4, "\xc3\xa4" },
+    { "varsubsetneq;", 13, "\xe2\x8a\x8a\xef\xb8\x80" },
+    { "DownArrowUpArrow;", 17, "\xe2\x87\xb5" },
+    { "prcue;", 6, "\xe2\x89\xbc" },
+    { "olcir;", 6, "\xe2\xa6\xbe" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "intcal;", 7, "\xe2\x8a\xba" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "nLtv;", 5, "\xe2\x89\xaa\xcc\xb8" },
+    { "cacute;", 7, "\xc4\x87" },
+    { "Aacute;", 7, "\xc3\x81" },
+    { NULL },
+    { "iacute;", 7, "\xc3\xad" },
+    { "TildeEqual;", 11, "\xe2\x89\x83" },
+    { "simlE;", 6, "\xe2\xaa\x9f" },
+    { NULL },
+    { NULL },
+    { "odot;", 5, "\xe2\x8a\x99" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "YUcy;", 5, "\xd0\xae" },
+    { "els;", 4, "\xe2\xaa\x95" },
+    { "nwarhk;", 7, "\xe2\xa4\xa3" },
+    { NULL },
+    { "angsph;", 7, "\xe2\x88\xa2" },
+    { NULL },
+    { "ll;", 3, "\xe2\x89\xaa" },
+    { "iquest", 6, "\xc2\xbf" },
+    { "Gopf;", 5, "\xf0\x9d\x94\xbe" },
+    { NULL },
+    { "boxvh;", 6, "\xe2\x94\xbc" },
+    { "submult;", 8, "\xe2\xab\x81" },
+    { "notindot;", 9, "\xe2\x8b\xb5\xcc\xb8" },
+    { NULL },
+    { "pertenk;", 8, "\xe2\x80\xb1" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "ecolon;", 7, "\xe2\x89\x95" },
+    { NULL },
+    { NULL },
+    { "int;", 4, "\xe2\x88\xab" },
+    { "piv;", 4, "\xcf\x96" },
+    { "lrcorner;", 9, "\xe2\x8c\x9f" },
+    { "Uarr;", 5, "\xe2\x86\x9f" },
+    { NULL },
+    { "nexists;", 8, "\xe2\x88\x84" },
+    { NULL },
+    { "Element;", 8, "\xe2\x88\x88" },
+    { "fcy;", 4, "\xd1\x84" },
+    { NULL },
+    { NULL },
+    { "swnwar;", 7, "\xe2\xa4\xaa" },
+    { "quest;", 6, "\x3f" },
+    { "downharpoonright;", 17, "\xe2\x87\x82" },
+    { NULL },
+    { "it;", 3, "\xe2\x81\xa2" },
+    { NULL },
+    { "cross;", 6, "\xe2\x9c\x97" },
+    { "nshortparallel;", 15, "\xe2\x88\xa6" },
+    { NULL },
+    { "upsi;", 5, "\xcf\x85" },
+    { "emsp14;", 7, "\xe2\x80\x85" },
+    { NULL },
+    { NULL },
+    { "Proportional;", 13, "\xe2\x88\x9d" },
+    { NULL },
+    { "Acy;", 4, "\xd0\x90" },
+    { "sigmav;", 7, "\xcf\x82" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "LeftArrow;", 10, "\xe2\x86\x90" },
+    { "Mcy;", 4, "\xd0\x9c" },
+    { "nesear;", 7, "\xe2\xa4\xa8" },
+    { "precsim;", 8, "\xe2\x89\xbe" },
+    { "ngeqq;", 6, "\xe2\x89\xa7\xcc\xb8" },
+    { "ClockwiseContourIntegral;", 25, "\xe2\x88\xb2" },
+    { "rdsh;", 5, "\xe2\x86\xb3" },
+    { NULL },
+    { NULL },
+    { "vangrt;", 7, "\xe2\xa6\x9c" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "yopf;", 5, "\xf0\x9d\x95\xaa" },
+    { "SquareSubset;", 13, "\xe2\x8a\x8f" },
+    { "napos;", 6, "\xc5\x89" },
+    { NULL },
+    { NULL },
+    { "orslope;", 8, "\xe2\xa9\x97" },
+    { NULL },
+    { "Agrave", 6, "\xc3\x80" },
+    { "Vdashl;", 7, "\xe2\xab\xa6" },
+    { "NotSucceedsSlantEqual;", 22, "\xe2\x8b\xa1" },
+    { NULL },
+    { NULL },
+    { "nge;", 4, "\xe2\x89\xb1" },
+    { "spades;", 7, "\xe2\x99\xa0" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "race;", 5, "\xe2\x88\xbd\xcc\xb1" },
+    { NULL },
+    { NULL },
+    { "oslash", 6, "\xc3\xb8" },
+    { NULL },
+    { NULL },
+    { "NotGreaterEqual;", 16, "\xe2\x89\xb1" },
+    { "Sigma;", 6, "\xce\xa3" },
+    { "Lleftarrow;", 11, "\xe2\x87\x9a" },
+    { "djcy;", 5, "\xd1\x92" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "CloseCurlyQuote;", 16, "\xe2\x80\x99" },
+    { NULL },
+    { NULL },
+    { "bumpeq;", 7, "\xe2\x89\x8f" },
+    { NULL },
+    { "intercal;", 9, "\xe2\x8a\xba" },
+    { "zfr;", 4, "\xf0\x9d\x94\xb7" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "tcedil;", 7, "\xc5\xa3" },
+    { NULL },
+    { "natur;", 6, "\xe2\x99\xae" },
+    { NULL },
+    { "upsilon;", 8, "\xcf\x85" },
+    { "loz;", 4, "\xe2\x97\x8a" },
+    { "order;", 6, "\xe2\x84\xb4" },
+    { "boxhu;", 6, "\xe2\x94\xb4" },
+    { "nvinfin;", 8, "\xe2\xa7\x9e" },
+    { NULL },
+    { NULL },
+    { "Laplacetrf;", 11, "\xe2\x84\x92" },
+    { "pm;", 3, "\xc2\xb1" },
+    { "lopar;", 6, "\xe2\xa6\x85" },
+    { NULL },
+    { "dtrif;", 6, "\xe2\x96\xbe" },
+    { "atilde;", 7, "\xc3\xa3" },
+    { NULL },
+    { NULL },
+    { "eogon;", 6, "\xc4\x99" },
+    { "Lsh;", 4, "\xe2\x86\xb0" },
+    { "lrhard;", 7, "\xe2\xa5\xad" },
+    { "YIcy;", 5, "\xd0\x87" },
+    { NULL },
+    { "Copf;", 5, "\xe2\x84\x82" },
+    { "prod;", 5, "\xe2\x88\x8f" },
+    { "Uuml;", 5, "\xc3\x9c" },
+    { "nsc;", 4, "\xe2\x8a\x81" },
+    { "lfisht;", 7, "\xe2\xa5\xbc" },
+    { "Ocy;", 4, "\xd0\x9e" },
+    { "Sup;", 4, "\xe2\x8b\x91" },
+    { NULL },
+    { "num;", 4, "\x23" },
+    { "boxhU;", 6, "\xe2\x95\xa8" },
+    { NULL },
+    { "NotSquareSubsetEqual;", 21, "\xe2\x8b\xa2" },
+    { NULL },
+    { NULL },
+    { "Darr;", 5, "\xe2\x86\xa1" },
+    { "part;", 5, "\xe2\x88\x82" },
+    { "Escr;", 5, "\xe2\x84\xb0" },
+    { NULL },
+    { "laemptyv;", 9, "\xe2\xa6\xb4" },
+    { NULL },
+    { NULL },
+    { "Ncy;", 4, "\xd0\x9d" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "AElig;", 6, "\xc3\x86" },
+    { "tdot;", 5, "\xe2\x83\x9b" },
+    { "cedil", 5, "\xc2\xb8" },
+    { "comma;", 6, "\x2c" },
+    { NULL },
+    { "wopf;", 5, "\xf0\x9d\x95\xa8" },
+    { "rightsquigarrow;", 16, "\xe2\x86\x9d" },
+    { "nlt;", 4, "\xe2\x89\xae" },
+    { "supnE;", 6, "\xe2\xab\x8c" },
+    { NULL },
+    { "nbump;", 6, "\xe2\x89\x8e\xcc\xb8" },
+    { NULL },
+    { "divideontimes;", 14, "\xe2\x8b\x87" },
+    { NULL },
+    { "Alpha;", 6, "\xce\x91" },
+    { NULL },
+    { "harrcir;", 8, "\xe2\xa5\x88" },
+    { "bigcirc;", 8, "\xe2\x97\xaf" },
+    { "TildeFullEqual;", 15, "\xe2\x89\x85" },
+    { "sqcups;", 7, "\xe2\x8a\x94\xef\xb8\x80" },
+    { "seswar;", 7, "\xe2\xa4\xa9" },
+    { "nvgt;", 5, "\x3e\xe2\x83\x92" },
+    { "micro", 5, "\xc2\xb5" },
+    { "gsiml;", 6, "\xe2\xaa\x90" },
+    { NULL },
+    { "ascr;", 5, "\xf0\x9d\x92\xb6" },
+    { "boxhd;", 6, "\xe2\x94\xac" },
+    { "vzigzag;", 8, "\xe2\xa6\x9a" },
+    { "subdot;", 7, "\xe2\xaa\xbd" },
+    { "equiv;", 6, "\xe2\x89\xa1" },
+    { "xdtri;", 6, "\xe2\x96\xbd" },
+    { "late;", 5, "\xe2\xaa\xad" },
+    { "NotLessSlantEqual;", 18, "\xe2\xa9\xbd\xcc\xb8" },
+    { "hamilt;", 7, "\xe2\x84\x8b" },
+    { "origof;", 7, "\xe2\x8a\xb6" },
+    { "Sub;", 4, "\xe2\x8b\x90" },
+    { "eg;", 3, "\xe2\xaa\x9a" },
+    { NULL },
+    { NULL },
+    { "le;", 3, "\xe2\x89\xa4" },
+    { NULL },
+    { NULL },
+    { "Scy;", 4, "\xd0\xa1" },
+    { NULL },
+    { "aelig;", 6, "\xc3\xa6" },
+    { "pound;", 6, "\xc2\xa3" },
+    { NULL },
+    { "rlhar;", 6, "\xe2\x87\x8c" },
+    { NULL },
+    { "ap;", 3, "\xe2\x89\x88" },
+    { "roarr;", 6, "\xe2\x87\xbe" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "bigcap;", 7, "\xe2\x8b\x82" },
+    { "Xopf;", 5, "\xf0\x9d\x95\x8f" },
+    { NULL },
+    { NULL },
+    { "Utilde;", 7, "\xc5\xa8" },
+    { NULL },
+    { "DownLeftVectorBar;", 18, "\xe2\xa5\x96" },
+    { NULL },
+    { "nrarr;", 6, "\xe2\x86\x9b" },
+    { "Ycy;", 4, "\xd0\xab" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "dwangle;", 8, "\xe2\xa6\xa6" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "GreaterLess;", 12, "\xe2\x89\xb7" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "frac38;", 7, "\xe2\x85\x9c" },
+    { NULL },
+    { "ltimes;", 7, "\xe2\x8b\x89" },
+    { NULL },
+    { NULL },
+    { "supedot;", 8, "\xe2\xab\x84" },
+    { NULL },
+    { "gesles;", 7, "\xe2\xaa\x94" },
+    { "Cdot;", 5, "\xc4\x8a" },
+    { NULL },
+    { NULL },
+    { "FilledSmallSquare;", 18, "\xe2\x97\xbc" },
+    { NULL },
+    { "Ugrave", 6, "\xc3\x99" },
+    { NULL },
+    { "yuml", 4, "\xc3\xbf" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "supseteq;", 9, "\xe2\x8a\x87" },
+    { "csupe;", 6, "\xe2\xab\x92" },
+    { "mlcp;", 5, "\xe2\xab\x9b" },
+    { "triangleq;", 10, "\xe2\x89\x9c" },
+    { "Zscr;", 5, "\xf0\x9d\x92\xb5" },
+    { NULL },
+    { NULL },
+    { "ycirc;", 6, "\xc5\xb7" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "LowerLeftArrow;", 15, "\xe2\x86\x99" },
+    { "Jfr;", 4, "\xf0\x9d\x94\x8d" },
+    { "yscr;", 5, "\xf0\x9d\x93\x8e" },
+    { "mid;", 4, "\xe2\x88\xa3" },
+    { "boxvr;", 6, "\xe2\x94\x9c" },
+    { NULL },
+    { "varrho;", 7, "\xcf\xb1" },
+    { "NegativeThickSpace;", 19, "\xe2\x80\x8b" },
+    { "gtrapprox;", 10, "\xe2\xaa\x86" },
+    { "iota;", 5, "\xce\xb9" },
+    { NULL },
+    { "csub;", 5, "\xe2\xab\x8f" },
+    { "smte;", 5, "\xe2\xaa\xac" },
+    { "npreceq;", 8, "\xe2\xaa\xaf\xcc\xb8" },
+    { "shortparallel;", 14, "\xe2\x88\xa5" },
+    { NULL },
+    { NULL },
+    { "tbrk;", 5, "\xe2\x8e\xb4" },
+    { "precnsim;", 9, "\xe2\x8b\xa8" },
+    { "Euml", 4, "\xc3\x8b" },
+    { NULL },
+    { NULL },
+    { "boxvH;", 6, "\xe2\x95\xaa" },
+    { "nvdash;", 7, "\xe2\x8a\xac" },
+    { "rtimes;", 7, "\xe2\x8b\x8a" },
+    { NULL },
+    { "simdot;", 7, "\xe2\xa9\xaa" },
+    { NULL },
+    { "Im;", 3, "\xe2\x84\x91" },
+    { "NotHumpEqual;", 13, "\xe2\x89\x8f\xcc\xb8" },
+    { "sqsupe;", 7, "\xe2\x8a\x92" },
+    { NULL },
+    { "backepsilon;", 12, "\xcf\xb6" },
+    { NULL },
+    { "lharu;", 6, "\xe2\x86\xbc" },
+    { "Leftarrow;", 10, "\xe2\x87\x90" },
+    { "NotEqual;", 9, "\xe2\x89\xa0" },
+    { NULL },
+    { NULL },
+    { "smeparsl;", 9, "\xe2\xa7\xa4" },
+    { "Ograve;", 7, "\xc3\x92" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "nsqsupe;", 8, "\xe2\x8b\xa3" },
+    { "sdotb;", 6, "\xe2\x8a\xa1" },
+    { "capbrcup;", 9, "\xe2\xa9\x89" },
+    { "ohbar;", 6, "\xe2\xa6\xb5" },
+    { NULL },
+    { NULL },
+    { "uharr;", 6, "\xe2\x86\xbe" },
+    { "cudarrr;", 8, "\xe2\xa4\xb5" },
+    { "QUOT;", 5, "\x22" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Omacr;", 6, "\xc5\x8c" },
+    { "urcorn;", 7, "\xe2\x8c\x9d" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "Lang;", 5, "\xe2\x9f\xaa" },
+    { "NotTildeFullEqual;", 18, "\xe2\x89\x87" },
+    { "drbkarow;", 9, "\xe2\xa4\x90" },
+    { NULL },
+    { NULL },
+    { "ntilde;", 7, "\xc3\xb1" },
+    { "Re;", 3, "\xe2\x84\x9c" },
+    { NULL },
+    { "harr;", 5, "\xe2\x86\x94" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "RightVector;", 12, "\xe2\x87\x80" },
+    { NULL },
+    { NULL },
+    { "boxHD;", 6, "\xe2\x95\xa6" },
+    { "hairsp;", 7, "\xe2\x80\x8a" },
+    { "amacr;", 6, "\xc4\x81" },
+    { NULL },
+    { NULL },
+    { "drcrop;", 7, "\xe2\x8c\x8c" },
+    { "NotLeftTriangleEqual;", 21, "\xe2\x8b\xac" },
+    { "RightUpVectorBar;", 17, "\xe2\xa5\x94" },
+    { "longleftrightarrow;", 19, "\xe2\x9f\xb7" },
+    { NULL },
+    { "npolint;", 8, "\xe2\xa8\x94" },
+    { "realpart;", 9, "\xe2\x84\x9c" },
+    { "Tfr;", 4, "\xf0\x9d\x94\x97" },
+    { "Zfr;", 4, "\xe2\x84\xa8" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "andv;", 5, "\xe2\xa9\x9a" },
+    { NULL },
+    { "nis;", 4, "\xe2\x8b\xbc" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "boxVR;", 6, "\xe2\x95\xa0" },
+    { "gEl;", 4, "\xe2\xaa\x8c" },
+    { "parallel;", 9, "\xe2\x88\xa5" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "ltrPar;", 7, "\xe2\xa6\x96" },
+    { "boxDR;", 6, "\xe2\x95\x94" },
+    { "bowtie;", 7, "\xe2\x8b\x88" },
+    { "looparrowleft;", 14, "\xe2\x86\xab" },
+    { "nsubseteqq;", 11, "\xe2\xab\x85\xcc\xb8" },
+    { "frac16;", 7, "\xe2\x85\x99" },
+    { "uscr;", 5, "\xf0\x9d\x93\x8a" },
+    { "sqcap;", 6, "\xe2\x8a\x93" },
+    { "barwedge;", 9, "\xe2\x8c\x85" },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "boxuR;", 6, "\xe2\x95\x98" },
+    { NULL },
+    { "eparsl;", 7, "\xe2\xa7\xa3" },
+    { NULL },
+    { "PrecedesTilde;", 14, "\xe2\x89\xbe" },
+    { NULL },
+    { NULL },
+    { "ohm;", 4, "\xce\xa9" },
+    { "dtri;", 5, "\xe2\x96\xbf" },
+};
+
+static inline uint32_t html_entity_hash(const char *s, size_t len, uint32_t seed)
+{
+    uint32_t h = 0x811c9dc5u ^ seed;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t b = s[i];
+        h ^= b;
+        h *= 0x01000193u;
+    }
+    return h ^ (h >> 16);
+}
+
+/* Returns the entry of the len bytes at s, or NULL if it is not a key */
+static inline const struct html_entity_entry *html_entity_lookup(const char *s, size_t len)
+{
+    uint32_t seed = html_entity_seeds[html_entity_hash(s, len, 0) % 558];
+    const struct html_entity_entry *e = &html_entity_table[html_entity_hash(s, len, seed) % 4096];
+    if (e->key == NULL || e->key_len != len || memcmp(e->key, s, len) != 0)
+        return NULL;
+    return e;
+}
+
+#endif /* _VTT2ASS_HTML_ENTITY_TABLE_H */
@@ -0,0 +1,32 @@
+#include "keywords.h"
+
+#include "cuetext.h"
+#include "vtt_keyword_table.h"
+#include "css_keyword_table.h"
+
+enum vtt_keyword kw_lookup(const char *s, size_t len)
+{
+    const struct vtt_keyword_entry *e = vtt_keyword_lookup(s, len);
+    return e ? e->val : KW_UNKNOWN;
+}
+
+enum css_keyword kw_css_lookup(const char *s, size_t len)
+{
+    const struct css_keyword_entry *e = css_keyword_lookup(s, len);
+    return e ? e->val : CKW_UNKNOWN;
+}
+
+int kw_tag_type(enum vtt_keyword kw)
+{
+    switch (kw) {
+    case KW_TAG_C: return VNODE_CLASS;
+    case KW_TAG_I: return VNODE_ITALIC;
+    case KW_TAG_B: return VNODE_BOLD;
+    case KW_TAG_U: return VNODE_UNDERLINE;
+    case KW_TAG_RUBY: return VNODE_RUBY;
+    case KW_TAG_RT: return VNODE_RUBY_TEXT;
+    case KW_TAG_V: return VNODE_VOICE;
+    case KW_TAG_LANG: return VNODE_LANGUAGE;
+    default: return -1;
+    }
+}
@@ -0,0 +1,88 @@
+#ifndef _VTT2ASS_KEYWORDS_H
+#define _VTT2ASS_KEYWORDS_H
+#include <stddef.h>
+
+/* The keywords are looked up in perfect hash tables that are generated
+ * from these lists by tools/gen_phash.py, run make gen after changing them */
+
+/* Cue setting names and values, and cue text tag names. Case sensitive */
+#define VTT_KEYWORD_DEF(ex) \
+    ex(KW_VERTICAL, "vertical") \
+    ex(KW_LINE, "line") \
+    ex(KW_POSITION, "position") \
+    ex(KW_SIZE, "size") \
+    ex(KW_ALIGN, "align") \
+\
+    ex(KW_RL, "rl") \
+    ex(KW_LR, "lr") \
+    ex(KW_START, "start") \
+    ex(KW_CENTER, "center") \
+    ex(KW_MIDDLE, "middle") \
+    ex(KW_END, "end") \
+    ex(KW_LEFT, "left") \
+    ex(KW_RIGHT, "right") \
+    ex(KW_LINE_LEFT, "line-left") \
+    ex(KW_LINE_RIGHT, "line-right") \
+\
+    ex(KW_TAG_C, "c") \
+    ex(KW_TAG_I, "i") \
+    ex(KW_TAG_B, "b") \
+    ex(KW_TAG_U, "u") \
+    ex(KW_TAG_RUBY, "ruby") \
+    ex(KW_TAG_RT, "rt") \
+    ex(KW_TAG_V, "v") \
+    ex(KW_TAG_LANG, "lang") \
+
+/* Property names and value identifiers of STYLE blocks. ASCII case insensitive */
+#define CSS_KEYWORD_DEF(ex) \
+    ex(CKW_RUBY_POSITION, "ruby-position") \
+    ex(CKW_X_TTML_SHEAR, "x-ttml-shear") \
+    ex(CKW_TEXT_SHADOW, "text-shadow") \
+    ex(CKW_COLOR, "color") \
+    ex(CKW_BACKGROUND_COLOR, "background-color") \
+    ex(CKW_BACKGROUND, "background") \
+    ex(CKW_OPACITY, "opacity") \
+    ex(CKW_FONT_WEIGHT, "font-weight") \
+    ex(CKW_FONT_STYLE, "font-style") \
+    ex(CKW_TEXT_DECORATION, "text-decoration") \
+    ex(CKW_TEXT_DECORATION_LINE, "text-decoration-line") \
+\
+    ex(CKW_NONE, "none") \
+    ex(CKW_NORMAL, "normal") \
+    ex(CKW_BOLD, "bold") \
+    ex(CKW_BOLDER, "bolder") \
+    ex(CKW_LIGHTER, "lighter") \
+    ex(CKW_ITALIC, "italic") \
+    ex(CKW_OBLIQUE, "oblique") \
+    ex(CKW_UNDERLINE, "underline") \
+    ex(CKW_LINE_THROUGH, "line-through") \
+    ex(CKW_OVER, "over") \
+    ex(CKW_UNDER, "under") \
+    ex(CKW_ALTERNATE, "alternate") \
+    ex(CKW_RGB, "rgb") \
+    ex(CKW_RGBA, "rgba") \
+\
+    ex(CKW_PX, "px") \
+    ex(CKW_EM, "em") \
+    ex(CKW_VW, "vw") \
+    ex(CKW_VH, "vh") \
+    ex(CKW_DEG, "deg") \
+
+#define ex(n, str) n,
+enum vtt_keyword {
+    KW_UNKNOWN = 0,
+    VTT_KEYWORD_DEF(ex)
+};
+enum css_keyword {
+    CKW_UNKNOWN = 0,
+    CSS_KEYWORD_DEF(ex)
+};
+#undef ex
+
+/* Return *_UNKNOWN if the len bytes at s are not a keyword */
+enum vtt_keyword kw_lookup(const char *s, size_t len);
+enum css_keyword kw_css_lookup(const char *s, size_t len);
+/* Returns the enum vtt_node_type of a tag keyword, or -1 */
+int kw_tag_type(enum vtt_keyword kw);
+
+#endif /* _VTT2ASS_KEYWORDS_H */
@@ -10,7 +10,12 @@
 #include "ass.h"
 #include "util.h"
 #include "font.h"
+#include "textextents.h"
 #include "opts.h"
+#include "pipeline.h"
+#include "atom.h"
+#include "glyphcache.h"
+#include "ass_cache.h"
 
 
 #include <locale.h>
@@ -26,8 +31,15 @@ int main(int argc, const char **argv)
     if (en == -1)
         return 1;
 
+    if (opts_glyphs)
+        return gcache_tool(opts_infile, opts_glyphs_prune) == 0 ? 0 : 1;
+    if (opts_cues)
+        return ass_cache_tool(opts_infile, opts_cues_prune) == 0 ? 0 : 1;
+
     util_init();
     font_init();
+    atom_init();
+    gcache_init(opts_ass_glyph_cache_dir);
 
     // TODO: cont. with vertical rendering fixes and vertical ruby
 
@@ -35,36 +47,49 @@ int main(int argc, const char **argv)
     if (en != 0)
         return 1;
 
-    struct dyna *tokens = tok_tokenize();
+    if (opts_pipeline) {
+        en = pipe_run();
+        if (en == 0)
+            printf("Conversion done\n");
+        rdr_free();
+        te_thread_dinit();
+        gcache_dinit();
+        font_dinit();
+        atom_dinit();
+        return en == 0 ? 0 : 2;
+    }
+
+    struct token_vec *tokens = tok_tokenize();
     if (tokens == NULL) {
         printf("Failed to tokenize\n");
         return 2;
     }
 
-    struct dyna *cues = NULL, *styles = NULL;
+    struct cue_vec *cues = NULL;
+    struct cue_styles *styles = NULL;
     en = prs_parse_tokens(tokens, &cues, &styles);
     if (en != 0)
         goto end;
 
     /* For debug */
 #if 0
-    printf("Token array size: %ld\n", tokens->e_idx);
+    printf("Token array size: %ld\n", tokens->count);
     char tokstr[1024];
-    for (int i = 0; i < MIN(1000000, tokens->e_idx); i++) {
-        tok_2str((struct token*)dyna_elem(tokens, i), 512, tokstr);
+    for (int i = 0; i < MIN(1000000, tokens->count); i++) {
+        tok_2str(&tokens->data[i], 512, tokstr);
         printf("Token %d: %s\n", i, tokstr);
     }
 
-    for (int i = 0; i < cues->e_idx; i++) {
-        struct cue *c = dyna_elem(cues, i);
+    for (int i = 0; i < cues->count; i++) {
+        struct cue *c = &cues->data[i];
         prs_cue2str(sizeof(tokstr), tokstr, c);
         printf("%s\n\n", tokstr);
 
         //struct dyna *ctxt_tokens = ctxt_parse(c->text);
     }
 
-    for (int i = 0; styles && i < styles->e_idx; i++) {
-        struct cue_style *cs = dyna_elem(styles, i);
+    for (int i = 0; styles && i < styles->rules->e_idx; i++) {
+        struct cue_style *cs = dyna_elem(styles->rules, i);
         cuestyle_print(sizeof(tokstr), tokstr, cs);
         printf("%s\n", tokstr);
     }
@@ -76,20 +101,30 @@ int main(int argc, const char **argv)
             .height = opts_ass_vid_h,
         };
         //ass_write(cues, styles, &vinf, "ipaexg.ttf", opts_ass_outfile);
-        ass_write(cues, styles, &vinf, opts_ass_fontfile, opts_ass_outfile);
+        if (ass_write(cues, styles, &vinf, opts_ass_fontfile, opts_ass_outfile) != 0) {
+            printf("Failed to write the ass output\n");
+            en = -1;
+        }
     }
     if (opts_srt) {
-        srt_write(cues, styles, opts_srt_outfile);
+        if (srt_write(cues, styles, opts_srt_outfile) != 0) {
+            printf("Failed to write the srt output\n");
+            en = -1;
+        }
     }
-    printf("Conversion done\n");
+    if (en == 0)
+        printf("Conversion done\n");
 
 end:
     if (cues)
-        dyna_destroy(cues);
+        prs_destroy_cues(cues);
     if (styles)
-        dyna_destroy(styles);
-    dyna_destroy(tokens);
+        cuestyle_destroy(styles);
+    tok_destroy_tokens(tokens);
     rdr_free();
+    te_thread_dinit();
+    gcache_dinit();
     font_dinit();
-    return 0;
+    atom_dinit();
+    return en == 0 ? 0 : 2;
 }
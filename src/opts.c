@@ -5,13 +5,23 @@
 #include <string.h>
 
 static const char *const usage[] = {
-    "v2a ass [-h] srt [-h] input_file",
+    "v2a [-P] [-T] ass [-h] srt [-h] input_file",
+    "v2a glyphs [-h] cache_file",
+    "v2a cues [-h] cache_file",
     NULL,
 };
 static const char *const ass_usage[] = {
     "v2a ass [ass options] input_file...",
     NULL,
 };
+static const char *const glyphs_usage[] = {
+    "v2a glyphs [glyphs options] cache_file",
+    NULL,
+};
+static const char *const cues_usage[] = {
+    "v2a cues [cues options] cache_file",
+    NULL,
+};
 static const char *const srt_usage[] = {
     "v2a srt [srt options] input_file...",
     NULL,
@@ -22,15 +32,25 @@ bool opts_ass = false;
 const char *opts_ass_outfile = NULL;
 const char *opts_srt_outfile = NULL;
 const char *opts_infile = NULL;
+bool opts_pipeline = false;
+bool opts_drop_text = false;
 int opts_ass_vid_w = 0, opts_ass_vid_h = 0;
 const char *opts_ass_fontfile = NULL;
 bool opts_ass_debug_boxes = false;
 int opts_ass_border_size = -1;
+int opts_ass_jobs = 1;
+int opts_ass_max_mem = 0;
+const char *opts_ass_cache_file = NULL;
+const char *opts_ass_glyph_cache_dir = NULL;
+bool opts_glyphs = false;
+int opts_glyphs_prune = 0;
+bool opts_cues = false;
+int opts_cues_prune = 0;
 
 static int cmd_ass(int *argc, const char **argv)
 {
-    char *outpath = NULL, *fontfile = NULL;
-    int width = 0, height = 0, border = -1;
+    char *outpath = NULL, *fontfile = NULL, *cachefile = NULL, *glyphdir = NULL;
+    int width = 0, height = 0, border = -1, jobs = 1, max_mem = 0;
     bool debug = false;
 
     struct argparse argp;
@@ -42,6 +62,10 @@ static int cmd_ass(int *argc, const char **argv)
         OPT_STRING('f', "font", &fontfile, "The fontfile to use. This font should be embedded in the .mkv", NULL, 0, 0),
         OPT_INTEGER('B', "border", &border, "Set the border size to use", NULL, 0, 0),
         OPT_BOOLEAN('D', "debug", &debug, "If set, debug boxes will be included in the output", NULL, 0, 0),
+        OPT_INTEGER('j', "jobs", &jobs, "Number of threads to do the layout with, 0 to use every cpu (def 1)", NULL, 0, 0),
+        OPT_INTEGER('M', "max-mem", &max_mem, "Approximate memory limit in MiB for the events of unordered cues, over it they are sorted on disk (def 0, no limit)", NULL, 0, 0),
+        OPT_STRING('C', "cache", &cachefile, "Cache file of the converted cues, a rerun only lays out the cues that are not in it", NULL, 0, 0),
+        OPT_STRING('G', "glyph-cache", &glyphdir, "Directory of the shaping results of each font, shared between runs", NULL, 0, 0),
         OPT_END(),
     };
     argparse_init(&argp, opts, ass_usage, ARGPARSE_STOP_AT_NON_OPTION);
@@ -62,6 +86,16 @@ static int cmd_ass(int *argc, const char **argv)
         argparse_usage(&argp);
         return -1;
     }
+    if (jobs < 0) {
+        printf("The number of jobs cannot be negative\n");
+        argparse_usage(&argp);
+        return -1;
+    }
+    if (max_mem < 0) {
+        printf("The memory limit cannot be negative\n");
+        argparse_usage(&argp);
+        return -1;
+    }
 
     opts_ass = true;
     opts_ass_outfile = outpath;
@@ -70,6 +104,56 @@ static int cmd_ass(int *argc, const char **argv)
     opts_ass_fontfile = fontfile;
     opts_ass_debug_boxes = debug;
     opts_ass_border_size = border;
+    opts_ass_jobs = jobs;
+    opts_ass_max_mem = max_mem;
+    opts_ass_cache_file = cachefile;
+    opts_ass_glyph_cache_dir = glyphdir;
+    return 0;
+}
+
+static int cmd_glyphs(int *argc, const char **argv)
+{
+    int prune = 0;
+
+    struct argparse argp;
+    struct argparse_option opts[] = {
+        OPT_HELP(),
+        OPT_INTEGER('p', "prune", &prune, "Drop the duplicate records, and the oldest ones that do not fit in this many MiB", NULL, 0, 0),
+        OPT_END(),
+    };
+    argparse_init(&argp, opts, glyphs_usage, ARGPARSE_STOP_AT_NON_OPTION);
+    *argc = argparse_parse(&argp, *argc, argv);
+
+    if (prune < 0) {
+        printf("The prune size cannot be negative\n");
+        argparse_usage(&argp);
+        return -1;
+    }
+    opts_glyphs = true;
+    opts_glyphs_prune = prune;
+    return 0;
+}
+
+static int cmd_cues(int *argc, const char **argv)
+{
+    int prune = 0;
+
+    struct argparse argp;
+    struct argparse_option opts[] = {
+        OPT_HELP(),
+        OPT_INTEGER('p', "prune", &prune, "Drop the records that were used the longest time ago, until the file fits in this many MiB", NULL, 0, 0),
+        OPT_END(),
+    };
+    argparse_init(&argp, opts, cues_usage, ARGPARSE_STOP_AT_NON_OPTION);
+    *argc = argparse_parse(&argp, *argc, argv);
+
+    if (prune < 0) {
+        printf("The prune size cannot be negative\n");
+        argparse_usage(&argp);
+        return -1;
+    }
+    opts_cues = true;
+    opts_cues_prune = prune;
     return 0;
 }
 
@@ -99,8 +183,11 @@ static int cmd_srt(int *argc, const char **argv)
 int opts_parse(int argc, const char **argv)
 {
     struct argparse argp;
+    bool pipeline = false, drop_text = false;
     struct argparse_option opts[] = {
         OPT_HELP(),
+        OPT_BOOLEAN('P', "pipeline", &pipeline, "Run reading, parsing, layout and writing on separate threads", NULL, 0, 0),
+        OPT_BOOLEAN('T', "drop-text", &drop_text, "Free the parsed text of a cue after each output wrote it, and parse it again for the next one. Uses less memory on big files", NULL, 0, 0),
         OPT_END(),
     };
     int r = argparse_init(&argp, opts, usage, ARGPARSE_STOP_AT_NON_OPTION);
@@ -119,6 +206,10 @@ int opts_parse(int argc, const char **argv)
             r = cmd_ass(&argc, argv);
         } else if (strcmp(subcname, "srt") == 0) {
             r = cmd_srt(&argc, argv);
+        } else if (strcmp(subcname, "glyphs") == 0) {
+            r = cmd_glyphs(&argc, argv);
+        } else if (strcmp(subcname, "cues") == 0) {
+            r = cmd_cues(&argc, argv);
         } else {
             if (argc < 1)
                 break;
@@ -141,11 +232,21 @@ int opts_parse(int argc, const char **argv)
         return -1;
     }
 
-    if (!opts_ass && !opts_srt) {
+    if (opts_glyphs && (opts_ass || opts_srt)) {
+        printf("The glyph cache tool cannot be used with a conversion\n");
+        return -1;
+    }
+    if (opts_cues && (opts_ass || opts_srt || opts_glyphs)) {
+        printf("The cue cache tool cannot be used with a conversion\n");
+        return -1;
+    }
+    if (!opts_ass && !opts_srt && !opts_glyphs && !opts_cues) {
         printf("At least ass or srt conversaton needs to be specified\n");
         return -1;
     }
 
     opts_infile = filepath;
+    opts_pipeline = pipeline;
+    opts_drop_text = drop_text;
     return 0;
 }
@@ -6,6 +6,8 @@
 extern bool opts_srt;
 extern bool opts_ass;
 extern const char *opts_infile;
+extern bool opts_pipeline;
+extern bool opts_drop_text;
 
 /* ass options */
 extern const char *opts_ass_outfile;
@@ -13,6 +15,18 @@ extern int opts_ass_vid_w, opts_ass_vid_h;
 extern int opts_ass_border_size;
 extern const char *opts_ass_fontfile;
 extern bool opts_ass_debug_boxes;
+extern int opts_ass_jobs;
+extern int opts_ass_max_mem;
+extern const char *opts_ass_cache_file;
+extern const char *opts_ass_glyph_cache_dir;
+
+/* glyph cache tool options, the file is opts_infile */
+extern bool opts_glyphs;
+extern int opts_glyphs_prune;
+
+/* cue cache tool options, the file is opts_infile */
+extern bool opts_cues;
+extern int opts_cues_prune;
 
 /* srt options */
 extern const char *opts_srt_outfile;
@@ -9,6 +9,8 @@
 
 #include "tokenizer.h"
 #include "cuestyle.h"
+#include "keywords.h"
+#include "reader.h"
 
 #define PARSER_LEAN 1
 
@@ -38,24 +40,26 @@ const char *str_cue_text_align[] = {
 
 static enum cue_line_align prs_cue_line_align(const char *str)
 {
-    if (strcmp(str, "start") == 0)
-        return LINE_ALIGN_START;
-    if (strcmp(str, "center") == 0)
-        return LINE_ALIGN_CENTER;
-    if (strcmp(str, "end") == 0)
-        return LINE_ALIGN_END;
-    return -1;
+    switch (kw_lookup(str, strlen(str))) {
+    case KW_START: return LINE_ALIGN_START;
+    case KW_CENTER: return LINE_ALIGN_CENTER;
+    case KW_END: return LINE_ALIGN_END;
+    default: return -1;
+    }
 }
 
 
-static void prs_cue_free(void *data)
+static void prs_cue_free(struct cue *cue)
 {
-    struct cue *cue = data;
     if (cue->ident) {
         free(cue->ident);
     }
+    if (cue->text)
+        free(cue->text);
     if (cue->text_node)
         ctxt_free_node(cue->text_node);
+    if (cue->text_info.plain)
+        free(cue->text_info.plain);
 }
 
 static void prs_default_cue(struct cue *cue)
@@ -69,8 +73,8 @@ static void prs_default_cue(struct cue *cue)
 }
 #define ADVANCE() { \
     i++; \
-    if (i >= tokens->e_idx) goto err; \
-    tok = dyna_elem(tokens, i); \
+    if (i >= tokens->count) goto err; \
+    tok = &tokens->data[i]; \
 }
 #define EXP(exp_token_type) if (tok->type != exp_token_type) { \
     fprintf(stderr, "Unexpected token: %s  expected %s\n", tok_type2str(tok->type), tok_type2str(exp_token_type)); \
@@ -128,19 +132,17 @@ static int prs_cue_settings_line(struct token *tok, struct cue *cue)
 /* Return -1 on error */
 static enum cue_pos_align prs_cue_pos_align(const char *str)
 {
+    switch (kw_lookup(str, strlen(str))) {
+    case KW_LINE_LEFT: return POS_ALIGN_LINE_LEFT;
+#if PARSER_LEAN == 1
     /* This is kind of weird, the spec says that this cannot be "middle"
      * but the example vtt i have have this value as middle... */
-    if (strcmp(str, "line-left") == 0)
-        return POS_ALIGN_LINE_LEFT;
-    if (strcmp(str, "center") == 0
-#if PARSER_LEAN == 1
-            || strcmp(str, "middle") == 0
+    case KW_MIDDLE:
 #endif
-       )
-        return POS_ALIGN_CENTER;
-    if (strcmp(str, "line-right") == 0)
-        return POS_ALIGN_LINE_RIGHT;
-    return -1;
+    case KW_CENTER: return POS_ALIGN_CENTER;
+    case KW_LINE_RIGHT: return POS_ALIGN_LINE_RIGHT;
+    default: return -1;
+    }
 }
 
 static int prs_cue_settings_position(struct token *tok, struct cue *cue)
@@ -183,21 +185,26 @@ static int prs_cue_settings_align(struct token *tok, struct cue *cue)
 {
     char *val = tok->cue_setting.value;
 
-    if (strcmp(val, "start") == 0) {
+    switch (kw_lookup(val, strlen(val))) {
+    case KW_START:
         cue->text_align = TEXT_ALIGN_START;
-    } else if (strcmp(val, "center") == 0
+        break;
 #if PARSER_LEAN == 1
-            || strcmp(val, "middle") == 0
+    case KW_MIDDLE:
 #endif
-            ) {
+    case KW_CENTER:
         cue->text_align = TEXT_ALIGN_CENTER;
-    } else if (strcmp(val, "end") == 0) {
+        break;
+    case KW_END:
         cue->text_align = TEXT_ALIGN_END;
-    } else if (strcmp(val, "left") == 0) {
+        break;
+    case KW_LEFT:
         cue->text_align = TEXT_ALIGN_LEFT;
-    } else if (strcmp(val, "right") == 0) {
+        break;
+    case KW_RIGHT:
         cue->text_align = TEXT_ALIGN_RIGHT;
-    } else {
+        break;
+    default:
         return -1;
     }
 
@@ -208,11 +215,14 @@ static int prs_cue_settings_vertical(struct token *tok, struct cue *cue)
 {
     char *val = tok->cue_setting.value;
 
-    if (strcmp(val, "rl") == 0) {
+    switch (kw_lookup(val, strlen(val))) {
+    case KW_RL:
         cue->writing_direction = WD_VERTICAL_GROW_LEFT;
-    } else if (strcmp(val, "lr") == 0) {
+        break;
+    case KW_LR:
         cue->writing_direction = WD_VERTICAL_GROW_RIGHT;
-    } else {
+        break;
+    default:
         return -1;
     }
 
@@ -221,25 +231,31 @@ static int prs_cue_settings_vertical(struct token *tok, struct cue *cue)
 }
 
 /* Returns an updated i */
-static int prs_cue_settings(struct dyna *tokens, int i, struct cue *cue)
+static int prs_cue_settings(struct token_vec *tokens, int i, struct cue *cue)
 {
     int en;
     //struct token *tok = dyna_elem(tokens, i);
     struct token *tok;
-    for (; i < tokens->e_idx && (tok = dyna_elem(tokens, i))->type == TOK_CUE_SETTING; i++) {
+    for (; i < tokens->count && (tok = &tokens->data[i])->type == TOK_CUE_SETTING; i++) {
         char *skey = tok->cue_setting.key;
 
-        if (strcmp(skey, "vertical") == 0) {
+        switch (kw_lookup(skey, strlen(skey))) {
+        case KW_VERTICAL:
             en = prs_cue_settings_vertical(tok, cue);
-        } else if (strcmp(skey, "line") == 0) {
+            break;
+        case KW_LINE:
             en = prs_cue_settings_line(tok, cue);
-        } else if (strcmp(skey, "position") == 0) {
+            break;
+        case KW_POSITION:
             en = prs_cue_settings_position(tok, cue);
-        } else if (strcmp(skey, "size") == 0) {
+            break;
+        case KW_SIZE:
             en = prs_cue_settings_size(tok, cue);
-        } else if (strcmp(skey, "align") == 0) {
+            break;
+        case KW_ALIGN:
             en = prs_cue_settings_align(tok, cue);
-        } else {
+            break;
+        default:
             printf("cue setting key '%s' not handled!\n", skey);
             return -1;
         }
@@ -252,21 +268,30 @@ static int prs_cue_settings(struct dyna *tokens, int i, struct cue *cue)
     return i;
 }
 
-static int prs_parse_cue_text(struct dyna *tokens, int i, struct cue *cue)
+/* Only collects the text, it is parsed by prs_cue_text_node() */
+static int prs_parse_cue_text(struct token_vec *tokens, int i, struct cue *cue)
 {
     struct token *tok;
     int oi = i;
     size_t len = 0;
-    for (; i < tokens->e_idx && (tok = dyna_elem(tokens, i))->type == TOK_CUE_TEXT; i++) {
+    for (; i < tokens->count && (tok = &tokens->data[i])->type == TOK_CUE_TEXT; i++) {
         len += strlen(tok->cue_text.str);
         len += 1; /* for \n and \0 */
     }
-    char full_txt[len];
+
+    if (i - oi == 1) {
+        /* A single line, move the string instead of copying */
+        cue->text = tokens->data[oi].cue_text.str;
+        tokens->data[oi].cue_text.str = NULL;
+        return i;
+    }
+
+    char *full_txt = malloc(len);
     char *ptr = full_txt;
+    assert(full_txt);
     *ptr = '\0';
     i = oi;
-    for (; i < tokens->e_idx && (tok = dyna_elem(tokens, i))->type == TOK_CUE_TEXT; i++) {
-        /* no care about performance righ now */
+    for (; i < tokens->count && (tok = &tokens->data[i])->type == TOK_CUE_TEXT; i++) {
         ptr = stpcpy(ptr, tok->cue_text.str);
         if (ptr - full_txt < len - 1) {
             *ptr = '\n';
@@ -275,25 +300,57 @@ static int prs_parse_cue_text(struct dyna *tokens, int i, struct cue *cue)
         }
     }
 
-    cue->text_node = ctxt_parse(full_txt);
+    cue->text = full_txt;
     return i;
 }
 
-int prs_parse_tokens(struct dyna *tokens, struct dyna **out_cues, struct dyna **out_styles)
+struct vtt_node *prs_cue_text_node(struct cue *cue)
 {
-    struct dyna *cues = dyna_create(sizeof(struct cue));
-    dyna_set_free_fn(cues, prs_cue_free);
+    if (cue->text_node == NULL && cue->text)
+        cue->text_node = ctxt_parse(cue->text, &cue->text_info);
+    return cue->text_node;
+}
+
+void prs_cue_drop_text_node(struct cue *cue)
+{
+    if (cue->text_node)
+        ctxt_free_node(cue->text_node);
+    if (cue->text_info.plain)
+        free(cue->text_info.plain);
+    cue->text_node = NULL;
+    cue->text_info = (struct ctxt_info){0};
+}
 
+struct cue_vec *prs_create_cues()
+{
+    return cue_vec_create(64);
+}
+
+void prs_destroy_cues(struct cue_vec *cues)
+{
+    for (int64_t i = 0; i < cues->count; i++)
+        prs_cue_free(&cues->data[i]);
+    cue_vec_destroy(cues);
+}
+
+void prs_cue_destroy(struct cue *cue)
+{
+    prs_cue_free(cue);
+    free(cue);
+}
+
+int prs_parse_cues(struct token_vec *tokens, struct cue_vec *cues)
+{
     bool in_cue = false;
     struct cue cc;
-    for (int i = 0; i < tokens->e_idx;) {
-        struct token *tok = dyna_elem(tokens, i);
+    for (int i = 0; i < tokens->count;) {
+        struct token *tok = &tokens->data[i];
         if (tok->type != TOK_TIMESTAMP && tok->type != TOK_IDENT) {
             i++;
             continue;
         }
         if (in_cue) {
-            dyna_append(cues, &cc);
+            cue_vec_append(cues, &cc);
             in_cue = false;
         }
         in_cue = true;
@@ -318,7 +375,9 @@ int prs_parse_tokens(struct dyna *tokens, struct dyna **out_cues, struct dyna **
             if (curr_i == -1)
                 goto err;
             i = curr_i;
-            tok = dyna_elem(tokens, i);
+            if (i >= tokens->count)
+                goto err;
+            tok = &tokens->data[i];
         }
 
         EXP(TOK_CUE_TEXT);
@@ -328,17 +387,27 @@ int prs_parse_tokens(struct dyna *tokens, struct dyna **out_cues, struct dyna **
         i = consumed;
     }
     if (in_cue)
-        dyna_append(cues, &cc);
-
+        cue_vec_append(cues, &cc);
 
-    *out_styles = cuestyle_parse(tokens);
-    *out_cues = cues;
     return 0;
 err:
     fprintf(stderr, "Exiting from parse_tokens\n");
-    dyna_destroy(cues);
     return -1;
+}
+
+int prs_parse_tokens(struct token_vec *tokens, struct cue_vec **out_cues, struct cue_styles **out_styles)
+{
+    struct cue_vec *cues = prs_create_cues();
 
+    cue_vec_reserve(cues, rdr_size_hints()->cues);
+    if (prs_parse_cues(tokens, cues) != 0) {
+        prs_destroy_cues(cues);
+        return -1;
+    }
+
+    *out_styles = cuestyle_parse(tokens);
+    *out_cues = cues;
+    return 0;
 }
 
 #undef EXP
@@ -1,11 +1,12 @@
 #ifndef _VTT2ASS_PARSER_H
 #define _VTT2ASS_PARSER_H
-#include "dyna.h"
+#include "vec.h"
 #include <math.h>
 #include <stdbool.h>
 
 #include "cuetext.h"
 #include "cuestyle.h"
+#include "tokenizer.h"
 
 enum cue_writing_direction {
     WD_HORIZONTAL = 0, /* def */
@@ -76,15 +77,35 @@ struct cue {
      * start and end can mean different things based on the base_direction */
     enum cue_text_align text_align; /* 'align:' def CENTER */
 
-    struct vtt_node *text_node; /* root node of the text nodes, def NULL */
+    char *text; /* The raw text of the cue, lines joined with \n. free */
+    /* root node of the text nodes, def NULL. Only built when it is needed,
+     * so use prs_cue_text_node() unless it is known to be parsed already */
+    struct vtt_node *text_node;
+    struct ctxt_info text_info; /* Filled together with text_node */
 
     enum cue_base_direction base_direction; /* Text writing direction, def BDIR_LTR */
 
     int64_t time_start, time_end; /* start and end time in ms */
 };
 
+VEC_DEFINE(cue_vec, struct cue)
+
 /* return -1 on error */
-int prs_parse_tokens(struct dyna *tokens, struct dyna **cues, struct dyna **styles);
+int prs_parse_tokens(struct token_vec *tokens, struct cue_vec **cues, struct cue_styles **styles);
+
+/* Creates an empty cue array */
+struct cue_vec *prs_create_cues();
+/* Frees the cues and the array */
+void prs_destroy_cues(struct cue_vec *cues);
+/* Appends the cues found in tokens to cues, styles are not parsed
+ * return -1 on error */
+int prs_parse_cues(struct token_vec *tokens, struct cue_vec *cues);
+/* Frees a heap allocated cue */
+void prs_cue_destroy(struct cue *cue);
+/* Returns the root of the text nodes, parses the text on the 1st call */
+struct vtt_node *prs_cue_text_node(struct cue *cue);
+/* Frees the text nodes, but keeps the text, so they can be parsed again */
+void prs_cue_drop_text_node(struct cue *cue);
 
 void prs_cue2str(int size, char out_str[size], const struct cue *cue);
 
@@ -0,0 +1,230 @@
+#include "pipeline.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <assert.h>
+#include <pthread.h>
+
+#include "spsc.h"
+#include "tokenizer.h"
+#include "parser.h"
+#include "cuestyle.h"
+#include "ass.h"
+#include "srt.h"
+#include "font.h"
+#include "textextents.h"
+#include "opts.h"
+
+/* How many items can be waiting between two stages */
+#define PIPE_QUEUE_SIZE 64
+
+/* A cue, and the ass events generated from it */
+struct pipe_item {
+    struct cue *cue;
+    struct ass_node_vec *events; /* NULL if no ass output */
+};
+
+struct pipe_ctx {
+    /* token batches, then cues, then pipe_items. NULL ends the stream */
+    struct spsc *q_tokens, *q_cues, *q_items;
+    atomic_bool failed;
+
+    bool do_ass;
+    const struct ass_params *ap;
+};
+
+static void *pipe_tokenize_main(void *data)
+{
+    struct pipe_ctx *pc = data;
+    int en;
+
+    for (;;) {
+        struct token_vec *tokens = tok_create_tokens();
+        en = tok_tokenize_next(tokens);
+        if (en == -1) {
+            atomic_store(&pc->failed, true);
+            tok_destroy_tokens(tokens);
+            break;
+        }
+        if (en == 0 && tokens->count == 0) {
+            tok_destroy_tokens(tokens);
+            break;
+        }
+        spsc_push(pc->q_tokens, tokens);
+        if (en == 0)
+            break;
+    }
+
+    spsc_push(pc->q_tokens, NULL);
+    return NULL;
+}
+
+static void *pipe_parse_main(void *data)
+{
+    struct pipe_ctx *pc = data;
+    struct cue_vec *cues = prs_create_cues();
+    struct token_vec *tokens;
+
+    while ((tokens = spsc_pop(pc->q_tokens))) {
+        if (atomic_load(&pc->failed) || prs_parse_cues(tokens, cues) != 0) {
+            /* Keep draining, so the tokenizer does not block forever */
+            atomic_store(&pc->failed, true);
+            tok_destroy_tokens(tokens);
+            continue;
+        }
+        tok_destroy_tokens(tokens);
+
+        for (int64_t i = 0; i < cues->count; i++) {
+            struct cue *c = malloc(sizeof(*c));
+            assert(c);
+            *c = cues->data[i];
+            /* Parse the text here, so the layout stage does not have to */
+            prs_cue_text_node(c);
+            spsc_push(pc->q_cues, c);
+        }
+        /* The cues were moved out */
+        cues->count = 0;
+    }
+
+    prs_destroy_cues(cues);
+    spsc_push(pc->q_cues, NULL);
+    return NULL;
+}
+
+static void *pipe_layout_main(void *data)
+{
+    struct pipe_ctx *pc = data;
+    struct ass_params lap;
+    struct cue *c;
+
+    /* Only what the layout needs, the writer's state stays on the writer thread */
+    if (pc->do_ass)
+        ass_layout_params_create(pc->ap, &lap);
+
+    while ((c = spsc_pop(pc->q_cues))) {
+        struct pipe_item *item = calloc(1, sizeof(*item));
+        assert(item);
+        item->cue = c;
+
+        if (pc->do_ass && !atomic_load(&pc->failed)) {
+            /* The events are moved into the writer's ass_nodes, so no free fn here */
+            lap.ass_nodes = item->events = ass_node_vec_create(4);
+            ass_layout_cue(&lap, c);
+        }
+        spsc_push(pc->q_items, item);
+    }
+
+    /* Faces and the caches are per thread */
+    /* The writer only reads the stats of its own cache after joining this thread */
+    if (pc->do_ass)
+        ass_layout_params_destroy(&lap, pc->ap);
+    te_thread_dinit();
+    font_thread_dinit();
+    spsc_push(pc->q_items, NULL);
+    return NULL;
+}
+
+int pipe_run()
+{
+    struct video_info vinf = {
+        .width = opts_ass_vid_w,
+        .height = opts_ass_vid_h,
+    };
+    struct pipe_ctx pc = {
+        .do_ass = opts_ass,
+    };
+    bool do_srt = opts_srt;
+    struct ass_params ap;
+    struct srt_params sp;
+    struct token_vec *tokens;
+    struct cue_styles *styles;
+    struct pipe_item *item;
+    pthread_t th_tokenize, th_parse, th_layout;
+    int en;
+
+    /* Styles can only be before the first cue, so parse the header
+     * and the first cue here, before any of the stages need the styles */
+    tokens = tok_create_tokens();
+    if (tok_begin(tokens) != 0 || (en = tok_tokenize_next(tokens)) == -1) {
+        printf("Failed to tokenize\n");
+        tok_destroy_tokens(tokens);
+        return -1;
+    }
+    styles = cuestyle_parse(tokens);
+
+    if (pc.do_ass && ass_write_begin(&ap, styles, &vinf, opts_ass_fontfile, opts_ass_outfile) != 0) {
+        perror("Failed to open ass output");
+        goto err_ass;
+    }
+    if (do_srt && srt_write_begin(&sp, styles, opts_srt_outfile) != 0) {
+        perror("Failed to open srt output");
+        goto err_srt;
+    }
+    pc.ap = &ap;
+
+    pc.q_tokens = spsc_create(PIPE_QUEUE_SIZE);
+    pc.q_cues = spsc_create(PIPE_QUEUE_SIZE);
+    pc.q_items = spsc_create(PIPE_QUEUE_SIZE);
+    assert(pc.q_tokens && pc.q_cues && pc.q_items);
+    atomic_init(&pc.failed, false);
+
+    spsc_push(pc.q_tokens, tokens);
+    if (en == 1) {
+        pthread_create(&th_tokenize, NULL, pipe_tokenize_main, &pc);
+    } else {
+        /* Got to the end of the file already */
+        spsc_push(pc.q_tokens, NULL);
+    }
+    pthread_create(&th_parse, NULL, pipe_parse_main, &pc);
+    pthread_create(&th_layout, NULL, pipe_layout_main, &pc);
+
+    /* The calling thread does the writing */
+    while ((item = spsc_pop(pc.q_items))) {
+        if (do_srt && !atomic_load(&pc.failed))
+            srt_write_cue(&sp, item->cue);
+        if (item->events) {
+            ass_write_advance(&ap, item->cue->time_start);
+            for (int64_t i = 0; i < item->events->count; i++)
+                ass_node_vec_append(ap.ass_nodes, &item->events->data[i]);
+            ass_node_vec_destroy(item->events);
+        }
+        prs_cue_destroy(item->cue);
+        free(item);
+    }
+
+    if (en == 1)
+        pthread_join(th_tokenize, NULL);
+    pthread_join(th_parse, NULL);
+    pthread_join(th_layout, NULL);
+
+    spsc_destroy(pc.q_tokens);
+    spsc_destroy(pc.q_cues);
+    spsc_destroy(pc.q_items);
+
+    /* The ass spill and merge, and the flush of both files, are done in these */
+    if (do_srt && srt_write_end(&sp) != 0) {
+        printf("Failed to write the srt output\n");
+        atomic_store(&pc.failed, true);
+    }
+    if (pc.do_ass && ass_write_end(&ap) != 0) {
+        printf("Failed to write the ass output\n");
+        atomic_store(&pc.failed, true);
+    }
+    if (styles)
+        cuestyle_destroy(styles);
+
+    if (atomic_load(&pc.failed))
+        return -1;
+    return 0;
+
+err_srt:
+    if (pc.do_ass)
+        ass_write_end(&ap);
+err_ass:
+    if (styles)
+        cuestyle_destroy(styles);
+    tok_destroy_tokens(tokens);
+    return -1;
+}
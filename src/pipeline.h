@@ -0,0 +1,11 @@
+#ifndef _VTT2ASS_PIPELINE_H
+#define _VTT2ASS_PIPELINE_H
+
+/* Does the conversion with the reading and tokenizing, the parsing,
+ * the layout and the writing each running on their own thread.
+ * Cues are freed as soon as they are written.
+ * Needs to have rdr_init() called before this, uses the global options
+ * Returns -1 on error */
+int pipe_run();
+
+#endif /* _VTT2ASS_PIPELINE_H */
@@ -13,6 +13,26 @@
 
 static const uint8_t *file_data = NULL;
 static int64_t file_index = 0, file_size = 0;
+static struct rdr_size_hints size_hints;
+
+static void rdr_count_hints(void)
+{
+    const uint8_t *p = file_data, *end = file_data + file_size;
+
+    size_hints = (struct rdr_size_hints){ .bytes = file_size, .lines = 1 };
+    while ((p = memchr(p, '\n', end - p))) {
+        size_hints.lines++;
+        p++;
+    }
+
+    /* Every cue has a "-->" on its timing line */
+    p = file_data;
+    while ((p = memchr(p, '>', end - p))) {
+        if (p - file_data >= 2 && p[-1] == '-' && p[-2] == '-')
+            size_hints.cues++;
+        p++;
+    }
+}
 
 int rdr_init(const char *filename)
 {
@@ -42,6 +62,7 @@ int rdr_init(const char *filename)
     file_index = 0;
     file_size = fs.st_size;
     file_data = mm;
+    rdr_count_hints();
 
     //printf("---\n%.30s\n---\n", mm);
 
@@ -57,9 +78,15 @@ int rdr_free()
     }
     file_index = file_size = 0;
     file_data = NULL;
+    size_hints = (struct rdr_size_hints){0};
     return 0;
 }
 
+const struct rdr_size_hints *rdr_size_hints(void)
+{
+    return &size_hints;
+}
+
 int rdr_peek()
 {
     if (file_index >= file_size)
@@ -2,8 +2,17 @@
 #define _VTT2ASS_READER_H
 #include <stdint.h>
 
+/* Sizes of the input, counted once in rdr_init(), so the arrays
+ * can be allocated with the right size up front */
+struct rdr_size_hints {
+    int64_t bytes;
+    int64_t lines;
+    int64_t cues; /* The number of "-->", so it can be a bit more than the real count */
+};
+
 int rdr_init(const char *filename);
 int rdr_free();
+const struct rdr_size_hints *rdr_size_hints(void);
 
 int rdr_getc();
 int rdr_peek();
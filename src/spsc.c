@@ -0,0 +1,104 @@
+#include "spsc.h"
+
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+
+/* Busy wait a little before sleeping, stages are usually
+ * only a few items apart */
+#define SPIN_COUNT 64
+
+struct spsc *spsc_create(size_t cap)
+{
+    size_t rcap = 2;
+    while (rcap < cap)
+        rcap *= 2;
+
+    struct spsc *q = aligned_alloc(_Alignof(struct spsc), sizeof(*q));
+    if (q == NULL)
+        return NULL;
+
+    q->cap = rcap;
+    q->slots = calloc(rcap, sizeof(*q->slots));
+    if (q->slots == NULL) {
+        free(q);
+        return NULL;
+    }
+    atomic_init(&q->head, 0);
+    atomic_init(&q->tail, 0);
+    atomic_init(&q->sleepers, 0);
+    pthread_mutex_init(&q->lock, NULL);
+    pthread_cond_init(&q->cond, NULL);
+    return q;
+}
+
+void spsc_destroy(struct spsc *q)
+{
+    pthread_mutex_destroy(&q->lock);
+    pthread_cond_destroy(&q->cond);
+    free(q->slots);
+    free(q);
+}
+
+static bool spsc_full(struct spsc *q, size_t tail)
+{
+    return tail - atomic_load_explicit(&q->head, memory_order_acquire) >= q->cap;
+}
+
+static bool spsc_empty(struct spsc *q, size_t head)
+{
+    return atomic_load_explicit(&q->tail, memory_order_acquire) == head;
+}
+
+/* Sleeps until the condition is false. Called after the index of this side
+ * was checked, the other side checks sleepers after changing its index */
+static void spsc_sleep(struct spsc *q, bool (*cond)(struct spsc *, size_t), size_t idx)
+{
+    pthread_mutex_lock(&q->lock);
+    atomic_fetch_add(&q->sleepers, 1);
+    atomic_thread_fence(memory_order_seq_cst);
+    while (cond(q, idx))
+        pthread_cond_wait(&q->cond, &q->lock);
+    atomic_fetch_sub(&q->sleepers, 1);
+    pthread_mutex_unlock(&q->lock);
+}
+
+static void spsc_wake(struct spsc *q)
+{
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&q->sleepers, memory_order_relaxed) == 0)
+        return;
+    pthread_mutex_lock(&q->lock);
+    pthread_cond_broadcast(&q->cond);
+    pthread_mutex_unlock(&q->lock);
+}
+
+void spsc_push(struct spsc *q, void *item)
+{
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+
+    for (int spins = 0; spsc_full(q, tail); spins++) {
+        if (spins >= SPIN_COUNT)
+            spsc_sleep(q, spsc_full, tail);
+    }
+
+    q->slots[tail & (q->cap - 1)] = item;
+    atomic_store_explicit(&q->tail, tail + 1, memory_order_release);
+    spsc_wake(q);
+}
+
+void *spsc_pop(struct spsc *q)
+{
+    size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+    void *item;
+
+    for (int spins = 0; spsc_empty(q, head); spins++) {
+        if (spins >= SPIN_COUNT)
+            spsc_sleep(q, spsc_empty, head);
+    }
+
+    item = q->slots[head & (q->cap - 1)];
+    atomic_store_explicit(&q->head, head + 1, memory_order_release);
+    spsc_wake(q);
+    return item;
+}
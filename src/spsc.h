@@ -0,0 +1,34 @@
+#ifndef _VTT2ASS_SPSC_H
+#define _VTT2ASS_SPSC_H
+#include <stddef.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+/* Bounded lock-free queue of pointers, for exactly one producer
+ * and one consumer thread. A side that has to wait spins a little,
+ * then sleeps until the other side changes the queue */
+struct spsc {
+    size_t cap; /* always a power of 2 */
+    void **slots;
+
+    /* Index of the next slot to pop, only written by the consumer */
+    _Alignas(64) atomic_size_t head;
+    /* Index of the next slot to push, only written by the producer */
+    _Alignas(64) atomic_size_t tail;
+
+    /* Only taken to sleep, or to wake a sleeping side */
+    _Alignas(64) pthread_mutex_t lock;
+    pthread_cond_t cond;
+    atomic_int sleepers;
+};
+
+/* cap is rounded up to a power of 2 */
+struct spsc *spsc_create(size_t cap);
+void spsc_destroy(struct spsc *q);
+
+/* Waits while the queue is full */
+void spsc_push(struct spsc *q, void *item);
+/* Waits while the queue is empty */
+void *spsc_pop(struct spsc *q);
+
+#endif /* _VTT2ASS_SPSC_H */
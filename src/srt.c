@@ -3,10 +3,13 @@
 #include "cuetext.h"
 #include <stdio.h>
 #include <string.h>
+#include <stdint.h>
 
 #include "util.h"
+#include "strbuf.h"
+#include "opts.h"
 
-static void srt_ms_to_str(int64_t tms, int n, char out[n])
+static void srt_ms_to_str(int64_t tms, struct strbuf *out)
 {
     int h, m, s, ms;
     h = tms / H_IN_MS;
@@ -18,18 +21,21 @@ static void srt_ms_to_str(int64_t tms, int n, char out[n])
     s = tms / S_IN_MS;
     ms = tms % S_IN_MS;
 
-    snprintf(out, n, "%02d:%02d:%02d,%03d", h, m, s, ms);
+    strbuf_append_int_pad(out, h, 2);
+    strbuf_append_char(out, ':');
+    strbuf_append_int_pad(out, m, 2);
+    strbuf_append_char(out, ':');
+    strbuf_append_int_pad(out, s, 2);
+    strbuf_append_char(out, ',');
+    strbuf_append_int_pad(out, ms, 3);
 }
 
-static void srt_write_timestamp(FILE *f, struct cue *c)
+static void srt_write_timestamp(struct strbuf *out, struct cue *c)
 {
-    char tsb[32];
-
-    srt_ms_to_str(c->time_start, sizeof(tsb), tsb);
-    fprintf(f, "%s --> ", tsb);
-
-    srt_ms_to_str(c->time_end, sizeof(tsb), tsb);
-    fprintf(f, "%s\n", tsb);
+    srt_ms_to_str(c->time_start, out);
+    strbuf_append_lit(out, " --> ");
+    srt_ms_to_str(c->time_end, out);
+    strbuf_append_char(out, '\n');
 }
 
 enum tag_position {
@@ -37,7 +43,7 @@ enum tag_position {
     TAG_END,
 };
 
-static void handle_position_tags(FILE *f, const struct cue *c, enum tag_position tpos)
+static void handle_position_tags(struct strbuf *out, const struct cue *c, enum tag_position tpos)
 {
     /* Only handle left to right horizontal text for now */
     
@@ -47,7 +53,6 @@ static void handle_position_tags(FILE *f, const struct cue *c, enum tag_position
         { 1, 2, 3 },
     };
     int xal = 1, yal = 2;
-    char alignstr[16];
 
     if (tpos == TAG_END)
         return; // This dosn't need an ending tag
@@ -76,8 +81,9 @@ static void handle_position_tags(FILE *f, const struct cue *c, enum tag_position
     if (xal == 1 && yal == 2)
         return; // default
 
-    sprintf(alignstr, "{\\an%d}", alignmap[yal][xal]);
-    fputs(alignstr, f);
+    strbuf_append_lit(out, "{\\an");
+    strbuf_append_int(out, alignmap[yal][xal]);
+    strbuf_append_char(out, '}');
 }
 
 static const char *tag_map[][2] = {
@@ -91,59 +97,93 @@ static const char *tag_map[][2] = {
     [VNODE_UNDERLINE][1] = "</u>",
 };
 
-static void srt_write_tag(FILE *f, const struct cue *c, struct vtt_node *node, const struct dyna *cstyles, enum tag_position pos)
+/* Which tags to write for a class span */
+static enum vtt_node_type srt_class_tag_type(struct srt_params *sp, const struct cue *c, const struct vtt_node *node)
+{
+    const struct cue_style *rules[CUESTYLE_MAX_MATCH];
+    enum vtt_node_type type = VNODE_CLASS;
+    char key[256];
+    void **cached = NULL;
+    int key_len, count;
+
+    key_len = cuestyle_node_key(sp->cstyles, c->ident, node, sizeof(key), key);
+    if (key_len >= 0) {
+        cached = hmap_put(sp->class_tags, key, key_len);
+        if (*cached)
+            return (intptr_t)*cached - 1;
+    }
+
+    count = cuestyle_match(sp->cstyles, c->ident, node, ARRSIZE(rules), rules);
+    /* Srt has no spans with several tags, so pick the most visible one */
+    bool italic = false, bold = false, underline = false;
+    for (int i = 0; i < count; i++) {
+        if (rules[i]->italic_set)
+            italic = rules[i]->italic;
+        if (rules[i]->bold_set)
+            bold = rules[i]->bold;
+        if (rules[i]->decoration_set)
+            underline = rules[i]->underline;
+    }
+    if (italic)
+        type = VNODE_ITALIC;
+    else if (bold)
+        type = VNODE_BOLD;
+    else if (underline)
+        type = VNODE_UNDERLINE;
+
+    if (cached)
+        *cached = (void*)(intptr_t)(type + 1);
+    return type;
+}
+
+static void srt_write_tag(struct srt_params *sp, struct strbuf *out, const struct cue *c, struct vtt_node *node, enum tag_position pos)
 {
     enum vtt_node_type type = node->type;
 
     if (type == VNODE_ROOT) {
-        handle_position_tags(f, c, pos);
+        handle_position_tags(out, c, pos);
         return;
     }
 
-    if (type == VNODE_CLASS) {
-        // NOTE: only 1 class name is handled here, and we should do it another way anyway
-        if (node->class_names) {
-            const char *classname = *(char**)dyna_elem(node->class_names, 0);
-            char cname_with_cue[128];
-
-            snprintf(cname_with_cue, sizeof(cname_with_cue), "::cue(.%s)", classname);
-            //printf("Searching for class name '%s'\n", cname_with_cue);
-            const struct cue_style *cs = cuestyle_get_by_selector(cstyles, cname_with_cue);
-            if (cs) {
-                if (cs->italic)
-                    type = VNODE_ITALIC;
-            }
-        }
-    }
+    if (type == VNODE_CLASS)
+        type = srt_class_tag_type(sp, c, node);
 
     switch (type) {
     case VNODE_RUBY_TEXT:
     case VNODE_ITALIC:
     case VNODE_BOLD:
     case VNODE_UNDERLINE:
-        fputs(tag_map[type][pos], f);
+        strbuf_append_str(out, tag_map[type][pos]);
         break;
     }
 }
 
-static void srt_write_text(FILE *f, const struct cue *c, struct vtt_node *node, const struct dyna *cstyles)
+static void srt_write_text(struct srt_params *sp, struct strbuf *out, const struct cue *c, struct vtt_node *node)
 {
     //assert(node->type == VNODE_ROOT);
 
+    if (node->type == VNODE_ROOT && c->text_info.max_depth == 0) {
+        /* No tags, so the text is the same as the plain text */
+        srt_write_tag(sp, out, c, node, TAG_START);
+        strbuf_append(out, c->text_info.plain, c->text_info.plain_len);
+        srt_write_tag(sp, out, c, node, TAG_END);
+        return;
+    }
+
     /* These two cannot have childrens */
     if (node->type == VNODE_TEXT) {
-        fputs(node->text, f);
+        strbuf_append_str(out, node->text);
         return;
     }
     if (node->type == VNODE_TIMESTAMP)
         return;
 
-    srt_write_tag(f, c, node, cstyles, TAG_START);
+    srt_write_tag(sp, out, c, node, TAG_START);
 
     for (int i = 0; node->childs && i < node->childs->e_idx; i++) {
         struct vtt_node *cn = dyna_elem(node->childs, i);
 
-        srt_write_text(f, c, cn, cstyles);
+        srt_write_text(sp, out, c, cn);
 
 #if 0
         else if (tok->type == TTOK_TAG_START && strcmp(tok->ttok_tag_start.tag_name, "rt") == 0)
@@ -154,28 +194,65 @@ static void srt_write_text(FILE *f, const struct cue *c, struct vtt_node *node,
 
     }
 
-    srt_write_tag(f, c, node, cstyles, TAG_END);
+    srt_write_tag(sp, out, c, node, TAG_END);
 }
 
-int srt_write(struct dyna *cues, struct dyna *cstyles, const char *fname)
+int srt_write_begin(struct srt_params *sp, const struct cue_styles *cstyles, const char *fname)
 {
-    FILE *f = fopen(fname, "w");
-    if (f == NULL)
+    memset(sp, 0, sizeof(*sp));
+    sp->f = fopen(fname, "w");
+    if (sp->f == NULL)
         return -1;
+    sp->cstyles = cstyles;
+    sp->class_tags = hmap_create(16, HMAPFLAG_COPYKEY);
+    strbuf_init(&sp->buf);
+    return 0;
+}
 
-    for (int i = 0; i < cues->e_idx; i++) {
-        struct cue *c = dyna_elem(cues, i);
-        if (c->text_node == NULL)
-            continue;
+void srt_write_cue(struct srt_params *sp, struct cue *c)
+{
+    /* Skipped cues still count, to keep the numbering */
+    sp->cue_count++;
+    if (prs_cue_text_node(c) == NULL)
+        return;
 
-        fprintf(f, "%d\n", i + 1);
-        srt_write_timestamp(f, c);
+    /* Build the whole entry, and write it at once */
+    strbuf_clear(&sp->buf);
+    strbuf_append_int(&sp->buf, sp->cue_count);
+    strbuf_append_char(&sp->buf, '\n');
+    srt_write_timestamp(&sp->buf, c);
+
+    srt_write_text(sp, &sp->buf, c, c->text_node);
+    strbuf_append_lit(&sp->buf, "\n\n");
+    fwrite(strbuf_data(&sp->buf), 1, sp->buf.len, sp->f);
+}
 
-        srt_write_text(f, c, c->text_node, cstyles);
-        fputc('\n', f);
-        fputc('\n', f);
+int srt_write_end(struct srt_params *sp)
+{
+    /* A full disk can show up only when the rest is flushed by fclose() */
+    int r = ferror(sp->f) ? -1 : 0;
+
+    if (fclose(sp->f) != 0 || r != 0) {
+        perror("Failed to write the srt file");
+        r = -1;
     }
+    sp->f = NULL;
+    hmap_destroy(sp->class_tags);
+    strbuf_free(&sp->buf);
+    return r;
+}
 
-    fclose(f);
-    return 0;
+int srt_write(struct cue_vec *cues, const struct cue_styles *cstyles, const char *fname)
+{
+    struct srt_params sp;
+    if (srt_write_begin(&sp, cstyles, fname) != 0)
+        return -1;
+
+    for (int64_t i = 0; i < cues->count; i++) {
+        srt_write_cue(&sp, &cues->data[i]);
+        if (opts_drop_text)
+            prs_cue_drop_text_node(&cues->data[i]);
+    }
+
+    return srt_write_end(&sp);
 }
@@ -3,7 +3,23 @@
 #include "parser.h"
 #include "cuestyle.h"
 #include "dyna.h"
+#include "strbuf.h"
 
-int srt_write(struct dyna *cues, struct dyna *cstyles, const char *fname);
+#include <stdio.h>
+
+struct srt_params {
+    FILE *f;
+    const struct cue_styles *cstyles;
+    struct hmap *class_tags; /* cuestyle_node_key() of a class span -> node type whose tags it gets + 1 */
+    int cue_count;
+    struct strbuf buf; /* The entry being built, reused for every cue */
+};
+
+int srt_write(struct cue_vec *cues, const struct cue_styles *cstyles, const char *fname);
+
+/* Writing one cue at a time, this is what srt_write() does */
+int srt_write_begin(struct srt_params *sp, const struct cue_styles *cstyles, const char *fname);
+void srt_write_cue(struct srt_params *sp, struct cue *c);
+int srt_write_end(struct srt_params *sp);
 
 #endif /* _VTT2ASS_SRT_H */
@@ -5,8 +5,8 @@
 #include <stdint.h>
 
 #define stack_init(var, v_item_size, v_max_size) \
-    char stackbuff_##var[v_item_size * v_max_size]; \
-    struct stack var = { .buff = stackbuff_##var, .e_cap = v_max_size, .e_size = v_item_size }; 
+    char stackbuff_##var[(v_item_size) * (v_max_size)]; \
+    struct stack var = { .buff = stackbuff_##var, .e_cap = (v_max_size), .e_size = (v_item_size) }; 
 
 struct stack {
     char *buff;
@@ -0,0 +1,137 @@
+#include "strbuf.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+void strbuf_init(struct strbuf *sb)
+{
+    sb->len = 0;
+    sb->cap = sizeof(sb->inl);
+    sb->heap = NULL;
+    sb->inl[0] = '\0';
+}
+
+void strbuf_free(struct strbuf *sb)
+{
+    if (sb->heap)
+        free(sb->heap);
+    strbuf_init(sb);
+}
+
+void strbuf_clear(struct strbuf *sb)
+{
+    sb->len = 0;
+    strbuf_data(sb)[0] = '\0';
+}
+
+void strbuf_reserve(struct strbuf *sb, size_t extra)
+{
+    size_t need = sb->len + extra + 1;
+    size_t ncap = sb->cap;
+
+    if (need <= sb->cap)
+        return;
+    while (ncap < need)
+        ncap *= 2;
+
+    if (sb->heap) {
+        sb->heap = realloc(sb->heap, ncap);
+        assert(sb->heap);
+    } else {
+        sb->heap = malloc(ncap);
+        assert(sb->heap);
+        memcpy(sb->heap, sb->inl, sb->len + 1);
+    }
+    sb->cap = ncap;
+}
+
+void strbuf_append(struct strbuf *sb, const char *s, size_t len)
+{
+    char *d;
+
+    strbuf_reserve(sb, len);
+    d = strbuf_data(sb);
+    memcpy(d + sb->len, s, len);
+    sb->len += len;
+    d[sb->len] = '\0';
+}
+
+void strbuf_append_str(struct strbuf *sb, const char *s)
+{
+    strbuf_append(sb, s, strlen(s));
+}
+
+void strbuf_append_char(struct strbuf *sb, char c)
+{
+    strbuf_append(sb, &c, 1);
+}
+
+void strbuf_append_int_pad(struct strbuf *sb, int64_t v, int width)
+{
+    char digits[24];
+    int n = 0;
+    /* Negate as unsigned, so INT64_MIN works too */
+    uint64_t u = v < 0 ? -(uint64_t)v : (uint64_t)v;
+
+    do {
+        digits[n++] = '0' + u % 10;
+        u /= 10;
+    } while (u);
+
+    strbuf_reserve(sb, 1 + (width > n ? width : n));
+    if (v < 0)
+        strbuf_append_char(sb, '-');
+    for (; width > n; width--)
+        strbuf_append_char(sb, '0');
+    while (n > 0)
+        strbuf_append_char(sb, digits[--n]);
+}
+
+void strbuf_append_int(struct strbuf *sb, int64_t v)
+{
+    strbuf_append_int_pad(sb, v, 0);
+}
+
+void strbuf_append_float(struct strbuf *sb, double v)
+{
+    char num[32];
+    /* Whole numbers are the common case (font sizes, spacing), those print like an int.
+     * %g prints -0 and 1e+06 and up differently, so those are left to it.
+     * The range is checked first, the cast is undefined for NaN and huge values */
+    if (v > -1e6 && v < 1e6 && v == (int64_t)v && !signbit(v)) {
+        strbuf_append_int(sb, v);
+        return;
+    }
+
+    int n = snprintf(num, sizeof(num), "%g", v);
+    assert(n > 0 && n < sizeof(num));
+    strbuf_append(sb, num, n);
+}
+
+void strbuf_append_escaped(struct strbuf *sb, const char *s, size_t len)
+{
+    const char *end = s + len, *nl;
+
+    while ((nl = memchr(s, '\n', end - s))) {
+        strbuf_append(sb, s, nl - s);
+        strbuf_append_lit(sb, "\\N");
+        s = nl + 1;
+    }
+    strbuf_append(sb, s, end - s);
+}
+
+char *strbuf_steal(struct strbuf *sb)
+{
+    char *s = sb->heap;
+
+    if (s == NULL) {
+        s = malloc(sb->len + 1);
+        assert(s);
+        memcpy(s, sb->inl, sb->len + 1);
+    }
+    strbuf_init(sb);
+    return s;
+}
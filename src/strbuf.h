@@ -0,0 +1,45 @@
+#ifndef _VTT2ASS_STRBUF_H
+#define _VTT2ASS_STRBUF_H
+#include <stddef.h>
+#include <stdint.h>
+
+/* Small strings are built in place, and only go to the heap when they grow out of it */
+#define STRBUF_INLINE 256
+
+/* A growable string, always '\0' terminated.
+ * It does not point into itself, so it can be copied while it is inline */
+struct strbuf {
+    size_t len, cap;
+    char *heap; /* NULL while the string is in inl */
+    char inl[STRBUF_INLINE];
+};
+
+#define strbuf_append_lit(sb, lit) strbuf_append(sb, "" lit, sizeof(lit) - 1)
+
+static inline char *strbuf_data(struct strbuf *sb)
+{
+    return sb->heap ? sb->heap : sb->inl;
+}
+
+void strbuf_init(struct strbuf *sb);
+void strbuf_free(struct strbuf *sb);
+/* Empties the string, but keeps the memory */
+void strbuf_clear(struct strbuf *sb);
+/* Makes room for extra more bytes, asserts on error */
+void strbuf_reserve(struct strbuf *sb, size_t extra);
+
+void strbuf_append(struct strbuf *sb, const char *s, size_t len);
+void strbuf_append_str(struct strbuf *sb, const char *s);
+void strbuf_append_char(struct strbuf *sb, char c);
+void strbuf_append_int(struct strbuf *sb, int64_t v);
+/* Zero padded to at least width digits, like %0*d */
+void strbuf_append_int_pad(struct strbuf *sb, int64_t v, int width);
+/* Same output as %g */
+void strbuf_append_float(struct strbuf *sb, double v);
+/* Appends len bytes of text with the newlines changed to \N, for ass event text */
+void strbuf_append_escaped(struct strbuf *sb, const char *s, size_t len);
+
+/* Returns the string in a malloc'd buffer, and empties sb. The caller frees it */
+char *strbuf_steal(struct strbuf *sb);
+
+#endif /* _VTT2ASS_STRBUF_H */
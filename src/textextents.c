@@ -1,10 +1,14 @@
 #include "textextents.h"
 
 #include <wchar.h>
+#include <string.h>
+#include <stdlib.h>
 #include <assert.h>
 #include <math.h>
 #include <sys/param.h>
 #include <hb-ft.h>
+#include <hb-ot.h>
+#include <hb-aat.h>
 
 #if 1 // debug
 #include <ft2build.h>
@@ -36,26 +40,11 @@ static void set_font_metrics(FT_Face ftface)
     }
 }
 
-void te_create_obj(const char *fontpath, const char *text, int text_len, int fs, bool kern, struct te_obj *out_te)
+/* Sets the size of the face, and of its harfbuzz font to fs */
+static void te_set_size(FT_Face ftface, hb_font_t *hfont, int fs)
 {
-    FT_Face ftface = NULL;
-    hb_buffer_t *hbuf = NULL;
-    hb_font_t *hfont = NULL;
-    hb_feature_t features[8] = {0};
-    int feat_idx = 0;
     int err;
 
-    // https://github.com/libass/libass/blob/master/libass/ass_render.c#L2039
-    //double fs = 256.0;
-    //double fs_mul = o_fs / fs;
-    //printf("Glyph scale: %f\n", fs_mul);
-
-    ftface = font_get_face(fontpath);
-    assert(ftface);
-
-    hbuf = hb_buffer_create();
-    assert(hbuf);
-
     set_font_metrics(ftface);
 
     FT_Size_RequestRec rq = {
@@ -66,14 +55,366 @@ void te_create_obj(const char *fontpath, const char *text, int text_len, int fs,
     err = FT_Request_Size(ftface, &rq);
     assert(!err);
 
-    hfont = hb_ft_font_create_referenced(ftface);
-    assert(hfont);
+    hb_ft_font_changed(hfont);
     //hb_ft_font_set_funcs(hfont);
     //hb_face_set_upem(hb_font_get_face(hfont), ftface->units_per_EM);
     hb_font_set_scale(hfont, 
             ((uint64_t)ftface->size->metrics.x_scale * (uint64_t)ftface->units_per_EM) >> 16,
             ((uint64_t)ftface->size->metrics.y_scale * (uint64_t)ftface->units_per_EM) >> 16);
     hb_font_set_ppem(hfont, ftface->size->metrics.x_ppem, ftface->size->metrics.y_ppem);
+}
+
+/*
+ * Without kerning, a run of text with no marks, joiners or such, whose glyphs are not
+ * touched by any lookup of the font that harfbuzz would apply, is shaped into one glyph
+ * per codepoint with its nominal advance. Those runs are measured from a table of the
+ * advances of the BMP, kept per font and size, instead of shaping them.
+ */
+
+#define TE_MAX_FONTS 32
+#define TE_MAX_SIZES 16
+/* In the advance table, the codepoints that have to be shaped */
+#define TE_ADV_SHAPE INT32_MIN
+
+/* The features harfbuzz enables for horizontal text with the default shaper,
+ * without the ones turned off in te_create_obj() */
+static const hb_tag_t te_shaper_features[] = {
+    HB_TAG('a', 'b', 'v', 'm'), HB_TAG('b', 'l', 'w', 'm'), HB_TAG('c', 'c', 'm', 'p'),
+    HB_TAG('l', 'o', 'c', 'l'), HB_TAG('m', 'a', 'r', 'k'), HB_TAG('m', 'k', 'm', 'k'),
+    HB_TAG('r', 'l', 'i', 'g'), HB_TAG('c', 'a', 'l', 't'), HB_TAG('c', 'u', 'r', 's'),
+    HB_TAG('d', 'i', 's', 't'), HB_TAG('r', 'c', 'l', 't'), HB_TAG('r', 'v', 'r', 'n'),
+    HB_TAG('l', 't', 'r', 'a'), HB_TAG('l', 't', 'r', 'm'), HB_TAG('r', 'a', 'n', 'd'),
+    HB_TAG_NONE,
+};
+
+/* The advances of a font at one size, in 1/64 pixels. Filled 256 codepoints at a time */
+struct te_advtab {
+    int fs;
+    FT_Face face;
+    hb_font_t *hfont;
+    const hb_set_t *shaped;
+    int32_t *pages[256]; /* free */
+};
+
+struct te_font {
+    FT_Face face;
+    /* The glyphs that a lookup may apply to, or be the context of. NULL if the font
+     * has AAT tables, then everything is shaped */
+    hb_set_t *shaped;
+    struct te_advtab *tabs[TE_MAX_SIZES]; /* free */
+    int tabs_count;
+};
+/* The faces are per thread, so are these */
+static _Thread_local struct te_font te_fonts[TE_MAX_FONTS];
+static _Thread_local int te_fonts_count = 0;
+
+void te_thread_dinit()
+{
+    for (int i = 0; i < te_fonts_count; i++) {
+        for (int j = 0; j < te_fonts[i].tabs_count; j++) {
+            for (int k = 0; k < ARRSIZE(te_fonts[i].tabs[j]->pages); k++)
+                free(te_fonts[i].tabs[j]->pages[k]);
+            free(te_fonts[i].tabs[j]);
+        }
+        hb_set_destroy(te_fonts[i].shaped);
+    }
+    te_fonts_count = 0;
+}
+
+static hb_set_t *te_collect_shaped(hb_font_t *hfont)
+{
+    static const hb_tag_t tables[] = { HB_OT_TAG_GSUB, HB_OT_TAG_GPOS };
+    hb_face_t *face = hb_font_get_face(hfont);
+    hb_set_t *shaped, *lookups;
+
+    if (hb_aat_layout_has_substitution(face) || hb_aat_layout_has_positioning(face) ||
+            hb_aat_layout_has_tracking(face))
+        return NULL;
+
+    shaped = hb_set_create();
+    lookups = hb_set_create();
+    for (int i = 0; i < ARRSIZE(tables); i++) {
+        hb_codepoint_t idx = HB_SET_VALUE_INVALID;
+
+        hb_set_clear(lookups);
+        /* Of every script and language, so it is more than what is applied */
+        hb_ot_layout_collect_lookups(face, tables[i], NULL, NULL, te_shaper_features, lookups);
+        while (hb_set_next(lookups, &idx))
+            hb_ot_layout_lookup_collect_glyphs(face, tables[i], idx, shaped, shaped, shaped, NULL);
+    }
+    hb_set_destroy(lookups);
+    return shaped;
+}
+
+/* Returns the advance table of the font at fs, or NULL if it cannot be used */
+static struct te_advtab *te_get_advtab(const char *fontpath, int fs)
+{
+    FT_Face ftface = font_get_face(fontpath);
+    struct te_font *tf = NULL;
+    struct te_advtab *tab;
+
+    assert(ftface);
+    for (int i = 0; i < te_fonts_count; i++) {
+        if (te_fonts[i].face == ftface) {
+            tf = &te_fonts[i];
+            break;
+        }
+    }
+    if (tf == NULL) {
+        if (te_fonts_count == ARRSIZE(te_fonts))
+            return NULL;
+        tf = &te_fonts[te_fonts_count++];
+        *tf = (struct te_font){
+            .face = ftface,
+            .shaped = te_collect_shaped(font_get_hb_font(fontpath)),
+        };
+    }
+    if (tf->shaped == NULL)
+        return NULL;
+
+    for (int i = 0; i < tf->tabs_count; i++) {
+        if (tf->tabs[i]->fs == fs)
+            return tf->tabs[i];
+    }
+    if (tf->tabs_count == ARRSIZE(tf->tabs))
+        return NULL;
+    tab = calloc(1, sizeof(*tab));
+    assert(tab);
+    tab->fs = fs;
+    tab->face = ftface;
+    tab->hfont = font_get_hb_font(fontpath);
+    tab->shaped = tf->shaped;
+    tf->tabs[tf->tabs_count++] = tab;
+    return tab;
+}
+
+/* The codepoints that harfbuzz maps to their glyph as they are, if it has one.
+ * No marks, default ignorables, spaces it may fake, or the fraction slash */
+static bool te_cp_is_plain(uint32_t cp)
+{
+    return (cp >= 0x20 && cp <= 0x7E) ||
+        (cp >= 0xA0 && cp <= 0xFF && cp != 0xAD) ||
+        (cp >= 0x2010 && cp <= 0x2027) ||
+        (cp >= 0x2030 && cp <= 0x205E && cp != 0x2044) ||
+        (cp >= 0x3000 && cp <= 0x30FF && !(cp >= 0x302A && cp <= 0x302F) && cp != 0x3099 && cp != 0x309A) ||
+        (cp >= 0x3400 && cp <= 0x4DBF) ||
+        (cp >= 0x4E00 && cp <= 0x9FFF) ||
+        (cp >= 0xFF01 && cp <= 0xFFEF);
+}
+
+static int32_t *te_fill_page(struct te_advtab *tab, int page)
+{
+    int32_t *advs = malloc(256 * sizeof(*advs));
+    assert(advs);
+
+    te_set_size(tab->face, tab->hfont, tab->fs);
+    for (int i = 0; i < 256; i++) {
+        uint32_t cp = (page << 8) | i;
+        hb_codepoint_t glyph;
+
+        if (!te_cp_is_plain(cp) || !hb_font_get_nominal_glyph(tab->hfont, cp, &glyph) ||
+                hb_set_has(tab->shaped, glyph))
+            advs[i] = TE_ADV_SHAPE;
+        else
+            advs[i] = hb_font_get_glyph_h_advance(tab->hfont, glyph);
+    }
+    tab->pages[page] = advs;
+    return advs;
+}
+
+static inline int32_t te_advance(struct te_advtab *tab, uint32_t cp)
+{
+    int32_t *page;
+
+    if (cp > 0xFFFF)
+        return TE_ADV_SHAPE;
+    page = tab->pages[cp >> 8];
+    if (page == NULL)
+        page = te_fill_page(tab, cp >> 8);
+    return page[cp & 0xFF];
+}
+
+/* Decodes the character at s, and returns its length, or 0 if it is not
+ * valid, or not in the BMP. Stops at a null, as it is not a continuation byte */
+static int te_utf8_decode(const char *str, int len, uint32_t *out_cp)
+{
+    const unsigned char *s = (const unsigned char*)str;
+
+    if (s[0] < 0x80) {
+        *out_cp = s[0];
+        return 1;
+    }
+    if (s[0] >= 0xC2 && s[0] <= 0xDF && len >= 2 && (s[1] & 0xC0) == 0x80) {
+        *out_cp = ((s[0] & 0x1F) << 6) | (s[1] & 0x3F);
+        return 2;
+    }
+    if ((s[0] & 0xF0) == 0xE0 && len >= 3 && (s[1] & 0xC0) == 0x80 && (s[2] & 0xC0) == 0x80) {
+        *out_cp = ((s[0] & 0x0F) << 12) | ((s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+        /* Overlong, or a surrogate */
+        if (*out_cp < 0x800 || (*out_cp >= 0xD800 && *out_cp <= 0xDFFF))
+            return 0;
+        return 3;
+    }
+    return 0;
+}
+
+typedef int32_t te_v4si __attribute__((vector_size(16)));
+
+static int te_sum_advances(int n, const int32_t adv[n])
+{
+    te_v4si acc = {0}, v;
+    int i = 0, sum;
+
+    for (; i + 4 <= n; i += 4) {
+        memcpy(&v, &adv[i], sizeof(v));
+        acc += v;
+    }
+    sum = acc[0] + acc[1] + acc[2] + acc[3];
+    for (; i < n; i++)
+        sum += adv[i];
+    return sum;
+}
+
+/* Adds the advances, and the spacing after each to width, the same way te_get_at() does */
+static int te_add_advances(int width, int n, const int32_t adv[n], double spacing64)
+{
+    if (spacing64 == (int)spacing64)
+        return width + te_sum_advances(n, adv) + n * (int)spacing64;
+    for (int i = 0; i < n; i++)
+        width += adv[i] + spacing64;
+    return width;
+}
+
+/* The glyphs of the text from the advance table. Returns false if it has to be shaped */
+static bool te_create_obj_fast(const char *fontpath, const char *text, int text_len, int fs, struct te_obj *out_te)
+{
+    struct te_advtab *tab = te_get_advtab(fontpath, fs);
+    struct gcache_glyph *glyphs;
+    int count = 0;
+
+    if (tab == NULL)
+        return false;
+    glyphs = malloc(text_len * sizeof(*glyphs) + 1);
+    assert(glyphs);
+    for (int off = 0; off < text_len;) {
+        uint32_t cp;
+        int n = te_utf8_decode(&text[off], text_len - off, &cp);
+        int32_t adv = n ? te_advance(tab, cp) : TE_ADV_SHAPE;
+
+        if (adv == TE_ADV_SHAPE) {
+            free(glyphs);
+            return false;
+        }
+        glyphs[count++] = (struct gcache_glyph){
+            .cluster = off,
+            .x_advance = adv,
+        };
+        off += n;
+    }
+    out_te->glyphs = glyphs;
+    out_te->glyph_count = count;
+    return true;
+}
+
+/* Same as te_simple(), from the advance table. Returns false if it has to be shaped */
+static bool te_simple_fast(const char *fontpath, const char *text, int fs, float spacing, struct text_extents *out_ext)
+{
+    struct te_advtab *tab = te_get_advtab(fontpath, fs);
+    int32_t advs[64];
+    double spacing64 = spacing * 64;
+    int width = 0, n = 0, count = 0;
+
+    if (tab == NULL)
+        return false;
+    for (const char *s = text; *s;) {
+        uint32_t cp;
+        int len = te_utf8_decode(s, 3, &cp);
+        int32_t adv = len ? te_advance(tab, cp) : TE_ADV_SHAPE;
+
+        if (adv == TE_ADV_SHAPE)
+            return false;
+        advs[n++] = adv;
+        if (n == ARRSIZE(advs)) {
+            width = te_add_advances(width, n, advs, spacing64);
+            count += n;
+            n = 0;
+        }
+        s += len;
+    }
+    width = te_add_advances(width, n, advs, spacing64);
+    count += n;
+    /* An empty text is left to te_get_at() */
+    if (count == 0)
+        return false;
+
+    memset(out_ext, 0, sizeof(*out_ext));
+    out_ext->width = (width / 64.0f);
+    out_ext->height = fs;
+    return true;
+}
+
+/* Indexes the glyphs by byte offset, and sums up their advances, so finding and measuring
+ * any part of the text is a few lookups, instead of going through every glyph */
+static void te_build_index(struct te_obj *te, int text_len)
+{
+    const struct gcache_glyph *glyphs = te->glyphs;
+    int gc = te->glyph_count;
+
+    te->adv_sums = malloc((gc + 1) * sizeof(*te->adv_sums));
+    assert(te->adv_sums);
+    te->adv_sums[0] = 0;
+    for (int i = 0; i < gc; i++)
+        te->adv_sums[i + 1] = te->adv_sums[i] + glyphs[i].x_advance;
+
+    te->text_len = text_len;
+    for (int i = 0; i < gc; i++) {
+        if (glyphs[i].cluster > text_len || (i > 0 && glyphs[i].cluster < glyphs[i - 1].cluster))
+            return;
+    }
+    te->glyph_at = malloc((text_len + 1) * sizeof(*te->glyph_at));
+    assert(te->glyph_at);
+    for (int off = 0, i = 0; off <= text_len; off++) {
+        while (i < gc && glyphs[i].cluster < off)
+            i++;
+        te->glyph_at[off] = i;
+    }
+}
+
+void te_create_obj(const char *fontpath, const char *text, int text_len, int fs, bool kern, struct te_obj *out_te)
+{
+    FT_Face ftface = NULL;
+    hb_buffer_t *hbuf = NULL;
+    hb_font_t *hfont = NULL;
+    hb_feature_t features[8] = {0};
+    int feat_idx = 0;
+
+    if (text_len == -1)
+        text_len = strlen(text);
+    *out_te = (struct te_obj){
+        .fs = fs,
+        .fs_mul = 1,
+    };
+    if (!kern && te_create_obj_fast(fontpath, text, text_len, fs, out_te))
+        goto index;
+    out_te->glyphs = gcache_get(fontpath, text, text_len, fs, kern, &out_te->glyph_count);
+    if (out_te->glyphs)
+        goto index;
+
+    // https://github.com/libass/libass/blob/master/libass/ass_render.c#L2039
+    //double fs = 256.0;
+    //double fs_mul = o_fs / fs;
+    //printf("Glyph scale: %f\n", fs_mul);
+
+    /* Both of these belong to this thread, so they can be resized without locking */
+    ftface = font_get_face(fontpath);
+    assert(ftface);
+    hfont = hb_font_reference(font_get_hb_font(fontpath));
+    assert(hfont);
+
+    hbuf = hb_buffer_create();
+    assert(hbuf);
+
+    te_set_size(ftface, hfont, fs);
 
     hb_buffer_set_direction(hbuf, HB_DIRECTION_LTR);
     hb_buffer_set_script(hbuf, hb_script_from_string("Jpan", -1));
@@ -107,21 +448,36 @@ void te_create_obj(const char *fontpath, const char *text, int text_len, int fs,
     hb_buffer_add_utf8(hbuf, text, text_len, 0, text_len);
     hb_shape(hfont, hbuf, features, feat_idx);
 
-    *out_te = (struct te_obj){
-        .hbuf = hbuf,
-        .hfont = hfont,
-        .fs = fs,
-        .fs_mul = 1,
-    };
+    /* Only the clusters and the advances are used, so the buffer is not kept */
+    unsigned int gc;
+    hb_glyph_info_t *gi     = hb_buffer_get_glyph_infos(hbuf, &gc);
+    hb_glyph_position_t *gp = hb_buffer_get_glyph_positions(hbuf, &gc);
+    out_te->glyphs = malloc(gc * sizeof(*out_te->glyphs) + 1);
+    assert(out_te->glyphs);
+    for (unsigned int i = 0; i < gc; i++) {
+        out_te->glyphs[i] = (struct gcache_glyph){
+            .cluster = gi[i].cluster,
+            .x_advance = gp[i].x_advance,
+        };
+    }
+    out_te->glyph_count = gc;
+    gcache_put(fontpath, text, text_len, fs, kern, out_te->glyphs, gc);
+
+    hb_buffer_destroy(hbuf);
+    hb_font_destroy(hfont);
+
+index:
+    te_build_index(out_te, text_len);
 }
 
 void te_destroy_obj(struct te_obj *te)
 {
-    hb_buffer_destroy(te->hbuf);
-    hb_font_destroy(te->hfont);
+    free(te->glyphs);
+    free(te->glyph_at);
+    free(te->adv_sums);
 }
 
-static void find_cluster_indexes(unsigned int gcount, hb_glyph_info_t gi[gcount],
+static void find_cluster_indexes(unsigned int gcount, const struct gcache_glyph gi[gcount],
         int offset, int len, int *out_first_idx, int *out_last_idx)
 {
     int cluster_start = -1, cluster_end = -1;
@@ -155,41 +511,69 @@ static void find_cluster_indexes(unsigned int gcount, hb_glyph_info_t gi[gcount]
     *out_last_idx = cluster_end;
 }
 
+/* Same as find_cluster_indexes(), from the index */
+static void te_find_glyphs(const struct te_obj *te, int offset, int len, int *out_first_idx, int *out_last_idx)
+{
+    int first, last;
+
+    if (te->glyph_at == NULL || offset < 0 || offset > te->text_len || (len != -1 && len <= 0)) {
+        find_cluster_indexes(te->glyph_count, te->glyphs, offset, len, out_first_idx, out_last_idx);
+        return;
+    }
+
+    /* The glyphs of the cluster at offset. The first one if the rest of the text is
+     * asked for, otherwise the last one */
+    first = te->glyph_at[offset];
+    last = (offset < te->text_len ? te->glyph_at[offset + 1] : te->glyph_count) - 1;
+    assert(first <= last && te->glyphs[first].cluster == offset);
+    *out_first_idx = len == -1 ? first : last;
+
+    /* Up to the glyph before the one at offset + len, or the end of the text */
+    if (len == -1 || offset + len > te->text_len || te->glyph_at[offset + len] == te->glyph_count)
+        *out_last_idx = te->glyph_count - 1;
+    else
+        *out_last_idx = te->glyph_at[offset + len] - 1;
+}
+
 void te_get_at(struct te_obj *te, int offset, int len, float spacing, struct text_extents *out_ext)
 {
     memset(out_ext, 0, sizeof(*out_ext));
 
-    unsigned int glyph_count;
     int cluster_start, cluster_end;
-    hb_glyph_info_t *glyph_info    = hb_buffer_get_glyph_infos(te->hbuf, &glyph_count);
-    hb_glyph_position_t *glyph_pos = hb_buffer_get_glyph_positions(te->hbuf, &glyph_count);
+    const struct gcache_glyph *glyphs = te->glyphs;
+    double spacing64 = spacing * 64;
 
-    find_cluster_indexes(glyph_count, glyph_info, offset, len, &cluster_start, &cluster_end);
+    te_find_glyphs(te, offset, len, &cluster_start, &cluster_end);
 
-    FT_Face ftf = hb_ft_font_get_face(te->hfont);
     int width = 0, height = 0;
-    for (int i = cluster_start; i <= cluster_end; i++) {
-        width += (glyph_pos[i].x_advance * te->fs_mul) + (spacing * 64);
+    if (te->fs_mul == 1 && spacing64 == (int)spacing64 && cluster_start <= cluster_end) {
+        /* Only whole numbers are added, so it is the same as adding them one by one */
+        width = te->adv_sums[cluster_end + 1] - te->adv_sums[cluster_start] +
+            (cluster_end - cluster_start + 1) * (int)spacing64;
+    } else {
+        for (int i = cluster_start; i <= cluster_end; i++) {
+            width += (glyphs[i].x_advance * te->fs_mul) + (spacing * 64);
 #if 0
-        printf("Offset x: %d  y: %d\n", glyph_pos[i].x_offset, glyph_pos[i].y_offset);
-        int r = FT_Load_Glyph(ftf, glyph_info[i].codepoint, 0);
-        assert(r == 0);
-        r = FT_Render_Glyph(ftf->glyph, 0);
-        assert(r == 0);
-        FT_Bitmap *bmpo = &ftf->glyph->bitmap;
-        //FT_Bitmap bmp;
-        //FT_Bitmap_Init(&bmp);
-        //r = FT_Bitmap_Convert(font_get_lib(), bmpo, &bmp, 4);
-        //assert(r == 0);
-
-        //BP;
-        FILE* f = fopen("./img.bin", "wb");
-        fwrite(bmpo->buffer, 1, bmpo->rows * bmpo->width, f);
-        printf("img w: %d  h: %d\n", bmpo->width, bmpo->rows);
-        fclose(f);
-
-        //FT_Bitmap_Done(font_get_lib(), &bmp);
+            printf("Offset x: %d  y: %d\n", glyph_pos[i].x_offset, glyph_pos[i].y_offset);
+            int r = FT_Load_Glyph(ftf, glyph_info[i].codepoint, 0);
+            assert(r == 0);
+            r = FT_Render_Glyph(ftf->glyph, 0);
+            assert(r == 0);
+            FT_Bitmap *bmpo = &ftf->glyph->bitmap;
+            //FT_Bitmap bmp;
+            //FT_Bitmap_Init(&bmp);
+            //r = FT_Bitmap_Convert(font_get_lib(), bmpo, &bmp, 4);
+            //assert(r == 0);
+
+            //BP;
+            FILE* f = fopen("./img.bin", "wb");
+            fwrite(bmpo->buffer, 1, bmpo->rows * bmpo->width, f);
+            printf("img w: %d  h: %d\n", bmpo->width, bmpo->rows);
+            fclose(f);
+
+            //FT_Bitmap_Done(font_get_lib(), &bmp);
 #endif
+        }
     }
 
     out_ext->width = (width / 64.0f);
@@ -199,11 +583,10 @@ void te_get_at(struct te_obj *te, int offset, int len, float spacing, struct tex
 void te_get_at_chars(struct te_obj *te, int offset, int len,
         int out_ext_size, struct text_extents out_ext[out_ext_size], int *out_ext_count)
 {
-    int cluster_start, cluster_end, gc;
-    hb_glyph_info_t *gi     = hb_buffer_get_glyph_infos(te->hbuf, &gc);
-    hb_glyph_position_t *gp = hb_buffer_get_glyph_positions(te->hbuf, &gc);
+    int cluster_start, cluster_end;
+    const struct gcache_glyph *glyphs = te->glyphs;
 
-    find_cluster_indexes(gc, gi, offset, len, &cluster_start, &cluster_end);
+    te_find_glyphs(te, offset, len, &cluster_start, &cluster_end);
 
     *out_ext_count = 0;
     for (int i = cluster_start; i <= cluster_end; i++) {
@@ -211,7 +594,7 @@ void te_get_at_chars(struct te_obj *te, int offset, int len,
         struct text_extents *curr_ext = &out_ext[*out_ext_count];
 
         *curr_ext = (struct text_extents){
-            .width = gp[i].x_advance / 64,
+            .width = glyphs[i].x_advance / 64,
             .height = te->fs,
         };
         (*out_ext_count)++;
@@ -250,6 +633,9 @@ void te_get_at_chars_justify(struct te_obj *te, int offset, int len, int target_
 void te_simple(const char *fontpath, const char *text, int fs, float spacing, bool kern, struct text_extents *out_ext)
 {
     struct te_obj te;
+
+    if (!kern && te_simple_fast(fontpath, text, fs, spacing, out_ext))
+        return;
     te_create_obj(fontpath, text, -1, fs, kern, &te);
     te_get_at(&te, 0, -1, spacing, out_ext);
     te_destroy_obj(&te);
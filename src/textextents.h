@@ -2,14 +2,23 @@
 #define _VTT2ASS_TEXTEXTENTS_H
 #include "util.h"
 #include "font.h"
+#include "glyphcache.h"
 #include <hb.h>
 
 struct te_obj {
     //FT_Face ftface;
-    hb_buffer_t *hbuf;
-    hb_font_t *hfont;
+    /* The shaped glyphs, from the glyph cache or from harfbuzz. free */
+    struct gcache_glyph *glyphs;
+    int glyph_count;
     int fs;
 
+    /* For each byte offset of the text, and the end of it, the first glyph at or after it.
+     * NULL if the clusters are not in order, then the glyphs are searched. free */
+    int *glyph_at;
+    int text_len;
+    /* The sum of the advances before each glyph, and of every advance at [glyph_count]. free */
+    int *adv_sums;
+
     double fs_mul;
 };
 
@@ -23,6 +32,10 @@ void te_get_at_chars(struct te_obj *te, int offset, int len,
 void te_get_at_chars_justify(struct te_obj *te, int offset, int len, int target_justify,
         int out_ext_size, struct text_extents out_ext[out_ext_size], int *out_ext_count);
 
+/* Frees the advance tables of the calling thread. Every thread that measured text
+ * has to call this before exiting */
+void te_thread_dinit();
+
 void te_simple(const char *fontpath, const char *text, int fs, float spacing, bool kern, struct text_extents *out_ext);
 #if 0
 void te_simple_justify_chars(const char *fontpath, const char *text, int fs, int target_justify,
@@ -0,0 +1,235 @@
+#include "thpool.h"
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <assert.h>
+#include <pthread.h>
+#include <unistd.h>
+
+/* The part of the index space that is owned by a worker.
+ * The owner takes from the front, thiefs take from the back.
+ * begin and end are only changed with the lock held, but thiefs
+ * peek at them without it */
+struct thp_range {
+    pthread_mutex_t lock;
+    int64_t begin, end;
+};
+
+#define LOAD(x) __atomic_load_n(&(x), __ATOMIC_RELAXED)
+#define STORE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELAXED)
+
+struct thp_pool {
+    int nthreads;
+    int started; /* Threads actually running, worker 0 included */
+    pthread_t *threads; /* free */
+    struct thp_worker *workers; /* free */
+    struct thp_range *ranges; /* free */
+    thp_exit_fn exit_fn;
+    void *exit_arg;
+
+    /* The current run, set before gen is increased */
+    thp_task_fn fn;
+    void *arg;
+
+    /* Only used with lock held */
+    pthread_mutex_t lock;
+    pthread_cond_t work_cond, done_cond;
+    uint64_t gen; /* Increased for every run */
+    int busy; /* Started threads that did not finish the current run yet */
+    bool quit;
+};
+
+struct thp_worker {
+    struct thp_pool *pool;
+    int idx;
+};
+
+int thp_cpu_count(void)
+{
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n < 1)
+        return 1;
+    return n;
+}
+
+static bool thp_take(struct thp_range *r, int64_t *out_idx)
+{
+    bool have = false;
+
+    pthread_mutex_lock(&r->lock);
+    if (r->begin < r->end) {
+        *out_idx = r->begin;
+        STORE(r->begin, r->begin + 1);
+        have = true;
+    }
+    pthread_mutex_unlock(&r->lock);
+    return have;
+}
+
+/* Moves the back half of the largest range into our own range
+ * Returns false if there is nothing left to steal */
+static bool thp_steal(struct thp_pool *pool, int self)
+{
+    for (;;) {
+        int victim = -1;
+        int64_t victim_left = 0;
+
+        /* Unlocked peek, only used to pick a victim, checked again under the lock */
+        for (int i = 0; i < pool->nthreads; i++) {
+            int64_t left = LOAD(pool->ranges[i].end) - LOAD(pool->ranges[i].begin);
+            if (i != self && left > victim_left) {
+                victim = i;
+                victim_left = left;
+            }
+        }
+        if (victim == -1)
+            return false;
+
+        struct thp_range *vr = &pool->ranges[victim];
+        int64_t sbegin, send;
+        pthread_mutex_lock(&vr->lock);
+        if (vr->begin >= vr->end) {
+            /* Got emptied while we were looking, try again */
+            pthread_mutex_unlock(&vr->lock);
+            continue;
+        }
+        send = vr->end;
+        sbegin = vr->begin + (vr->end - vr->begin) / 2;
+        STORE(vr->end, sbegin);
+        pthread_mutex_unlock(&vr->lock);
+
+        struct thp_range *sr = &pool->ranges[self];
+        pthread_mutex_lock(&sr->lock);
+        STORE(sr->begin, sbegin);
+        STORE(sr->end, send);
+        pthread_mutex_unlock(&sr->lock);
+        return true;
+    }
+}
+
+/* Does the work of the current run, until there is nothing left to steal */
+static void thp_work(struct thp_pool *pool, int self)
+{
+    int64_t idx;
+
+    do {
+        while (thp_take(&pool->ranges[self], &idx))
+            pool->fn(pool->arg, self, idx);
+    } while (thp_steal(pool, self));
+}
+
+static void *thp_worker_main(void *data)
+{
+    struct thp_worker *w = data;
+    struct thp_pool *pool = w->pool;
+    uint64_t seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (pool->gen == seen && !pool->quit)
+            pthread_cond_wait(&pool->work_cond, &pool->lock);
+        if (pool->quit)
+            break;
+        seen = pool->gen;
+        pthread_mutex_unlock(&pool->lock);
+
+        thp_work(pool, w->idx);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->busy == 0)
+            pthread_cond_signal(&pool->done_cond);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    if (pool->exit_fn)
+        pool->exit_fn(pool->exit_arg, w->idx);
+    return NULL;
+}
+
+struct thp_pool *thp_create(int nthreads, thp_exit_fn exit_fn, void *exit_arg)
+{
+    struct thp_pool *pool;
+
+    if (nthreads < 1)
+        nthreads = 1;
+
+    pool = calloc(1, sizeof(*pool));
+    assert(pool);
+    pool->nthreads = nthreads;
+    pool->started = 1;
+    pool->exit_fn = exit_fn;
+    pool->exit_arg = exit_arg;
+    pool->threads = calloc(nthreads, sizeof(*pool->threads));
+    pool->workers = calloc(nthreads, sizeof(*pool->workers));
+    pool->ranges = calloc(nthreads, sizeof(*pool->ranges));
+    assert(pool->threads && pool->workers && pool->ranges);
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_cond, NULL);
+    pthread_cond_init(&pool->done_cond, NULL);
+
+    for (int i = 0; i < nthreads; i++) {
+        pthread_mutex_init(&pool->ranges[i].lock, NULL);
+        pool->workers[i] = (struct thp_worker){ .pool = pool, .idx = i };
+    }
+
+    for (int i = 1; i < nthreads; i++) {
+        if (pthread_create(&pool->threads[i], NULL, thp_worker_main, &pool->workers[i]) != 0) {
+            /* The started workers will steal the ranges of the rest */
+            fprintf(stderr, "[Warning] Failed to start worker thread %d\n", i);
+            break;
+        }
+        pool->started++;
+    }
+    return pool;
+}
+
+void thp_destroy(struct thp_pool *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = true;
+    pthread_cond_broadcast(&pool->work_cond);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 1; i < pool->started; i++)
+        pthread_join(pool->threads[i], NULL);
+    for (int i = 0; i < pool->nthreads; i++)
+        pthread_mutex_destroy(&pool->ranges[i].lock);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->work_cond);
+    pthread_cond_destroy(&pool->done_cond);
+    free(pool->threads);
+    free(pool->workers);
+    free(pool->ranges);
+    free(pool);
+}
+
+int thp_run(struct thp_pool *pool, int64_t count, thp_task_fn fn, void *arg)
+{
+    int nthreads = pool->nthreads;
+
+    /* The threads are waiting, so the ranges can be set without their locks.
+     * Taking pool->lock below publishes them */
+    for (int i = 0; i < nthreads; i++) {
+        pool->ranges[i].begin = count * i / nthreads;
+        pool->ranges[i].end = count * (i + 1) / nthreads;
+    }
+    pool->fn = fn;
+    pool->arg = arg;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->gen++;
+    pool->busy = pool->started - 1;
+    pthread_cond_broadcast(&pool->work_cond);
+    pthread_mutex_unlock(&pool->lock);
+
+    /* The calling thread is worker 0 */
+    thp_work(pool, 0);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->busy > 0)
+        pthread_cond_wait(&pool->done_cond, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+
+    return 0;
+}
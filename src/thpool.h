@@ -0,0 +1,29 @@
+#ifndef _VTT2ASS_THPOOL_H
+#define _VTT2ASS_THPOOL_H
+#include <stdint.h>
+
+/* Called once for every index, worker is the index of the calling thread
+ * in [0, nthreads), the calling thread of thp_run() is worker 0 */
+typedef void(*thp_task_fn)(void *arg, int worker, int64_t idx);
+/* Called on each started thread (so not on worker 0) when the pool is destroyed */
+typedef void(*thp_exit_fn)(void *arg, int worker);
+
+struct thp_pool;
+
+/* Returns the number of online cpus, at least 1 */
+int thp_cpu_count(void);
+
+/* Starts nthreads - 1 threads, that wait for work until thp_destroy().
+ * If some threads cannot be started, the rest do their work.
+ * exit_fn can be NULL */
+struct thp_pool *thp_create(int nthreads, thp_exit_fn exit_fn, void *exit_arg);
+/* Stops and joins the threads, which call exit_fn before exiting */
+void thp_destroy(struct thp_pool *pool);
+
+/* Calls fn for every index in [0, count) on the threads of the pool.
+ * The indexes are split into one contiguous range per worker, a worker
+ * that runs out of work steals the back half of the largest remaining range.
+ * Returns 0 when all of the indexes are done */
+int thp_run(struct thp_pool *pool, int64_t count, thp_task_fn fn, void *arg);
+
+#endif /* _VTT2ASS_THPOOL_H */
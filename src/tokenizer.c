@@ -18,9 +18,8 @@ static const char *token_str_map[] = {
 
 static int64_t tok_cline = 1;
 
-static void tok_free_inner(void *data)
+static void tok_free_inner(struct token *tok)
 {
-    struct token *tok = data;
     switch (tok->type) {
     case TOK_IDENT:
         free(tok->ident.str);
@@ -42,7 +41,7 @@ static void tok_free_inner(void *data)
     }
 }
 
-static int tok_read_magic(struct dyna *tokens)
+static int tok_read_magic(struct token_vec *tokens)
 {
     char buf[16] = {0};
     const char *exp = "WEBVTT";
@@ -59,7 +58,7 @@ static int tok_read_magic(struct dyna *tokens)
         return -1;
     }
 
-    ((struct token*)dyna_emplace(tokens))->type = TOK_FILE_MAGIC;
+    token_vec_emplace(tokens)->type = TOK_FILE_MAGIC;
     rdr_skip(lineskip);
 
     return 0;
@@ -87,7 +86,7 @@ static void tok_skip_line()
     }
 }
 
-static int tok_parse_note(struct dyna *tokens, int64_t li, char line[li])
+static int tok_parse_note(struct token_vec *tokens, int64_t li, char line[li])
 {
     char rl[1024];
     int64_t lineskip, rli;
@@ -99,11 +98,11 @@ static int tok_parse_note(struct dyna *tokens, int64_t li, char line[li])
     }
     rdr_skip_line();
 
-    ((struct token*)dyna_emplace(tokens))->type = TOK_NOTE;
+    token_vec_emplace(tokens)->type = TOK_NOTE;
     return 0;
 }
 
-static int tok_parse_timestamp(struct dyna *tokens, int64_t li, char line[li])
+static int tok_parse_timestamp(struct token_vec *tokens, int64_t li, char line[li])
 {
     int8_t hour, min, sec;
     int64_t ms;
@@ -122,12 +121,12 @@ static int tok_parse_timestamp(struct dyna *tokens, int64_t li, char line[li])
     ms += ((sec + ((min + hour * 60) * 60)) * 1000);
 
     struct token tok = { .type = TOK_TIMESTAMP, .timestamp.ms = ms };
-    dyna_append(tokens, &tok);
+    token_vec_append(tokens, &tok);
 
     return consumed;
 }
 
-static int tok_parse_style_group(struct dyna *tokens)
+static int tok_parse_style_group(struct token_vec *tokens)
 {
     int64_t bi = 0;
     char *pos;
@@ -145,7 +144,7 @@ static int tok_parse_style_group(struct dyna *tokens)
 
     struct token tok = { .type = TOK_STYLE_SELECTOR };
     tok.style_selector.str = strndup(buff, bi);
-    dyna_append(tokens, &tok);
+    token_vec_append(tokens, &tok);
 
     rdr_skip_whitespace();
     c = rdr_getc();
@@ -154,7 +153,7 @@ static int tok_parse_style_group(struct dyna *tokens)
         return -1;
     }
     tok.type = TOK_STYLE_OPEN_BRACE;
-    dyna_append(tokens, &tok);
+    token_vec_append(tokens, &tok);
 
     rdr_skip_whitespace();
     bi = 0;
@@ -189,7 +188,7 @@ static int tok_parse_style_group(struct dyna *tokens)
                 return -1;
             }
             tok.style_keyval.value = strndup(buff, bi);
-            dyna_append(tokens, &tok);
+            token_vec_append(tokens, &tok);
             in_elem = have_key = have_value = false;
             bi = 0;
             rdr_skip_whitespace();
@@ -197,6 +196,13 @@ static int tok_parse_style_group(struct dyna *tokens)
             buff[bi++] = (char)c;
         }
     }
+    if (have_key) {
+        /* The last declaration can be without a ';' */
+        while (bi > 0 && isspace((unsigned char)buff[bi - 1]))
+            bi--;
+        tok.style_keyval.value = strndup(buff, bi);
+        token_vec_append(tokens, &tok);
+    }
     if (rdr_peek() == EOF) {
         fprintf(stderr, "Style parse error: End of file inside block\n");
         return -1;
@@ -204,12 +210,12 @@ static int tok_parse_style_group(struct dyna *tokens)
     rdr_skip(1); /* skip the '}' */
     rdr_skip_line(); /* Skip until the next line */
     tok.type = TOK_STYLE_CLOSE_BRACE;
-    dyna_append(tokens, &tok);
+    token_vec_append(tokens, &tok);
 
     return 0;
 }
 
-static int tok_parse_style(struct dyna *tokens)
+static int tok_parse_style(struct token_vec *tokens)
 {
     char buff[1024];
     int64_t bi;
@@ -247,7 +253,7 @@ static int tok_parse_style(struct dyna *tokens)
     return 0;
 }
 
-static int tok_parse_cue_attrib(struct dyna *tokens, int64_t li, char pos[li])
+static int tok_parse_cue_attrib(struct token_vec *tokens, int64_t li, char pos[li])
 {
     if (li == 0)
         return 0; /* no attribs */
@@ -274,13 +280,13 @@ static int tok_parse_cue_attrib(struct dyna *tokens, int64_t li, char pos[li])
         li -= sep - pos;
         pos = sep + 1;
 
-        dyna_append(tokens, &tok);
+        token_vec_append(tokens, &tok);
     }
 
     return 0;
 }
 
-static int tok_parse_cue_text(struct dyna *tokens)
+static int tok_parse_cue_text(struct token_vec *tokens)
 {
     int64_t li, lineskip;
     char line[1024];
@@ -298,14 +304,14 @@ static int tok_parse_cue_text(struct dyna *tokens)
 
         struct token tok = { .type = TOK_CUE_TEXT };
         tok.cue_text.str = strdup(line);
-        dyna_append(tokens, &tok);
+        token_vec_append(tokens, &tok);
         rdr_skip(lineskip);
     }
 
     return 0;
 }
 
-static int tok_parse_cue(struct dyna *tokens, int64_t li, char line[li])
+static int tok_parse_cue(struct token_vec *tokens, int64_t li, char line[li])
 {
     char *pos = line;
     int en;
@@ -320,7 +326,7 @@ static int tok_parse_cue(struct dyna *tokens, int64_t li, char line[li])
         pos += strlen(" --> ");
         li -= strlen(" --> ");
         struct token tok = { .type = TOK_ARROW };
-        dyna_append(tokens, &tok);
+        token_vec_append(tokens, &tok);
     } else {
         return -1;
     }
@@ -344,7 +350,7 @@ static int tok_parse_cue(struct dyna *tokens, int64_t li, char line[li])
     return 0;
 }
 
-static int tok_parse_line_ident(struct dyna *tokens, int64_t li, char line[li])
+static int tok_parse_line_ident(struct token_vec *tokens, int64_t li, char line[li])
 {
     /* line is an ident, make an TOK_IDENT and copy the line contents */
     struct token tok = { .type = TOK_IDENT };
@@ -353,7 +359,7 @@ static int tok_parse_line_ident(struct dyna *tokens, int64_t li, char line[li])
         return -1;
     tok.ident.str = ident_str;
 
-    dyna_append(tokens, &tok);
+    token_vec_append(tokens, &tok);
 
     return 0;
 }
@@ -376,25 +382,41 @@ static void tok_skip_whitespace(int64_t *li, char *line)
     *li -= prev_space;
 }
 
-struct dyna *tok_tokenize()
+struct token_vec *tok_create_tokens()
 {
-    struct dyna *tokens = dyna_create(sizeof(struct token));
-    int en, c;
+    return token_vec_create(64);
+}
+
+void tok_destroy_tokens(struct token_vec *tokens)
+{
+    for (int64_t i = 0; i < tokens->count; i++)
+        tok_free_inner(&tokens->data[i]);
+    token_vec_destroy(tokens);
+}
+
+int tok_begin(struct token_vec *tokens)
+{
+    int en;
 
-    dyna_set_free_fn(tokens, tok_free_inner);
     if (rdr_pos() != 0) {
-        goto error;
+        return -1;
     }
 
+    tok_cline = 1;
     tok_skip_bom();
 
     en = tok_read_magic(tokens);
     if (en != 0)
-        goto error;
+        return -1;
 
+    return 0;
+}
+
+int tok_tokenize_next(struct token_vec *tokens)
+{
+    int en;
     char line[1024];
     int64_t li = 0, lineskip;
-    bool in_ts_parse = false;
     while ((li = rdr_line_peek(sizeof(line), line, &lineskip)) != EOF) {
         tok_cline++;
         tok_skip_whitespace(&li, line);
@@ -422,7 +444,8 @@ struct dyna *tok_tokenize()
             en = tok_parse_cue(tokens, li, line);
             if (en == -1)
                 goto error;
-            goto next_noskip;
+            /* The cue is complete */
+            return 1;
         } else {
             en = tok_parse_line_ident(tokens, li, line);
             if (en == -1)
@@ -439,7 +462,7 @@ struct dyna *tok_tokenize()
         }
 #endif
         printf("Unknown line at linenum %ld: '%s'\n", tok_cline, line);
-        goto end;
+        return 0;
 
 next_skip:
         rdr_skip(lineskip);
@@ -448,12 +471,35 @@ next_noskip:
         continue;
     }
 
-end:
-    return tokens;
+    return 0;
 
 error:
     printf("Failed parse on line %ld: '%s'\n", tok_cline, line);
-    dyna_destroy(tokens);
+    return -1;
+}
+
+struct token_vec *tok_tokenize()
+{
+    const struct rdr_size_hints *hints = rdr_size_hints();
+    struct token_vec *tokens = tok_create_tokens();
+    int en;
+
+    /* A token for most lines, and the timing lines have 3 */
+    token_vec_reserve(tokens, hints->lines + 2 * hints->cues);
+
+    en = tok_begin(tokens);
+    if (en != 0)
+        goto error;
+
+    while ((en = tok_tokenize_next(tokens)) == 1)
+        ;
+    if (en == -1)
+        goto error;
+
+    return tokens;
+
+error:
+    tok_destroy_tokens(tokens);
     return NULL;
 }
 
@@ -1,6 +1,6 @@
 #ifndef _VTT2ASS_TOKENIZER_H
 #define _VTT2ASS_TOKENIZER_H
-#include "dyna.h"
+#include "vec.h"
 
 #define TOKEN_DEF(ex_simpl, ex_compl) \
     ex_simpl(TOK_EOF) \
@@ -36,9 +36,23 @@ struct token {
 #undef ex_simpl
 #undef ex_compl
 
+VEC_DEFINE(token_vec, struct token)
 
 /* Needs to have rdr_init() called before this */
-struct dyna *tok_tokenize();
+struct token_vec *tok_tokenize();
+
+/* Tokenizing in steps, this is what tok_tokenize() does */
+/* Creates an empty token array */
+struct token_vec *tok_create_tokens();
+/* Frees the tokens and the array */
+void tok_destroy_tokens(struct token_vec *tokens);
+/* Reads the file header, needs to have rdr_init() called before this
+ * Returns -1 on error */
+int tok_begin(struct token_vec *tokens);
+/* Appends the tokens until the end of the next cue, including the
+ * style blocks, notes and identifiers before it.
+ * Returns 1 if a cue was read, 0 on EOF and -1 on error */
+int tok_tokenize_next(struct token_vec *tokens);
 
 char *tok_2str(struct token *tok, int maxn, char out[maxn]);
 const char *tok_type2str(enum token_type type);
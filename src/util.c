@@ -14,33 +14,6 @@ void deref_free(void *arg)
     free(*(char**)arg);
 }
 
-static void util_count_node_lines_inner(const struct vtt_node *node, int *lc)
-{
-    if (node->type == VNODE_TEXT) {
-        const char *pos = node->text;
-        while ((pos = strchr(pos, '\n'))) {
-            (*lc)++;
-            pos++;
-        }
-        return;
-    }
-    if (node->type == VNODE_TIMESTAMP)
-        return;
-
-    if (node->childs == NULL)
-        return;
-    for (int i = 0; i < node->childs->e_idx; i++)
-        util_count_node_lines_inner(dyna_elem(node->childs, i), lc);
-}
-
-int util_count_node_lines(const struct vtt_node *root)
-{
-    int lc = 1;
-    util_count_node_lines_inner(root, &lc);
-    return lc;
-}
-
-
 void util_combine_extents(int ex_len, const struct text_extents ex[ex_len], struct text_extents *out)
 {
     memset(out, 0, sizeof(*out));
@@ -101,11 +74,3 @@ bool util_is_utf8_start(char chr)
 {
     return ((chr & 0xC0) != 0x80);
 }
-
-uint32_t util_colorname_to_rgb(const char *name)
-{
-    if (strcmp(name, "black") == 0)
-        return 0x00000000;
-
-    return 0x00000000;
-}
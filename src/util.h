@@ -19,7 +19,6 @@ struct text_extents {
 
 void deref_free(void *arg);
 
-int util_count_node_lines(const struct vtt_node *root);
 
 void util_get_text_extents(const char *fontname, const char *text, int fs, struct text_extents *out_ex);
 void util_get_text_extents_line(const char *fontname, const char *text, int text_len, unsigned int text_offset, int item_len, int fs, struct text_extents *out_ex);
@@ -30,8 +29,6 @@ int util_utf8_ccount(int s_len, const char s[s_len]);
 bool util_is_utf8_start(char chr);
 void util_cue_pos_to_an7(const struct ass_cue_pos *pos, const struct text_extents *ext, struct ass_cue_pos *an7_pos);
 
-uint32_t util_colorname_to_rgb(const char *name);
-
 void util_init();
 
 
@@ -0,0 +1,105 @@
+#include "vec.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+void vec_grow(void **data, int64_t *cap, int64_t need, size_t e_size)
+{
+    int64_t new_cap = *cap ? *cap * 2 : 16;
+    void *new_data;
+
+    if (new_cap < need)
+        new_cap = need;
+    new_data = reallocarray(*data, new_cap, e_size);
+    assert(new_data);
+
+    *data = new_data;
+    *cap = new_cap;
+}
+
+/* Merges the sorted [src + a, src + b) and [src + b, src + c) ranges into dst + a */
+static void vec_merge(vec_cmp_fn cmp, size_t es,
+        const uint8_t *src, uint8_t *dst, int64_t a, int64_t b, int64_t c)
+{
+    int64_t l = a, r = b, o = a;
+
+    /* Taking from the left on equal keeps it stable */
+    while (l < b && r < c) {
+        if (cmp(src + r * es, src + l * es) < 0) {
+            memcpy(dst + o++ * es, src + r++ * es, es);
+        } else {
+            memcpy(dst + o++ * es, src + l++ * es, es);
+        }
+    }
+    memcpy(dst + o * es, src + l * es, (b - l) * es);
+    o += b - l;
+    memcpy(dst + o * es, src + r * es, (c - r) * es);
+}
+
+void vec_scratch_free(struct vec_scratch *scratch)
+{
+    free(scratch->tmp);
+    free(scratch->runs);
+    *scratch = (struct vec_scratch){0};
+}
+
+void vec_sort_scratch(void *data, int64_t n, size_t es, vec_cmp_fn cmp, struct vec_scratch *scratch)
+{
+    int64_t *runs, run_count = 0, first;
+    uint8_t *src = data, *dst;
+
+    /* Find the end of the first sorted run, nothing is allocated if that is the whole array */
+    for (first = 1; first < n; first++) {
+        if (cmp(src + (first - 1) * es, src + first * es) > 0)
+            break;
+    }
+    if (first >= n)
+        return;
+
+    if (scratch->runs_cap < n)
+        vec_grow((void**)&scratch->runs, &scratch->runs_cap, n, sizeof(*scratch->runs));
+    if (scratch->tmp_size < (int64_t)(es * n))
+        vec_grow((void**)&scratch->tmp, &scratch->tmp_size, es * n, 1);
+    runs = scratch->runs;
+    dst = scratch->tmp;
+
+    /* The end of each already sorted run is stored */
+    runs[run_count++] = first;
+    for (int64_t i = first + 1; i < n; i++) {
+        if (cmp(src + (i - 1) * es, src + i * es) > 0)
+            runs[run_count++] = i;
+    }
+    runs[run_count++] = n;
+
+    /* Merge neighbouring runs until only 1 is left */
+    while (run_count > 1) {
+        int64_t start = 0, out = 0;
+
+        for (int64_t i = 0; i < run_count; i += 2) {
+            if (i + 1 < run_count) {
+                vec_merge(cmp, es, src, dst, start, runs[i], runs[i + 1]);
+                start = runs[out++] = runs[i + 1];
+            } else {
+                memcpy(dst + start * es, src + start * es, (runs[i] - start) * es);
+                start = runs[out++] = runs[i];
+            }
+        }
+        run_count = out;
+
+        uint8_t *t = src;
+        src = dst;
+        dst = t;
+    }
+
+    if (src != data)
+        memcpy(data, src, es * n);
+}
+
+void vec_sort(void *data, int64_t n, size_t es, vec_cmp_fn cmp)
+{
+    struct vec_scratch scratch = {0};
+
+    vec_sort_scratch(data, n, es, cmp, &scratch);
+    vec_scratch_free(&scratch);
+}
@@ -0,0 +1,92 @@
+#ifndef _VTT2ASS_VEC_H
+#define _VTT2ASS_VEC_H
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <assert.h>
+
+/* Typed arrays, for the hot paths where the size and flags checks of dyna get in the way.
+ * VEC_DEFINE(cue_vec, struct cue) declares struct cue_vec, and cue_vec_*() functions
+ * that store the elements in place. The vector does not free the elements themselves */
+
+typedef int(*vec_cmp_fn)(const void *a, const void *b);
+
+/* Grows *data to hold at least need elements, asserts on error */
+void vec_grow(void **data, int64_t *cap, int64_t need, size_t e_size);
+/* Stable sort, made for mostly sorted arrays. Already sorted
+ * arrays are detected in O(n) and left alone */
+void vec_sort(void *data, int64_t count, size_t e_size, vec_cmp_fn cmp);
+
+/* The memory of vec_sort_scratch(), kept between the calls. Zero it before the first */
+struct vec_scratch {
+    uint8_t *tmp;
+    int64_t *runs;
+    int64_t tmp_size, runs_cap;
+};
+/* Same as vec_sort(), for arrays that are sorted often */
+void vec_sort_scratch(void *data, int64_t count, size_t e_size, vec_cmp_fn cmp, struct vec_scratch *scratch);
+void vec_scratch_free(struct vec_scratch *scratch);
+
+#define VEC_DEFINE(name, type) \
+struct name { \
+    type *data; \
+    int64_t count, cap; \
+}; \
+static inline void name##_init(struct name *v) \
+{ \
+    v->data = NULL; \
+    v->count = v->cap = 0; \
+} \
+/* Frees the array, but not the elements */ \
+static inline void name##_release(struct name *v) \
+{ \
+    free(v->data); \
+    name##_init(v); \
+} \
+/* Makes room for at least cap elements in total */ \
+static inline void name##_reserve(struct name *v, int64_t cap) \
+{ \
+    if (cap > v->cap) \
+        vec_grow((void**)&v->data, &v->cap, cap, sizeof(type)); \
+} \
+static inline struct name *name##_create(int64_t cap) \
+{ \
+    struct name *v = malloc(sizeof(*v)); \
+    assert(v); \
+    name##_init(v); \
+    name##_reserve(v, cap); \
+    return v; \
+} \
+static inline void name##_destroy(struct name *v) \
+{ \
+    free(v->data); \
+    free(v); \
+} \
+/* Returns the new, uninitialized last element */ \
+static inline type *name##_emplace(struct name *v) \
+{ \
+    if (v->count == v->cap) \
+        vec_grow((void**)&v->data, &v->cap, v->count + 1, sizeof(type)); \
+    return &v->data[v->count++]; \
+} \
+static inline type *name##_append(struct name *v, const type *elem) \
+{ \
+    type *dst = name##_emplace(v); \
+    *dst = *elem; \
+    return dst; \
+} \
+static inline type *name##_at(const struct name *v, int64_t idx) \
+{ \
+    assert(idx >= 0 && idx < v->count); \
+    return &v->data[idx]; \
+} \
+static inline void name##_sort(struct name *v, vec_cmp_fn cmp) \
+{ \
+    vec_sort(v->data, v->count, sizeof(type), cmp); \
+} \
+static inline void name##_sort_scratch(struct name *v, vec_cmp_fn cmp, struct vec_scratch *scratch) \
+{ \
+    vec_sort_scratch(v->data, v->count, sizeof(type), cmp, scratch); \
+}
+
+#endif /* _VTT2ASS_VEC_H */
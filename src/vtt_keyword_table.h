@@ -0,0 +1,74 @@
+/* Generated by tools/gen_phash.py from src/keywords.h VTT_KEYWORD_DEF, do not edit */
+#ifndef _VTT2ASS_VTT_KEYWORD_TABLE_H
+#define _VTT2ASS_VTT_KEYWORD_TABLE_H
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+struct vtt_keyword_entry {
+    const char *key; /* NULL for an empty slot */
+    uint8_t key_len;
+    enum vtt_keyword val;
+};
+
+static const uint32_t vtt_keyword_seeds[6] = {
+    3, 9, 17, 1, 7, 0,
+};
+
+static const struct vtt_keyword_entry vtt_keyword_table[32] = {
+    { "ruby", 4, KW_TAG_RUBY },
+    { NULL },
+    { "v", 1, KW_TAG_V },
+    { "align", 5, KW_ALIGN },
+    { NULL },
+    { NULL },
+    { NULL },
+    { "rl", 2, KW_RL },
+    { NULL },
+    { "line-right", 10, KW_LINE_RIGHT },
+    { "middle", 6, KW_MIDDLE },
+    { "i", 1, KW_TAG_I },
+    { NULL },
+    { "vertical", 8, KW_VERTICAL },
+    { "position", 8, KW_POSITION },
+    { "lang", 4, KW_TAG_LANG },
+    { "rt", 2, KW_TAG_RT },
+    { "center", 6, KW_CENTER },
+    { "line", 4, KW_LINE },
+    { "right", 5, KW_RIGHT },
+    { NULL },
+    { "line-left", 9, KW_LINE_LEFT },
+    { "end", 3, KW_END },
+    { NULL },
+    { "lr", 2, KW_LR },
+    { "u", 1, KW_TAG_U },
+    { "left", 4, KW_LEFT },
+    { NULL },
+    { "size", 4, KW_SIZE },
+    { "start", 5, KW_START },
+    { "b", 1, KW_TAG_B },
+    { "c", 1, KW_TAG_C },
+};
+
+static inline uint32_t vtt_keyword_hash(const char *s, size_t len, uint32_t seed)
+{
+    uint32_t h = 0x811c9dc5u ^ seed;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t b = s[i];
+        h ^= b;
+        h *= 0x01000193u;
+    }
+    return h ^ (h >> 16);
+}
+
+/* Returns the entry of the len bytes at s, or NULL if it is not a key */
+static inline const struct vtt_keyword_entry *vtt_keyword_lookup(const char *s, size_t len)
+{
+    uint32_t seed = vtt_keyword_seeds[vtt_keyword_hash(s, len, 0) % 6];
+    const struct vtt_keyword_entry *e = &vtt_keyword_table[vtt_keyword_hash(s, len, seed) % 32];
+    if (e->key == NULL || e->key_len != len || memcmp(e->key, s, len) != 0)
+        return NULL;
+    return e;
+}
+
+#endif /* _VTT2ASS_VTT_KEYWORD_TABLE_H */
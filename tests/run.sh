@@ -0,0 +1,133 @@
+#!/bin/sh
+# Runs the same input through the different code paths, and checks that they all write the
+# same output: more layout threads, the pipeline, the cue and glyph caches, and sorting on disk.
+# The character references are checked against entities.srt.
+# usage: tests/run.sh ./v2a font_file
+set -u
+
+V2A=${1:?usage: $0 v2a font_file}
+FONT=${2:?usage: $0 v2a font_file}
+DIR=$(dirname "$0")
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+# Each copy of cues.vtt is moved 20 seconds later than the previous one.
+# 800 copies are more cues than a block of the layout threads, and their
+# events do not fit in the 1 MiB of -M 1
+COPIES=800
+
+# Prints cues.vtt $COPIES times with shifted times, in reverse order if $1 is "rev"
+make_vtt()
+{
+    awk -v copies=$COPIES -v order="$1" '
+    function ts(t,   a, ms) {
+        split(t, a, /[:.]/)
+        ms = ((a[1] * 60 + a[2]) * 60 + a[3]) * 1000 + a[4] + off
+        return sprintf("%02d:%02d:%02d.%03d", int(ms / 3600000), int(ms / 60000) % 60, int(ms / 1000) % 60, ms % 1000)
+    }
+    BEGIN { RS = ""; FS = "\n" }
+    !/-->/ { head[++nhead] = $0; next }
+    { cues[++ncues] = $0 }
+    END {
+        for (i = 1; i <= nhead; i++)
+            printf "%s\n\n", head[i]
+        for (c = 0; c < copies; c++) {
+            off = (order == "rev" ? copies - 1 - c : c) * 20000
+            for (i = 1; i <= ncues; i++) {
+                n = split(cues[i], lines, "\n")
+                for (j = 1; j <= n; j++) {
+                    if (lines[j] ~ /-->/) {
+                        split(lines[j], f, " ")
+                        lines[j] = ts(f[1]) " --> " ts(f[3]) substr(lines[j], length(f[1] " --> " f[3]) + 1)
+                    }
+                    print lines[j]
+                }
+                print ""
+            }
+        }
+    }' "$DIR/cues.vtt"
+}
+
+fails=0
+
+# run name out_prefix [v2a args before the outputs] -- [ass args]
+# Writes out_prefix.ass and out_prefix.srt from $TMP/in.vtt
+run()
+{
+    name=$1 out=$2
+    shift 2
+    pre=
+    while [ $# -gt 0 ] && [ "$1" != "--" ]; do
+        pre="$pre $1"
+        shift
+    done
+    [ $# -gt 0 ] && shift
+    if ! "$V2A" $pre srt -o "$out.srt" ass "$@" -o "$out.ass" -W 1920 -H 1080 -f "$FONT" "$TMP/in.vtt" > "$TMP/log" 2>&1; then
+        echo "FAIL $name: v2a failed"
+        cat "$TMP/log"
+        fails=$((fails + 1))
+        return 1
+    fi
+}
+
+# same name out_prefix ref_prefix
+same()
+{
+    if cmp -s "$2.ass" "$3.ass" && cmp -s "$2.srt" "$3.srt"; then
+        echo "ok   $1"
+    else
+        echo "FAIL $1: output differs from $(basename "$3")"
+        fails=$((fails + 1))
+    fi
+}
+
+check()
+{
+    name=$1 ref=$2
+    shift 2
+    run "$name" "$TMP/out" "$@" && same "$name" "$TMP/out" "$ref"
+}
+
+# The character references have a known output
+if "$V2A" srt -o "$TMP/entities.srt" "$DIR/entities.vtt" > "$TMP/log" 2>&1 &&
+        cmp -s "$TMP/entities.srt" "$DIR/entities.srt"; then
+    echo "ok   character references"
+else
+    echo "FAIL character references"
+    fails=$((fails + 1))
+fi
+
+for order in in rev; do
+    make_vtt $order > "$TMP/in.vtt"
+    ref=$TMP/ref_$order
+    run "$order: reference" "$ref" -- -j 1 || continue
+
+    check "$order: 4 jobs" "$ref" -- -j 4
+    check "$order: pipeline" "$ref" -P --
+    check "$order: pipeline, dropping the text" "$ref" -P -T --
+    check "$order: sorting on disk" "$ref" -- -M 1
+    check "$order: pipeline, sorting on disk" "$ref" -P -- -M 1
+
+    rm -rf "$TMP/cache" "$TMP/glyphs"
+    check "$order: cold cue cache" "$ref" -- -C "$TMP/cache"
+    check "$order: warm cue cache" "$ref" -- -C "$TMP/cache"
+    check "$order: warm cue cache, 4 jobs" "$ref" -- -j 4 -C "$TMP/cache"
+    check "$order: warm cue cache, pipeline" "$ref" -P -- -C "$TMP/cache"
+    check "$order: cold glyph cache" "$ref" -- -G "$TMP/glyphs"
+    check "$order: warm glyph cache" "$ref" -- -G "$TMP/glyphs"
+done
+
+# The ass events of unordered input are sorted, so they are the same as of the ordered one.
+# The srt is written in the order of the input
+if cmp -s "$TMP/ref_rev.ass" "$TMP/ref_in.ass"; then
+    echo "ok   rev: same ass as in"
+else
+    echo "FAIL rev: same ass as in"
+    fails=$((fails + 1))
+fi
+
+if [ $fails -gt 0 ]; then
+    echo "$fails failed"
+    exit 1
+fi
+echo "All passed"
@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+# Writes the input of gen_phash.py for the HTML named character references,
+# from the WHATWG list that ships with python.
+# The names are kept as they are in the list, so the ones that end with ';' have it
+# in the key. The legacy names that are also valid without the ';' (like "amp")
+# are in it twice, with and without it.
+#
+# usage: gen_html_entities.py > html_entities.txt
+
+import html.entities
+import sys
+
+# The directional marks are stripped, the renderer does its own bidi
+STRIPPED = {'lrm', 'rlm'}
+
+
+def c_string(s):
+    return '"' + ''.join('\\x%02x' % b for b in s.encode('utf-8')) + '"'
+
+
+def main():
+    o = sys.stdout.write
+    o('# Generated by tools/gen_html_entities.py, do not edit\n')
+    for name, chars in sorted(html.entities.html5.items()):
+        if name.rstrip(';') in STRIPPED:
+            chars = ''
+        o('%s %s\n' % (name, c_string(chars)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+# Generates a C header with a perfect hash table for a fixed set of keys.
+#
+# Input lines are "key value", the value is copied into the C source as is,
+# so it can be a number, an enum name or a string literal.
+# Empty lines, and lines starting with '#' are skipped.
+# With --def MACRO, the input is a C header instead, and the entries are the
+# ex(VALUE, "key") lines of the X-macro list MACRO in it.
+#
+# The table uses hash and displace: a key goes into bucket hash(key, 0) % nbuckets,
+# and every bucket has a seed that places all of its keys into free slots with
+# hash(key, seed) % nslots. So a lookup is two hashes and one compare.
+#
+# usage: gen_phash.py --name NAME --type CTYPE [--icase] [--def MACRO] input > out.h
+
+import argparse
+import re
+import sys
+
+FNV_OFFSET = 0x811c9dc5
+FNV_PRIME = 0x01000193
+
+
+def fnv1a(key, seed, icase):
+    h = (FNV_OFFSET ^ seed) & 0xffffffff
+    for b in key:
+        if icase and 0x41 <= b <= 0x5a:
+            b |= 0x20
+        h ^= b
+        h = (h * FNV_PRIME) & 0xffffffff
+    # The low bits of the product only depend on the low bits of the bytes
+    return h ^ (h >> 16)
+
+
+def read_entries(path):
+    entries = []
+    with open(path, encoding='utf-8') as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            key, val = line.split(None, 1)
+            entries.append((key.encode('utf-8'), val))
+    return entries
+
+
+def read_def_entries(path, macro):
+    with open(path, encoding='utf-8') as f:
+        lines = f.read().split('\n')
+    start = None
+    for i, line in enumerate(lines):
+        if re.match(r'#define\s+%s\s*\(' % re.escape(macro), line):
+            start = i
+            break
+    if start is None:
+        sys.exit('no %s in %s' % (macro, path))
+
+    body = []
+    for line in lines[start + 1:]:
+        body.append(line)
+        if not line.rstrip().endswith('\\'):
+            break
+    entries = []
+    for m in re.finditer(r'\bex\(\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)', '\n'.join(body)):
+        entries.append((m.group(2).encode('utf-8'), m.group(1)))
+    return entries
+
+
+def build(keys, icase):
+    nslots = 1
+    while nslots < len(keys):
+        nslots *= 2
+    nbuckets = max(1, (len(keys) + 3) // 4)
+
+    buckets = [[] for _ in range(nbuckets)]
+    for i, k in enumerate(keys):
+        buckets[fnv1a(k, 0, icase) % nbuckets].append(i)
+
+    seeds = [0] * nbuckets
+    slots = [-1] * nslots
+    for b in sorted(range(nbuckets), key=lambda b: -len(buckets[b])):
+        if not buckets[b]:
+            continue
+        for seed in range(1, 1 << 20):
+            pos = [fnv1a(keys[i], seed, icase) % nslots for i in buckets[b]]
+            if len(set(pos)) == len(pos) and all(slots[p] == -1 for p in pos):
+                break
+        else:
+            sys.exit('no seed found for a bucket')
+        seeds[b] = seed
+        for i, p in zip(buckets[b], pos):
+            slots[p] = i
+    return seeds, slots
+
+
+def c_string(b):
+    out = '"'
+    for c in b:
+        if c in (0x22, 0x5c):
+            out += '\\' + chr(c)
+        elif 0x20 <= c < 0x7f:
+            out += chr(c)
+        else:
+            out += '\\x%02x""' % c
+    return out + '"'
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument('--name', required=True, help='prefix of the generated symbols')
+    ap.add_argument('--type', required=True, help='C type of the values')
+    ap.add_argument('--icase', action='store_true', help='ASCII case insensitive keys')
+    ap.add_argument('--def', dest='macro', help='read the entries from this X-macro list of the input header')
+    ap.add_argument('input')
+    args = ap.parse_args()
+
+    if args.macro:
+        entries = read_def_entries(args.input, args.macro)
+    else:
+        entries = read_entries(args.input)
+    keys = [k.lower() if args.icase else k for k, _ in entries]
+    if len(set(keys)) != len(keys):
+        sys.exit('duplicate keys in ' + args.input)
+    seeds, slots = build(keys, args.icase)
+
+    n = args.name
+    guard = '_VTT2ASS_%s_TABLE_H' % n.upper()
+    cmp = 'strncasecmp' if args.icase else 'memcmp'
+    fold = ' | (((b) >= \'A\' && (b) <= \'Z\') ? 0x20 : 0)' if args.icase else ''
+    o = sys.stdout.write
+
+    src = args.input + (' ' + args.macro if args.macro else '')
+    o('/* Generated by tools/gen_phash.py from %s, do not edit */\n' % src)
+    o('#ifndef %s\n#define %s\n' % (guard, guard))
+    o('#include <stddef.h>\n#include <stdint.h>\n#include <string.h>\n')
+    if args.icase:
+        o('#include <strings.h>\n')
+    o('\n')
+    o('struct %s_entry {\n    const char *key; /* NULL for an empty slot */\n' % n)
+    o('    uint8_t key_len;\n    %s val;\n};\n\n' % args.type)
+
+    o('static const uint32_t %s_seeds[%d] = {' % (n, len(seeds)))
+    for i, s in enumerate(seeds):
+        o(('\n    ' if i % 8 == 0 else ' ') + '%d,' % s)
+    o('\n};\n\n')
+
+    o('static const struct %s_entry %s_table[%d] = {\n' % (n, n, len(slots)))
+    for i in slots:
+        if i == -1:
+            o('    { NULL },\n')
+        else:
+            k, v = entries[i]
+            o('    { %s, %d, %s },\n' % (c_string(k), len(k), v))
+    o('};\n\n')
+
+    o('static inline uint32_t %s_hash(const char *s, size_t len, uint32_t seed)\n{\n' % n)
+    o('    uint32_t h = 0x%08xu ^ seed;\n' % FNV_OFFSET)
+    o('    for (size_t i = 0; i < len; i++) {\n')
+    o('        uint8_t b = s[i];\n')
+    o('        h ^= b%s;\n' % fold.replace('(b)', 'b'))
+    o('        h *= 0x%08xu;\n    }\n    return h ^ (h >> 16);\n}\n\n' % FNV_PRIME)
+
+    o('/* Returns the entry of the len bytes at s, or NULL if it is not a key */\n')
+    o('static inline const struct %s_entry *%s_lookup(const char *s, size_t len)\n{\n' % (n, n))
+    o('    uint32_t seed = %s_seeds[%s_hash(s, len, 0) %% %d];\n' % (n, n, len(seeds)))
+    o('    const struct %s_entry *e = &%s_table[%s_hash(s, len, seed) %% %d];\n' % (n, n, n, len(slots)))
+    o('    if (e->key == NULL || e->key_len != len || %s(e->key, s, len) != 0)\n' % cmp)
+    o('        return NULL;\n    return e;\n}\n\n')
+    o('#endif /* %s */\n' % guard)
+
+
+if __name__ == '__main__':
+    main()